@@ -0,0 +1,139 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains definition of a runner of benchmarks which compares their results with a stored baseline
+
+	\todo
+*/
+#pragma once
+
+
+#include <gplc.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <functional>
+
+
+namespace gplc
+{
+	/*!
+		\brief The context is passed into each iteration of a benchmark. Only code which is executed within Measure is
+		timed, so an iteration can prepare its input before
+	*/
+
+	class CBenchmarkContext
+	{
+		public:
+			typedef std::chrono::steady_clock     TClock;
+
+			typedef std::map<std::string, U64>    TCountersMap;
+		public:
+			CBenchmarkContext() = default;
+			~CBenchmarkContext() = default;
+
+			template <typename TFunction>
+			void Measure(TFunction&& function)
+			{
+				const TClock::time_point startTime = TClock::now();
+
+				function();
+
+				mElapsedTime += std::chrono::duration<F64, std::milli>(TClock::now() - startTime).count();
+			}
+
+			/*!
+				\brief Counters describe amount of work which is done by an iteration, e.g. number of lexed tokens. Unlike
+				time they don't depend on a machine, so they're the strict part of the comparison with the baseline
+			*/
+
+			void SetCounter(const std::string& name, U64 value);
+
+			/*!
+				\brief The method marks the benchmark as failed, it's reported and its results aren't compared
+			*/
+
+			void SetError(const std::string& message);
+
+			F64 GetElapsedTime() const;
+
+			const TCountersMap& GetCounters() const;
+
+			const std::string& GetError() const;
+		protected:
+			CBenchmarkContext(const CBenchmarkContext&) = delete;
+		protected:
+			F64          mElapsedTime = 0.0; ///< \note The time is specified in milliseconds
+
+			TCountersMap mCounters;
+
+			std::string  mError;
+	};
+
+
+	typedef struct TBenchmarkResult
+	{
+		F64                             mMedianTime = 0.0; ///< \note The time is specified in milliseconds
+
+		F64                             mMinTime    = 0.0; ///< \note The time is specified in milliseconds
+
+		CBenchmarkContext::TCountersMap mCounters;
+	} TBenchmarkResult, *TBenchmarkResultPtr;
+
+
+	class CBenchmarkRunner
+	{
+		public:
+			typedef std::function<void(CBenchmarkContext&)>  TBenchmarkFunction;
+
+			typedef std::map<std::string, TBenchmarkResult> TResultsMap;
+		public:
+			static const std::string TimeReferenceBenchmarkName; ///< \note Times of a baseline are scaled by the ratio of this benchmark's times
+		public:
+			CBenchmarkRunner() = default;
+			~CBenchmarkRunner() = default;
+
+			void AddBenchmark(const std::string& name, const TBenchmarkFunction& function);
+
+			/*!
+				\brief The method runs benchmarks whose names contain the filter, each of them runs once more before the
+				measured iterations to warm up caches
+
+				\return The method returns RV_FAIL if some of benchmarks have failed, their results aren't added then
+			*/
+
+			Result Run(const std::string& filter, U32 iterationsCount, TResultsMap& results) const;
+
+			/*!
+				\brief The method prints results and their differences with the baseline if it isn't empty. Times of the baseline
+				are scaled by the ratio of TimeReferenceBenchmarkName's times, so the baseline can be recorded on another machine
+
+				\param[in] tolerance A relative difference of time in percents which isn't considered as a regression
+
+				\param[in] isTimeChecked If it's false a slowdown is only reported
+
+				\return The method returns RV_FAIL if some counter of a benchmark exceeds the baseline's one or if time exceeds
+				the baseline's one by more than the tolerance and isTimeChecked is true
+			*/
+
+			static Result CompareWithBaseline(const TResultsMap& results, const TResultsMap& baseline, F64 tolerance, bool isTimeChecked);
+
+			/*!
+				\brief The baseline is stored as a text file where each line describes a benchmark, its median and minimal
+				time and its counters separated by tabs
+			*/
+
+			static Result SaveBaseline(const std::string& filename, const TResultsMap& results);
+
+			static TResult<TResultsMap> LoadBaseline(const std::string& filename);
+		protected:
+			CBenchmarkRunner(const CBenchmarkRunner&) = delete;
+
+			static bool _isRegression(F64 value, F64 baselineValue, F64 tolerance);
+		protected:
+			std::vector<std::pair<std::string, TBenchmarkFunction>> mBenchmarks;
+	};
+}
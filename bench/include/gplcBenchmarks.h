@@ -0,0 +1,31 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains declarations of functions which register benchmarks of the compiler
+
+	\todo
+*/
+#pragma once
+
+
+#include "gplcBenchmarkRunner.h"
+
+
+namespace gplc
+{
+	/*!
+		\brief The function registers benchmarks of separate stages of the compiler, each of them is measured on inputs
+		which are prepared by the previous stages outside of the measured code
+	*/
+
+	void RegisterStagesBenchmarks(CBenchmarkRunner& runner);
+
+	/*!
+		\brief The function registers benchmarks which compile generated programs with the compiler's driver, from
+		reading of sources up to emission of LLVM bitcode
+	*/
+
+	void RegisterCompileBenchmarks(CBenchmarkRunner& runner);
+}
@@ -0,0 +1,114 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains definition of a generator of synthetic gpl programs which are compiled by benchmarks
+
+	\todo
+*/
+#pragma once
+
+
+#include <gplc.h>
+#include <string>
+#include <vector>
+
+
+namespace gplc
+{
+	/*!
+		\brief The structure describes axes along which a generated program scales
+	*/
+
+	typedef struct TWorkloadDesc
+	{
+		U32 mModulesCount       = 0; ///< \note The main module isn't counted
+
+		U32 mDiamondDepth       = 1; ///< \note Modules are split into the specified number of layers, a module imports ones of the next layer only
+
+		U32 mImportsFanOut      = 1; ///< \note Number of modules of the next layer which are imported by each module
+
+		U32 mFunctionsPerModule = 4; ///< \note The option specifies size of a file
+
+		U32 mStatementsPerBlock = 2;
+
+		U32 mNestingDepth       = 2; ///< \note Number of nested if and while statements within each function
+
+		U32 mExpressionLength   = 4; ///< \note Number of operands of each arithmetic expression
+
+		U32 mStructsPerModule   = 0;
+
+		U32 mVariantsPerModule  = 0;
+	} TWorkloadDesc, *TWorkloadDescPtr;
+
+
+	typedef struct TModuleSource
+	{
+		std::string mName;
+
+		std::string mSource;
+	} TModuleSource, *TModuleSourcePtr;
+
+
+	/*!
+		\brief The generator produces only constructs which are supported by all stages of the compiler, so each generated
+		program compiles without errors. The output is fully determined by the description, so is the amount of work for the compiler
+
+		Modules of a layer import modules of the next one, so two modules which import the same one form a diamond. Functions of
+		a module call the previous functions of the module and the first function of each imported module
+	*/
+
+	class CWorkloadGenerator
+	{
+		public:
+			typedef std::vector<TModuleSource> TModulesArray;
+
+			typedef std::vector<std::string>   TStringsArray;
+		public:
+			explicit CWorkloadGenerator(const TWorkloadDesc& desc);
+			~CWorkloadGenerator() = default;
+
+			/*!
+				\return The method returns all modules of the program, the main module goes first
+			*/
+
+			TModulesArray Generate() const;
+
+			/*!
+				\brief The method generates a single module which imports the specified ones, their first functions are called
+			*/
+
+			std::string GenerateModule(const TStringsArray& importedModules, U32 seed = 0) const;
+
+			/*!
+				\brief The method writes all modules of the program into the directory, the directory is created if it doesn't exist
+
+				\return The method returns a path to the main module's file
+			*/
+
+			TResult<std::string> WriteToDirectory(const std::string& directory) const;
+
+			static const C8* GetMainModuleName();
+		protected:
+			CWorkloadGenerator(const CWorkloadGenerator&) = delete;
+
+			std::string _generateMainModule(const TStringsArray& importedModules) const;
+
+			void _generateTypes(std::string& output) const;
+
+			void _generateFunction(std::string& output, U32 functionIndex, const TStringsArray& importedModules, U32& seed) const;
+
+			void _generateBlock(std::string& output, U32 level, U32& seed) const;
+
+			void _generateExpression(std::string& output, bool isResultDeclared, U32& seed) const;
+
+			static U32 _nextRandom(U32& seed);
+
+			static std::string _getModuleName(U32 layerIndex, U32 moduleIndex);
+		protected:
+			TWorkloadDesc mDesc;
+
+			std::vector<U32> mLayersSizes;
+	};
+}
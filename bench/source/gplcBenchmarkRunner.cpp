@@ -0,0 +1,271 @@
+#include "gplcBenchmarkRunner.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <cstdio>
+
+
+namespace gplc
+{
+	const std::string CBenchmarkRunner::TimeReferenceBenchmarkName = "lexer/large_module";
+
+
+	void CBenchmarkContext::SetCounter(const std::string& name, U64 value)
+	{
+		mCounters[name] = value;
+	}
+
+	void CBenchmarkContext::SetError(const std::string& message)
+	{
+		mError = message;
+	}
+
+	F64 CBenchmarkContext::GetElapsedTime() const
+	{
+		return mElapsedTime;
+	}
+
+	const CBenchmarkContext::TCountersMap& CBenchmarkContext::GetCounters() const
+	{
+		return mCounters;
+	}
+
+	const std::string& CBenchmarkContext::GetError() const
+	{
+		return mError;
+	}
+
+
+	void CBenchmarkRunner::AddBenchmark(const std::string& name, const TBenchmarkFunction& function)
+	{
+		mBenchmarks.push_back({ name, function });
+	}
+
+	Result CBenchmarkRunner::Run(const std::string& filter, U32 iterationsCount, TResultsMap& results) const
+	{
+		Result result = RV_SUCCESS;
+
+		iterationsCount = std::max<U32>(1, iterationsCount);
+
+		for (const auto& currBenchmark : mBenchmarks)
+		{
+			if (currBenchmark.first.find(filter) == std::string::npos)
+			{
+				continue;
+			}
+
+			std::cout << "Running " << currBenchmark.first << " ..." << std::endl;
+
+			std::vector<F64> times;
+
+			TBenchmarkResult benchmarkResult;
+
+			// \note the first iteration isn't measured, it's used to warm up caches and lazily created inputs
+			for (U32 i = 0; i <= iterationsCount; ++i)
+			{
+				CBenchmarkContext context;
+
+				currBenchmark.second(context);
+
+				if (!context.GetError().empty())
+				{
+					std::cout << "Error: " << currBenchmark.first << " has failed (" << context.GetError() << ")" << std::endl;
+
+					result = RV_FAIL;
+
+					break;
+				}
+
+				if (i)
+				{
+					times.push_back(context.GetElapsedTime());
+				}
+
+				benchmarkResult.mCounters = context.GetCounters();
+			}
+
+			if (times.size() != iterationsCount)
+			{
+				continue;
+			}
+
+			std::sort(times.begin(), times.end());
+
+			benchmarkResult.mMinTime    = times.front();
+			benchmarkResult.mMedianTime = (iterationsCount % 2) ? times[iterationsCount / 2] : 0.5 * (times[iterationsCount / 2 - 1] + times[iterationsCount / 2]);
+
+			results[currBenchmark.first] = benchmarkResult;
+		}
+
+		return result;
+	}
+
+	Result CBenchmarkRunner::CompareWithBaseline(const TResultsMap& results, const TResultsMap& baseline, F64 tolerance, bool isTimeChecked)
+	{
+		Result result = RV_SUCCESS;
+
+		C8 buffer[256];
+
+		// \note the baseline is recorded on another machine, so its times are scaled by the ratio of reference benchmark's times
+		auto referenceIter         = results.find(TimeReferenceBenchmarkName);
+		auto baselineReferenceIter = baseline.find(TimeReferenceBenchmarkName);
+
+		const bool isNormalized = (referenceIter != results.cend()) && (baselineReferenceIter != baseline.cend()) && (baselineReferenceIter->second.mMedianTime > 0.0);
+
+		const F64 timeScale = isNormalized ? (referenceIter->second.mMedianTime / baselineReferenceIter->second.mMedianTime) : 1.0;
+
+		if (!baseline.empty())
+		{
+			std::cout << "\n" << (isNormalized ? "Baseline times are scaled relative to " : "Baseline times aren't scaled, there are no results of ") << TimeReferenceBenchmarkName << "\n";
+		}
+
+		std::snprintf(buffer, sizeof(buffer), "%-40s%14s%14s%16s%10s\n", "Benchmark", "Median (ms)", "Min (ms)", "Baseline (ms)", "Change");
+
+		std::cout << "\n" << buffer;
+
+		for (const auto& currResult : results)
+		{
+			const TBenchmarkResult& benchmarkResult = currResult.second;
+
+			auto baselineIter = baseline.find(currResult.first);
+
+			if (baselineIter == baseline.cend())
+			{
+				std::snprintf(buffer, sizeof(buffer), "%-40s%14.3f%14.3f%16s%10s\n", currResult.first.c_str(), benchmarkResult.mMedianTime, benchmarkResult.mMinTime,
+							  baseline.empty() ? "" : "-", baseline.empty() ? "" : "new");
+
+				std::cout << buffer;
+
+				continue;
+			}
+
+			const TBenchmarkResult& baselineResult = baselineIter->second;
+
+			const F64 baselineTime = timeScale * baselineResult.mMedianTime;
+
+			const bool isTimeRegression = _isRegression(benchmarkResult.mMedianTime, baselineTime, tolerance);
+
+			std::snprintf(buffer, sizeof(buffer), "%-40s%14.3f%14.3f%16.3f%+9.1f%%%s\n", currResult.first.c_str(), benchmarkResult.mMedianTime, benchmarkResult.mMinTime,
+						  baselineTime, 100.0 * (benchmarkResult.mMedianTime / std::max(baselineTime, 1e-6) - 1.0),
+						  isTimeRegression ? (isTimeChecked ? "  REGRESSION" : "  SLOWER") : "");
+
+			std::cout << buffer;
+
+			result = (isTimeRegression && isTimeChecked) ? RV_FAIL : result;
+
+			// \note counters are printed only if they differ, a change of the amount of work is what usually explains a change of time
+			for (const auto& currCounter : benchmarkResult.mCounters)
+			{
+				auto baselineCounterIter = baselineResult.mCounters.find(currCounter.first);
+
+				if (baselineCounterIter == baselineResult.mCounters.cend() || baselineCounterIter->second == currCounter.second)
+				{
+					continue;
+				}
+
+				// \note counters don't depend on a machine, so any growth of them is a regression regardless of the tolerance
+				const bool isCounterRegression = currCounter.second > baselineCounterIter->second;
+
+				std::snprintf(buffer, sizeof(buffer), "    %s: %llu (baseline %llu)%s\n", currCounter.first.c_str(), currCounter.second, baselineCounterIter->second,
+							  isCounterRegression ? "  REGRESSION" : "");
+
+				std::cout << buffer;
+
+				result = isCounterRegression ? RV_FAIL : result;
+			}
+		}
+
+		return result;
+	}
+
+	Result CBenchmarkRunner::SaveBaseline(const std::string& filename, const TResultsMap& results)
+	{
+		std::ofstream baselineFile(filename, std::ios::trunc);
+
+		if (!baselineFile.is_open())
+		{
+			return RV_FAIL;
+		}
+
+		baselineFile << "# gplc_bench baseline: benchmark, median time (ms), min time (ms), counters. Times are compared relative to " << TimeReferenceBenchmarkName << "\n";
+
+		C8 buffer[64];
+
+		for (const auto& currResult : results)
+		{
+			std::snprintf(buffer, sizeof(buffer), "\t%.3f\t%.3f", currResult.second.mMedianTime, currResult.second.mMinTime);
+
+			baselineFile << currResult.first << buffer;
+
+			for (const auto& currCounter : currResult.second.mCounters)
+			{
+				baselineFile << "\t" << currCounter.first << "=" << currCounter.second;
+			}
+
+			baselineFile << "\n";
+		}
+
+		return baselineFile.good() ? RV_SUCCESS : RV_FAIL;
+	}
+
+	TResult<CBenchmarkRunner::TResultsMap> CBenchmarkRunner::LoadBaseline(const std::string& filename)
+	{
+		std::ifstream baselineFile(filename);
+
+		if (!baselineFile.is_open())
+		{
+			return TErrorValue<E_RESULT_VALUE>(RV_FILE_NOT_FOUND);
+		}
+
+		TResultsMap baseline;
+
+		std::string currLine;
+
+		while (std::getline(baselineFile, currLine))
+		{
+			if (currLine.empty() || currLine.front() == '#')
+			{
+				continue;
+			}
+
+			std::vector<std::string> columns;
+
+			std::istringstream lineStream(currLine);
+
+			for (std::string currColumn; std::getline(lineStream, currColumn, '\t');)
+			{
+				columns.push_back(currColumn);
+			}
+
+			if (columns.size() < 3)
+			{
+				return TErrorValue<E_RESULT_VALUE>(RV_FAIL);
+			}
+
+			TBenchmarkResult& benchmarkResult = baseline[columns[0]];
+
+			benchmarkResult.mMedianTime = std::strtod(columns[1].c_str(), nullptr);
+			benchmarkResult.mMinTime    = std::strtod(columns[2].c_str(), nullptr);
+
+			for (size_t i = 3; i < columns.size(); ++i)
+			{
+				const size_t separatorPos = columns[i].find_last_of('=');
+
+				if (separatorPos == std::string::npos)
+				{
+					return TErrorValue<E_RESULT_VALUE>(RV_FAIL);
+				}
+
+				benchmarkResult.mCounters[columns[i].substr(0, separatorPos)] = std::strtoull(columns[i].c_str() + separatorPos + 1, nullptr, 10);
+			}
+		}
+
+		return TOkValue<TResultsMap>(baseline);
+	}
+
+	bool CBenchmarkRunner::_isRegression(F64 value, F64 baselineValue, F64 tolerance)
+	{
+		return value > baselineValue * (1.0 + 0.01 * tolerance);
+	}
+}
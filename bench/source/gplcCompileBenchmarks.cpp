@@ -0,0 +1,182 @@
+#include "gplcBenchmarks.h"
+#include "gplcWorkloadGenerator.h"
+#include "gplcCompilerDriver.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <memory>
+
+
+namespace gplc
+{
+	namespace
+	{
+		/*!
+			\return The function returns a sum of counters of the group whose names start with the prefix
+		*/
+
+		U64 SumStatistics(const std::string& group, const std::string& prefix)
+		{
+			const CStatistics::TCountersGroupsMap& counters = CStatistics::GetCounters();
+
+			auto groupIter = counters.find(group);
+
+			if (groupIter == counters.cend())
+			{
+				return 0;
+			}
+
+			U64 sum = 0;
+
+			for (const auto& currCounter : groupIter->second)
+			{
+				sum += (currCounter.first.compare(0, prefix.length(), prefix) == 0) ? currCounter.second : 0;
+			}
+
+			return sum;
+		}
+
+
+		/*!
+			\brief The benchmark writes the program into a temporary directory on the first run, each run compiles it from
+			scratch with a new driver which emits LLVM bitcode, so no system linker is needed
+		*/
+
+		CBenchmarkRunner::TBenchmarkFunction CreateCompileBenchmark(const std::string& name, const TWorkloadDesc& desc)
+		{
+			std::string directoryName(name);
+
+			std::replace(directoryName.begin(), directoryName.end(), '/', '_');
+
+			const std::string directory = (std::filesystem::temp_directory_path() / "gplc_bench" / directoryName).string();
+
+			auto pIsWritten = std::make_shared<bool>(false);
+
+			return [directory, desc, pIsWritten](CBenchmarkContext& context)
+			{
+				if (!*pIsWritten)
+				{
+					std::filesystem::remove_all(directory);
+
+					if (!CWorkloadGenerator(desc).WriteToDirectory(directory).IsOk())
+					{
+						context.SetError(std::string("the program isn't written into ").append(directory));
+
+						return;
+					}
+
+					*pIsWritten = true;
+				}
+
+				TCompilerOptions compilerOptions;
+
+				compilerOptions.mInputFilename        = std::string(CWorkloadGenerator::GetMainModuleName()).append(".gpls");
+				compilerOptions.mOutputFilename       = CWorkloadGenerator::GetMainModuleName();
+				compilerOptions.mEmitFlag             = E_EMIT_FLAGS::EF_LLVM_BC;
+				compilerOptions.mIsStatisticsEnabled  = true;
+
+				// \note the driver resolves imports relative to the working directory and reports its progress into the standard output
+				const std::filesystem::path prevWorkingDirectory = std::filesystem::current_path();
+
+				std::filesystem::current_path(directory);
+
+				std::ostringstream driverOutput;
+
+				std::streambuf* pPrevOutputBuffer = std::cout.rdbuf(driverOutput.rdbuf());
+
+				Result result = RV_FAIL;
+
+				context.Measure([&compilerOptions, &result]()
+				{
+					auto compilerDriver = CreateCompilerDriver(compilerOptions);
+
+					if (!compilerDriver.IsOk())
+					{
+						return;
+					}
+
+					ICompilerDriver* pCompilerDriver = compilerDriver.Get();
+
+					result = pCompilerDriver->Run({ compilerOptions.mInputFilename });
+
+					pCompilerDriver->Free();
+				});
+
+				std::cout.rdbuf(pPrevOutputBuffer);
+
+				std::filesystem::current_path(prevWorkingDirectory);
+
+				if (!SUCCESS(result))
+				{
+					context.SetError(std::string("the program in ").append(directory).append(" isn't compiled:\n").append(driverOutput.str()));
+
+					return;
+				}
+
+				// \note counters of the last build are kept until the next driver is initialized
+				context.SetCounter("tokens", SumStatistics("lexer", "tokens "));
+				context.SetCounter("ast nodes", SumStatistics("ast", "nodes "));
+				context.SetCounter("types", SumStatistics("types", "created "));
+				context.SetCounter("symbol lookups", SumStatistics("symtable", "lookups"));
+				context.SetCounter("ir functions", SumStatistics("codegen", "functions"));
+				context.SetCounter("ir instructions", SumStatistics("codegen", "instructions "));
+
+				CStatistics::SetEnabled(false);
+			};
+		}
+	}
+
+
+	void RegisterCompileBenchmarks(CBenchmarkRunner& runner)
+	{
+		auto addBenchmark = [&runner](const std::string& name, const TWorkloadDesc& desc)
+		{
+			runner.AddBenchmark(name, CreateCompileBenchmark(name, desc));
+		};
+
+		TWorkloadDesc desc;
+
+		// a single file, its size is the only axis
+		desc.mFunctionsPerModule = 96;
+		desc.mStatementsPerBlock = 4;
+
+		addBenchmark("compile/large_file", desc);
+
+		// each module imports all modules of the next layer
+		desc = TWorkloadDesc();
+		desc.mModulesCount       = 8;
+		desc.mDiamondDepth       = 2;
+		desc.mImportsFanOut      = 4;
+
+		addBenchmark("compile/imports_fan_out", desc);
+
+		// a chain of diamonds, each layer contains two modules which both import the next layer's ones
+		desc = TWorkloadDesc();
+		desc.mModulesCount       = 8;
+		desc.mDiamondDepth       = 4;
+		desc.mImportsFanOut      = 2;
+
+		addBenchmark("compile/diamond_depth", desc);
+
+		desc = TWorkloadDesc();
+		desc.mFunctionsPerModule = 8;
+		desc.mNestingDepth       = 32;
+
+		addBenchmark("compile/nesting_depth", desc);
+
+		desc = TWorkloadDesc();
+		desc.mFunctionsPerModule = 8;
+		desc.mExpressionLength   = 48;
+
+		addBenchmark("compile/expression_length", desc);
+
+		// \note each structure contains the previous one, so the number of structures is a depth of nesting of their fields
+		desc = TWorkloadDesc();
+		desc.mFunctionsPerModule = 32;
+		desc.mStructsPerModule   = 16;
+		desc.mVariantsPerModule  = 32;
+
+		addBenchmark("compile/structs_and_variants", desc);
+	}
+}
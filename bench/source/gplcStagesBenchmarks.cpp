@@ -0,0 +1,445 @@
+#include "gplcBenchmarks.h"
+#include "gplcWorkloadGenerator.h"
+#include "llvm/IR/Module.h"
+#include <memory>
+
+
+namespace gplc
+{
+	namespace
+	{
+		/*!
+			\brief The stream reads lines of a generated module from memory, so the lexer's benchmark doesn't depend on a file system
+		*/
+
+		class CStringInputStream final: public IInputStream
+		{
+			public:
+				explicit CStringInputStream(const std::string& source):
+					IInputStream(), mSource(source), mCurrPos(0)
+				{
+				}
+
+				Result Open() override
+				{
+					mCurrPos = 0;
+
+					return RV_SUCCESS;
+				}
+
+				Result Close() override
+				{
+					return RV_SUCCESS;
+				}
+
+				TResult<std::string> ReadLine() override
+				{
+					if (mCurrPos >= mSource.length())
+					{
+						return TErrorValue<E_RESULT_VALUE>(RV_FAIL);
+					}
+
+					const size_t lineEndPos = std::min(mSource.find('\n', mCurrPos), mSource.length() - 1);
+
+					std::string line = mSource.substr(mCurrPos, lineEndPos - mCurrPos + 1);
+
+					mCurrPos = lineEndPos + 1;
+
+					return TOkValue<std::string>(line);
+				}
+			protected:
+				std::string mSource;
+
+				size_t      mCurrPos;
+		};
+
+
+		/*!
+			\brief The lexer replays tokens which are recognized by CLexer before, so the parser's benchmark doesn't measure lexing
+		*/
+
+		class CReplayLexer final: public ILexer
+		{
+			public:
+				explicit CReplayLexer(const std::vector<const CToken*>& tokens):
+					ILexer(), mTokens(tokens), mCurrTokenIndex(-1)
+				{
+				}
+
+				Result Init(IInputStream* pInputStream) override
+				{
+					return Reset();
+				}
+
+				Result Reset() override
+				{
+					mCurrTokenIndex = -1;
+
+					return RV_SUCCESS;
+				}
+
+				const CToken* GetCurrToken() override
+				{
+					return (mCurrTokenIndex < 0) ? GetNextToken() : _getToken(mCurrTokenIndex);
+				}
+
+				const CToken* GetNextToken() override
+				{
+					return _getToken(++mCurrTokenIndex);
+				}
+
+				const CToken* PeekNextToken(U32 numOfSteps) override
+				{
+					return _getToken(mCurrTokenIndex + static_cast<I64>(numOfSteps));
+				}
+			protected:
+				const CToken* _getToken(I64 index) const
+				{
+					return (index >= 0 && static_cast<size_t>(index) < mTokens.size()) ? mTokens[static_cast<size_t>(index)] : nullptr;
+				}
+			protected:
+				std::vector<const CToken*> mTokens;
+
+				I64                        mCurrTokenIndex;
+		};
+
+
+		/*!
+			\brief The class owns objects which compile a single module in the same way as the compiler's driver does. The symbol
+			table and factories only grow, so the objects are recreated for each iteration of a benchmark
+		*/
+
+		class CModuleCompiler
+		{
+			public:
+				CModuleCompiler():
+					mpLexer(new CLexer()), mpParser(new CParser()), mpSymTable(new CSymTable()), mpSemanticAnalyser(new CSemanticAnalyser()),
+					mpConstantFolder(new CConstantFolder()), mpFunctionAttributesAnalyser(new CFunctionAttributesAnalyser()),
+					mpNodesFactory(new CASTNodesFactory()), mpTypesFactory(new CTypesFactory(GetHostTargetAlignments())), mpTypeResolver(new CTypeResolver()),
+					mpInterpreter(new CConstExprInterpreter()), mpCodeGenerator(new CLLVMCodeGenerator()), mpModuleResolver(new CModuleResolver())
+				{
+					mpTypeResolver->Init(mpSymTable, mpInterpreter, mpTypesFactory);
+					mpInterpreter->Init(mpTypeResolver);
+				}
+
+				~CModuleCompiler()
+				{
+					delete mpModuleResolver;
+					delete mpCodeGenerator;
+					delete mpInterpreter;
+					delete mpTypeResolver;
+					delete mpTypesFactory;
+					delete mpNodesFactory;
+					delete mpFunctionAttributesAnalyser;
+					delete mpConstantFolder;
+					delete mpSemanticAnalyser;
+					delete mpSymTable;
+					delete mpParser;
+					delete mpLexer;
+				}
+
+				/*!
+					\brief The method enters the module's scope which isn't left then, as the code generator expects
+				*/
+
+				void BeginModule(const std::string& moduleName)
+				{
+					mpSymTable->CreateNamedScope(moduleName);
+					mpModuleResolver->ResolveModuleType(mpSymTable, mpTypesFactory, moduleName);
+				}
+
+				/*!
+					\brief The method runs all stages of the compiler up to the code generation
+
+					\return The method returns nullptr if some of them has failed
+				*/
+
+				CASTSourceUnitNode* Analyze(const std::string& source, const std::string& moduleName)
+				{
+					CStringInputStream inputStream(source);
+
+					if (!SUCCESS(mpLexer->Init(&inputStream)))
+					{
+						return nullptr;
+					}
+
+					BeginModule(moduleName);
+
+					auto pSourceUnit = dynamic_cast<CASTSourceUnitNode*>(mpParser->Parse(mpLexer, mpSymTable, mpNodesFactory, mpTypesFactory, moduleName));
+
+					if (!pSourceUnit || !mpSemanticAnalyser->Analyze(pSourceUnit, mpTypeResolver, mpSymTable, mpNodesFactory) ||
+						!SUCCESS(mpConstantFolder->Fold(pSourceUnit, mpSymTable, mpInterpreter, mpNodesFactory)) ||
+						!SUCCESS(mpFunctionAttributesAnalyser->Analyze(pSourceUnit, mpSymTable)))
+					{
+						return nullptr;
+					}
+
+					return pSourceUnit;
+				}
+			public:
+				ILexer*                      mpLexer;
+
+				IParser*                     mpParser;
+
+				ISymTable*                   mpSymTable;
+
+				ISemanticAnalyser*           mpSemanticAnalyser;
+
+				IConstantFolder*             mpConstantFolder;
+
+				IFunctionAttributesAnalyser* mpFunctionAttributesAnalyser;
+
+				IASTNodesFactory*            mpNodesFactory;
+
+				ITypesFactory*               mpTypesFactory;
+
+				ITypeResolver*               mpTypeResolver;
+
+				IConstExprInterpreter*       mpInterpreter;
+
+				ICodeGenerator*              mpCodeGenerator;
+
+				IModuleResolver*             mpModuleResolver;
+		};
+
+
+		/*!
+			\brief A single module which is large enough for each stage to run for at least a few milliseconds
+		*/
+
+		std::string GenerateLargeModule()
+		{
+			TWorkloadDesc desc;
+
+			desc.mFunctionsPerModule = 96;
+			desc.mStatementsPerBlock = 3;
+			desc.mNestingDepth       = 4;
+			desc.mExpressionLength   = 8;
+			desc.mStructsPerModule   = 8;
+			desc.mVariantsPerModule  = 4;
+
+			return CWorkloadGenerator(desc).GenerateModule({});
+		}
+	}
+
+
+	void RegisterStagesBenchmarks(CBenchmarkRunner& runner)
+	{
+		// \note the source is shared by all benchmarks and generated on the first use
+		auto pSource = std::make_shared<std::string>();
+
+		auto getSource = [pSource]() -> const std::string&
+		{
+			if (pSource->empty())
+			{
+				*pSource = GenerateLargeModule();
+			}
+
+			return *pSource;
+		};
+
+		runner.AddBenchmark("lexer/large_module", [getSource](CBenchmarkContext& context)
+		{
+			CStringInputStream inputStream(getSource());
+
+			CLexer lexer;
+
+			U64 tokensCount = 0;
+
+			context.Measure([&inputStream, &lexer, &tokensCount]()
+			{
+				lexer.Init(&inputStream);
+
+				while (lexer.GetNextToken())
+				{
+					++tokensCount;
+				}
+			});
+
+			context.SetCounter("tokens", tokensCount);
+		});
+
+		runner.AddBenchmark("parser/large_module", [getSource](CBenchmarkContext& context)
+		{
+			CStringInputStream inputStream(getSource());
+
+			CModuleCompiler compiler;
+
+			compiler.mpLexer->Init(&inputStream);
+
+			std::vector<const CToken*> tokens;
+
+			// \note tokens are owned by the lexer, so it's kept alive until the end of the iteration
+			for (const CToken* pCurrToken = compiler.mpLexer->GetNextToken(); pCurrToken; pCurrToken = compiler.mpLexer->GetNextToken())
+			{
+				tokens.push_back(pCurrToken);
+			}
+
+			CReplayLexer replayLexer(tokens);
+
+			compiler.BeginModule("bench");
+
+			CASTNode* pSourceUnit = nullptr;
+
+			context.Measure([&compiler, &replayLexer, &pSourceUnit]()
+			{
+				pSourceUnit = compiler.mpParser->Parse(&replayLexer, compiler.mpSymTable, compiler.mpNodesFactory, compiler.mpTypesFactory, "bench");
+			});
+
+			if (!pSourceUnit)
+			{
+				context.SetError("the generated module isn't parsed");
+
+				return;
+			}
+
+			context.SetCounter("tokens", tokens.size());
+			context.SetCounter("top level statements", pSourceUnit->GetChildrenCount());
+		});
+
+		runner.AddBenchmark("symtable/lookup_nested_scopes", [](CBenchmarkContext& context)
+		{
+			constexpr U32 globalsCount   = 256;
+			constexpr U32 scopesCount    = 16;
+			constexpr U32 localsCount    = 16;
+			constexpr U32 lookupsCount   = 1 << 15;
+
+			CSymTable symTable;
+
+			CTypesFactory typesFactory;
+
+			CType* pInt32Type = typesFactory.CreateType(CT_INT32, BTS_INT32, 0x0);
+
+			std::vector<std::string> names;
+
+			for (U32 i = 0; i < globalsCount; ++i)
+			{
+				names.push_back(std::string("g").append(std::to_string(i)));
+
+				symTable.AddVariable({ names.back(), nullptr, pInt32Type });
+			}
+
+			// \note scopes of a function's body nested into a module's scope, as the analyser creates them for nested statements
+			symTable.CreateNamedScope("bench");
+
+			for (U32 i = 0; i < scopesCount; ++i)
+			{
+				symTable.CreateScope();
+
+				for (U32 j = 0; j < localsCount; ++j)
+				{
+					names.push_back(std::string("l").append(std::to_string(i)).append("_").append(std::to_string(j)));
+
+					symTable.AddVariable({ names.back(), nullptr, pInt32Type });
+				}
+			}
+
+			// \note a quarter of lookups are for symbols which don't exist, they walk all scopes up to the global one
+			for (U32 i = 0; i < names.size() / 3; ++i)
+			{
+				names.push_back(std::string("missing").append(std::to_string(i)));
+			}
+
+			U64 foundSymbolsCount = 0;
+
+			context.Measure([&symTable, &names, &foundSymbolsCount]()
+			{
+				for (U32 i = 0; i < lookupsCount; ++i)
+				{
+					foundSymbolsCount += symTable.LookUp(names[i % names.size()]) ? 1 : 0;
+				}
+			});
+
+			context.SetCounter("lookups", lookupsCount);
+			context.SetCounter("found symbols", foundSymbolsCount);
+		});
+
+		runner.AddBenchmark("type_resolver/long_expression", [](CBenchmarkContext& context)
+		{
+			constexpr U32 operandsCount = 2048;
+			constexpr U32 resolvesCount = 64;
+
+			CModuleCompiler compiler;
+
+			CType* pInt32Type = compiler.mpTypesFactory->CreateType(CT_INT32, BTS_INT32, 0x0);
+
+			compiler.mpSymTable->AddVariable({ "x", nullptr, pInt32Type });
+
+			// \note a left-leaning tree of additions, as the parser builds it, where identifiers are mixed with literals of different types
+			CASTExpressionNode* pExpr = compiler.mpNodesFactory->CreateUnaryExpr(TT_DEFAULT, compiler.mpNodesFactory->CreateIdNode("x"));
+
+			for (U32 i = 1; i < operandsCount; ++i)
+			{
+				CASTNode* pOperand = (i % 2) ? static_cast<CASTNode*>(compiler.mpNodesFactory->CreateIdNode("x")) :
+											   static_cast<CASTNode*>(compiler.mpNodesFactory->CreateLiteralNode(new CIntValue(i, (i % 8) == 0)));
+
+				pExpr = compiler.mpNodesFactory->CreateBinaryExpr(pExpr, TT_PLUS, compiler.mpNodesFactory->CreateUnaryExpr(TT_DEFAULT, pOperand));
+			}
+
+			CType* pResultType = nullptr;
+
+			context.Measure([&compiler, pExpr, &pResultType]()
+			{
+				for (U32 i = 0; i < resolvesCount; ++i)
+				{
+					pResultType = compiler.mpTypeResolver->Resolve(pExpr);
+				}
+			});
+
+			if (!pResultType || pResultType->GetType() != CT_INT64)
+			{
+				context.SetError("the expression's type isn't resolved");
+
+				return;
+			}
+
+			context.SetCounter("resolved nodes", static_cast<U64>(resolvesCount) * (3 * operandsCount - 1));
+		});
+
+		runner.AddBenchmark("codegen/large_module", [getSource](CBenchmarkContext& context)
+		{
+			CModuleCompiler compiler;
+
+			CASTSourceUnitNode* pSourceUnit = compiler.Analyze(getSource(), "bench");
+
+			if (!pSourceUnit)
+			{
+				context.SetError("the generated module isn't analysed");
+
+				return;
+			}
+
+			TLLVMIRData compiledModule;
+
+			context.Measure([&compiler, pSourceUnit, &compiledModule]()
+			{
+				compiledModule = compiler.mpCodeGenerator->Generate(pSourceUnit, compiler.mpSymTable, compiler.mpTypeResolver, compiler.mpInterpreter,
+																	[](ICodeGenerator* pCodeGenerator)
+				{
+					return RV_SUCCESS;
+				});
+			});
+
+			auto ppModule = std::get_if<llvm::Module*>(&compiledModule);
+
+			if (!ppModule || !*ppModule)
+			{
+				context.SetError("the generated module isn't compiled");
+
+				return;
+			}
+
+			U64 instructionsCount = 0;
+
+			for (const llvm::Function& currFunction : **ppModule)
+			{
+				instructionsCount += currFunction.getInstructionCount();
+			}
+
+			context.SetCounter("functions", (*ppModule)->size());
+			context.SetCounter("instructions", instructionsCount);
+
+			delete *ppModule;
+		});
+	}
+}
@@ -0,0 +1,284 @@
+#include "gplcWorkloadGenerator.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+
+namespace gplc
+{
+	CWorkloadGenerator::CWorkloadGenerator(const TWorkloadDesc& desc):
+		mDesc(desc)
+	{
+		mDesc.mFunctionsPerModule = std::max<U32>(1, mDesc.mFunctionsPerModule);
+		mDesc.mExpressionLength   = std::max<U32>(1, mDesc.mExpressionLength);
+
+		if (!mDesc.mModulesCount)
+		{
+			return;
+		}
+
+		const U32 layersCount = std::min(std::max<U32>(1, mDesc.mDiamondDepth), mDesc.mModulesCount);
+
+		// \note first layers get the remainder, so each layer isn't smaller than the next one and all its modules are imported
+		for (U32 i = 0; i < layersCount; ++i)
+		{
+			mLayersSizes.push_back(mDesc.mModulesCount / layersCount + ((i < mDesc.mModulesCount % layersCount) ? 1 : 0));
+		}
+	}
+
+	CWorkloadGenerator::TModulesArray CWorkloadGenerator::Generate() const
+	{
+		TModulesArray modules;
+
+		TStringsArray importedModules;
+
+		for (U32 i = 0; i < (mLayersSizes.empty() ? 0 : mLayersSizes.front()); ++i)
+		{
+			importedModules.push_back(_getModuleName(0, i));
+		}
+
+		modules.push_back({ GetMainModuleName(), _generateMainModule(importedModules) });
+
+		U32 seed = 1;
+
+		for (U32 currLayerIndex = 0; currLayerIndex < mLayersSizes.size(); ++currLayerIndex)
+		{
+			const bool isLastLayer = (currLayerIndex + 1 == mLayersSizes.size());
+
+			const U32 nextLayerSize = isLastLayer ? 0 : mLayersSizes[currLayerIndex + 1];
+
+			for (U32 currModuleIndex = 0; currModuleIndex < mLayersSizes[currLayerIndex]; ++currModuleIndex)
+			{
+				importedModules.clear();
+
+				for (U32 i = 0; i < std::min(mDesc.mImportsFanOut, nextLayerSize); ++i)
+				{
+					importedModules.push_back(_getModuleName(currLayerIndex + 1, (currModuleIndex + i) % nextLayerSize));
+				}
+
+				modules.push_back({ _getModuleName(currLayerIndex, currModuleIndex), GenerateModule(importedModules, seed++) });
+			}
+		}
+
+		return modules;
+	}
+
+	std::string CWorkloadGenerator::GenerateModule(const TStringsArray& importedModules, U32 seed) const
+	{
+		std::string output;
+
+		for (const std::string& currModuleName : importedModules)
+		{
+			output.append("import \"").append(currModuleName).append("\" as ").append(currModuleName).append("\n");
+		}
+
+		_generateTypes(output);
+
+		for (U32 i = 0; i < mDesc.mFunctionsPerModule; ++i)
+		{
+			_generateFunction(output, i, importedModules, seed);
+		}
+
+		return output;
+	}
+
+	TResult<std::string> CWorkloadGenerator::WriteToDirectory(const std::string& directory) const
+	{
+		std::error_code errorCode;
+
+		std::filesystem::create_directories(directory, errorCode);
+
+		if (errorCode)
+		{
+			return TErrorValue<E_RESULT_VALUE>(RV_FAIL);
+		}
+
+		for (const TModuleSource& currModule : Generate())
+		{
+			std::ofstream moduleFile(std::filesystem::path(directory) / (currModule.mName + ".gpls"), std::ios::binary | std::ios::trunc);
+
+			if (!moduleFile.is_open() || !(moduleFile << currModule.mSource))
+			{
+				return TErrorValue<E_RESULT_VALUE>(RV_FAIL);
+			}
+		}
+
+		return TOkValue<std::string>((std::filesystem::path(directory) / (std::string(GetMainModuleName()) + ".gpls")).string());
+	}
+
+	const C8* CWorkloadGenerator::GetMainModuleName()
+	{
+		return "main";
+	}
+
+	std::string CWorkloadGenerator::_generateMainModule(const TStringsArray& importedModules) const
+	{
+		// \note a program without modules is a single file of the specified size
+		if (importedModules.empty())
+		{
+			return GenerateModule({}).append("main := () -> int32 {\n\treturn f0(1, 2);\n};\n");
+		}
+
+		std::string output;
+
+		for (const std::string& currModuleName : importedModules)
+		{
+			output.append("import \"").append(currModuleName).append("\" as ").append(currModuleName).append("\n");
+		}
+
+		output.append("main := () -> int32 {\n\treturn ");
+
+		for (U32 i = 0; i < importedModules.size(); ++i)
+		{
+			output.append(i ? " + " : "").append(importedModules[i]).append(".f0(1, 2)");
+		}
+
+		return output.append(";\n};\n");
+	}
+
+	void CWorkloadGenerator::_generateTypes(std::string& output) const
+	{
+		for (U32 i = 0; i < mDesc.mStructsPerModule; ++i)
+		{
+			output.append("struct S").append(std::to_string(i)).append(" {\n\tx: int32;\n\ty: float;\n");
+
+			// \note each structure contains the previous one, so types of fields are resolved recursively
+			if (i)
+			{
+				output.append("\tinner: S").append(std::to_string(i - 1)).append(";\n");
+			}
+
+			output.append("}\n");
+		}
+
+		for (U32 i = 0; i < mDesc.mVariantsPerModule; ++i)
+		{
+			output.append("variant V").append(std::to_string(i)).append(" {\n\tint32,\n\tfloat,\n\tbool\n}\n");
+		}
+	}
+
+	void CWorkloadGenerator::_generateFunction(std::string& output, U32 functionIndex, const TStringsArray& importedModules, U32& seed) const
+	{
+		output.append("f").append(std::to_string(functionIndex)).append(" := (a : int32, b : int32) -> int32 {\n\tr : int32 = ");
+
+		_generateExpression(output, false, seed);
+
+		output.append(";\n");
+
+		if (mDesc.mStructsPerModule)
+		{
+			output.append("\ts : S").append(std::to_string(functionIndex % mDesc.mStructsPerModule)).append(";\n\ts.x = ");
+
+			_generateExpression(output, true, seed);
+
+			output.append(";\n");
+		}
+
+		if (mDesc.mVariantsPerModule)
+		{
+			output.append("\tv : V").append(std::to_string(functionIndex % mDesc.mVariantsPerModule)).append(";\n");
+		}
+
+		_generateBlock(output, 1, seed);
+
+		output.append("\treturn r");
+
+		if (mDesc.mStructsPerModule)
+		{
+			output.append(" + s.x");
+		}
+
+		if (functionIndex)
+		{
+			output.append(" + f").append(std::to_string(functionIndex - 1)).append("(b, a)");
+		}
+		else
+		{
+			for (const std::string& currModuleName : importedModules)
+			{
+				output.append(" + ").append(currModuleName).append(".f0(a, r)");
+			}
+		}
+
+		output.append(";\n};\n");
+	}
+
+	void CWorkloadGenerator::_generateBlock(std::string& output, U32 level, U32& seed) const
+	{
+		const std::string indent(level, '\t');
+
+		for (U32 i = 0; i < mDesc.mStatementsPerBlock; ++i)
+		{
+			output.append(indent).append("r = ");
+
+			_generateExpression(output, true, seed);
+
+			output.append(";\n");
+		}
+
+		if (level > mDesc.mNestingDepth)
+		{
+			return;
+		}
+
+		// \note only a single branch of each statement is nested, so size of a function grows linearly with the depth
+		if (level % 2)
+		{
+			output.append(indent).append("if r > ").append(std::to_string(_nextRandom(seed) % 100)).append(" {\n");
+
+			_generateBlock(output, level + 1, seed);
+
+			output.append(indent).append("} else {\n").append(indent).append("\tr = r - 1;\n").append(indent).append("}\n");
+
+			return;
+		}
+
+		output.append(indent).append("while r < ").append(std::to_string(_nextRandom(seed) % 100)).append(" {\n");
+
+		_generateBlock(output, level + 1, seed);
+
+		output.append(indent).append("}\n");
+	}
+
+	void CWorkloadGenerator::_generateExpression(std::string& output, bool isResultDeclared, U32& seed) const
+	{
+		static const C8* operators[] = { " + ", " - ", " + ", " * " };
+
+		for (U32 i = 0; i < mDesc.mExpressionLength; ++i)
+		{
+			if (i)
+			{
+				output.append(operators[_nextRandom(seed) % 4]);
+			}
+
+			switch (_nextRandom(seed) % (isResultDeclared ? 4 : 3))
+			{
+				case 0:
+					output.append("a");
+					break;
+				case 1:
+					output.append("b");
+					break;
+				case 2:
+					output.append(std::to_string(1 + _nextRandom(seed) % 99));
+					break;
+				default:
+					output.append("r");
+					break;
+			}
+		}
+	}
+
+	U32 CWorkloadGenerator::_nextRandom(U32& seed)
+	{
+		// \note a linear congruential generator keeps the output the same on all platforms unlike std::rand
+		seed = seed * 1664525u + 1013904223u;
+
+		return seed >> 16;
+	}
+
+	std::string CWorkloadGenerator::_getModuleName(U32 layerIndex, U32 moduleIndex)
+	{
+		return std::string("m").append(std::to_string(layerIndex)).append("_").append(std::to_string(moduleIndex));
+	}
+}
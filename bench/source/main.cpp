@@ -0,0 +1,133 @@
+#include "gplcBenchmarks.h"
+#include "gplcWorkloadGenerator.h"
+#include <argparse.h>
+#include <algorithm>
+#include <iostream>
+
+
+using namespace gplc;
+
+
+static const C8* Usage[] =
+{
+	"gplc_bench [options]",
+	0
+};
+
+
+int main(int argc, const char** argv)
+{
+	const C8* pFilter           = "";
+	const C8* pBaselineFile     = nullptr;
+	const C8* pSaveBaselineFile = nullptr;
+	const C8* pGenerateDir      = nullptr;
+
+	I32 iterationsCount = 5;
+	I32 tolerance       = 10;
+	I32 isTimeChecked   = 0;
+
+	TWorkloadDesc desc;
+
+	I32 modulesCount       = desc.mModulesCount;
+	I32 diamondDepth       = desc.mDiamondDepth;
+	I32 importsFanOut      = desc.mImportsFanOut;
+	I32 functionsPerModule = desc.mFunctionsPerModule;
+	I32 statementsPerBlock = desc.mStatementsPerBlock;
+	I32 nestingDepth       = desc.mNestingDepth;
+	I32 expressionLength   = desc.mExpressionLength;
+	I32 structsPerModule   = desc.mStructsPerModule;
+	I32 variantsPerModule  = desc.mVariantsPerModule;
+
+	struct argparse_option options[] = {
+		OPT_HELP(),
+		OPT_GROUP("Benchmarks options"),
+		OPT_STRING('f', "filter", &pFilter, "Run only benchmarks whose names contain the specified <string>"),
+		OPT_INTEGER('i', "iterations", &iterationsCount, "Specify number of measured iterations of each benchmark"),
+		OPT_STRING('b', "baseline", &pBaselineFile, "Compare results with the baseline which is stored in the specified <filename>"),
+		OPT_STRING('s', "save-baseline", &pSaveBaselineFile, "Write results into the specified <filename> as a new baseline"),
+		OPT_INTEGER('t', "tolerance", &tolerance, "Specify a difference of time with the baseline in percents which isn't considered as a regression"),
+		OPT_BOOLEAN('T', "check-time", &isTimeChecked, "Fail if time exceeds the baseline's one, by default only counters are checked up"),
+		OPT_GROUP("Generator options"),
+		OPT_STRING('g', "generate", &pGenerateDir, "Write a program which is described by the options below into the specified <directory> and exit"),
+		OPT_INTEGER(0, "modules", &modulesCount, "Number of modules besides the main one"),
+		OPT_INTEGER(0, "diamond-depth", &diamondDepth, "Number of layers of modules, a module imports modules of the next layer"),
+		OPT_INTEGER(0, "fan-out", &importsFanOut, "Number of modules which are imported by each module"),
+		OPT_INTEGER(0, "functions", &functionsPerModule, "Number of functions within each module"),
+		OPT_INTEGER(0, "statements", &statementsPerBlock, "Number of statements within each block"),
+		OPT_INTEGER(0, "nesting-depth", &nestingDepth, "Number of nested if and while statements within each function"),
+		OPT_INTEGER(0, "expression-length", &expressionLength, "Number of operands of each expression"),
+		OPT_INTEGER(0, "structs", &structsPerModule, "Number of structures within each module"),
+		OPT_INTEGER(0, "variants", &variantsPerModule, "Number of variants within each module"),
+		OPT_END(),
+	};
+
+	struct argparse argparse;
+	argparse_init(&argparse, options, Usage, 0);
+	argparse_describe(&argparse, "\nThe utility runs benchmarks of gplc and compares them with a stored baseline", "\n");
+	argc = argparse_parse(&argparse, argc, argv);
+
+	if (pGenerateDir)
+	{
+		desc.mModulesCount       = static_cast<U32>(std::max(0, modulesCount));
+		desc.mDiamondDepth       = static_cast<U32>(std::max(1, diamondDepth));
+		desc.mImportsFanOut      = static_cast<U32>(std::max(0, importsFanOut));
+		desc.mFunctionsPerModule = static_cast<U32>(std::max(1, functionsPerModule));
+		desc.mStatementsPerBlock = static_cast<U32>(std::max(0, statementsPerBlock));
+		desc.mNestingDepth       = static_cast<U32>(std::max(0, nestingDepth));
+		desc.mExpressionLength   = static_cast<U32>(std::max(1, expressionLength));
+		desc.mStructsPerModule   = static_cast<U32>(std::max(0, structsPerModule));
+		desc.mVariantsPerModule  = static_cast<U32>(std::max(0, variantsPerModule));
+
+		auto mainFilename = CWorkloadGenerator(desc).WriteToDirectory(pGenerateDir);
+
+		if (!mainFilename.IsOk())
+		{
+			std::cout << "Error: the program isn't written into " << pGenerateDir << std::endl;
+
+			return RV_FAIL;
+		}
+
+		std::cout << "The program is written, its main module is " << mainFilename.Get() << std::endl;
+
+		return RV_SUCCESS;
+	}
+
+	CBenchmarkRunner::TResultsMap baseline;
+
+	if (pBaselineFile)
+	{
+		auto loadedBaseline = CBenchmarkRunner::LoadBaseline(pBaselineFile);
+
+		if (!loadedBaseline.IsOk())
+		{
+			std::cout << "Error: the baseline isn't loaded from " << pBaselineFile << std::endl;
+
+			return RV_FAIL;
+		}
+
+		baseline = loadedBaseline.Get();
+	}
+
+	CBenchmarkRunner runner;
+
+	RegisterStagesBenchmarks(runner);
+	RegisterCompileBenchmarks(runner);
+
+	CBenchmarkRunner::TResultsMap results;
+
+	Result result = runner.Run(pFilter, static_cast<U32>(std::max(1, iterationsCount)), results);
+
+	if (!SUCCESS(CBenchmarkRunner::CompareWithBaseline(results, baseline, static_cast<F64>(std::max(0, tolerance)), isTimeChecked != 0)))
+	{
+		result = RV_FAIL;
+	}
+
+	if (pSaveBaselineFile && !SUCCESS(CBenchmarkRunner::SaveBaseline(pSaveBaselineFile, results)))
+	{
+		std::cout << "Error: the baseline isn't saved into " << pSaveBaselineFile << std::endl;
+
+		result = RV_FAIL;
+	}
+
+	return result;
+}
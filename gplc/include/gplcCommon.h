@@ -60,6 +60,26 @@ namespace gplc
 		E_EMIT_FLAGS mEmitFlag          = E_EMIT_FLAGS::EF_NONE;
 
 		U8           mOptimizationLevel = 0;
+
+		U32          mCodeGenFlags      = 0x0; ///< \note A combination of E_CODE_GENERATOR_FLAGS
+
+		std::string  mCacheDirectory;             ///< \note The build cache is disabled if the string is empty
+
+		U32          mCacheSizeLimit    = 1024;   ///< \note The limit is specified in megabytes
+
+		std::string  mServerSocketPath;           ///< \note The compiler runs as a server listening on the socket if the string isn't empty
+
+		std::string  mConnectSocketPath;          ///< \note The command line is forwarded to a server listening on the socket if the string isn't empty
+
+		bool         mIsWatchModeEnabled = false; ///< \note The compiler rebuilds the program each time when its sources are changed
+
+		bool         mIsTimeReportEnabled = false; ///< \note The compiler prints time and memory which are spent by its phases
+
+		std::string  mTimeReportFilename;          ///< \note The time report is written into the file in JSON format if the string isn't empty
+
+		std::string  mTraceFilename;               ///< \note Phases are written into the file as Chrome's trace events if the string isn't empty
+
+		bool         mIsStatisticsEnabled = false; ///< \note The compiler prints counters of its subsystems, see CStatistics
 	} TCompilerOptions, *TCompilerOptionsPtr;
 
 
@@ -72,5 +92,9 @@ namespace gplc
 	}
 
 
+	/*!
+		\brief The function registers all LLVM's targets, it does nothing if they are already registered within the process
+	*/
+
 	Result InitLLVMInfrastructure();
 }
\ No newline at end of file
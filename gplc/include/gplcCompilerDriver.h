@@ -15,6 +15,7 @@
 #include <gplc.h>
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 
 namespace gplc
@@ -28,6 +29,12 @@ namespace gplc
 			virtual Result Free() = 0;
 
 			virtual Result Run(const TStringsArray& inputFiles) = 0;
+
+			/*!
+				\brief The method returns full paths of input files of the last run and all modules which are imported by them
+			*/
+
+			virtual TStringsArray GetSourceFiles() const = 0;
 		protected:
 			ICompilerDriver() = default;
 			ICompilerDriver(const ICompilerDriver&) = delete;
@@ -44,6 +51,8 @@ namespace gplc
 			Result Free() override;
 
 			Result Run(const TStringsArray& inputFiles) override;
+
+			TStringsArray GetSourceFiles() const override;
 		protected:
 			CCompilerDriver() = default;
 			CCompilerDriver(const CCompilerDriver&) = delete;
@@ -57,11 +66,36 @@ namespace gplc
 
 			Result _compileSeparateFile(const std::string& filename, const std::string& moduleName, TLLVMIRData& compiledModuleData);
 
+			/*!
+				\brief The method takes a code of a module whose interface is up to date from the build cache
+			*/
+
+			Result _loadCompiledModule(const std::string& moduleName, const TModuleInterfaceInfo& interfaceInfo, TLLVMIRData& compiledModuleData);
+
 			std::string _getCurrentWorkingDirectory(const TStringsArray& inputFiles) const;
 
+			/*!
+				\brief The method computes a key of the module's entry within the build cache, all modules which are
+				imported by the module should be resolved before
+			*/
+
+			std::string _computeModuleCacheKey(const std::string& filename, CASTSourceUnitNode* pSourceAST) const;
+
+			/*!
+				\return The method returns a string of the compiler's options which change a code of modules
+			*/
+
+			std::string _getBuildOptionsString() const;
+
 			void _outputCompilationUnit(const std::string& filename, llvm::Module& module) const;
 
 			void _initLLVMInfrastructure() const;
+
+			/*!
+				\brief The method prints the time report and writes it into files in JSON and trace event formats if they're specified within the options
+			*/
+
+			void _outputTimeReport() const;
 		protected:
 			bool                   mIsInitialized;
 
@@ -73,6 +107,10 @@ namespace gplc
 
 			ISemanticAnalyser*     mpSemanticAnalyser;
 
+			IConstantFolder*       mpConstantFolder;
+
+			IFunctionAttributesAnalyser* mpFunctionAttributesAnalyser;
+
 			IASTNodesFactory*      mpASTNodesFactory;
 
 			ITypeResolver*         mpTypeResolver;
@@ -87,9 +125,15 @@ namespace gplc
 
 			INativeModules*        mpNativeModules;
 
+			IBuildCache*           mpBuildCache;
+
+			ITimeReport*           mpTimeReport;
+
 			bool                   mIsPanicModeEnabled;
 
 			TCompilerOptions       mCompilerOptions;
+
+			TStringsArray          mInputFiles;
 	};
 
 
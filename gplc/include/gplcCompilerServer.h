@@ -0,0 +1,111 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains definition of a compiler's server which keeps LLVM's infrastructure warm
+	between invocations of the compiler. A client forwards its command line through a local Unix socket,
+	the server compiles it within a child process and streams the output back
+
+	\todo
+*/
+#pragma once
+
+
+#include "gplcCommon.h"
+#include <gplc.h>
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+
+namespace gplc
+{
+	class ICompilerServer
+	{
+		public:
+			typedef std::vector<std::string> TStringsArray;
+		public:
+			virtual Result Init(const TCompilerOptions& options) = 0;
+			virtual Result Free() = 0;
+
+			/*!
+				\brief The method serves requests until the process receives SIGINT or SIGTERM
+			*/
+
+			virtual Result Run() = 0;
+		protected:
+			ICompilerServer() = default;
+			ICompilerServer(const ICompilerServer&) = delete;
+			virtual ~ICompilerServer() = default;
+	};
+
+
+	/*!
+		\brief The server forks a worker per request after the infrastructure is initialized, so workers
+		share warm state of the server without copying it, and a failure of one build (even a panic) can't
+		break the server or other builds which run concurrently
+
+		A request is a working directory of a client followed by its command line, each string is prefixed with
+		its length. A response is an output of the compiler followed by a trailer with its exit code
+	*/
+
+	class CCompilerServer: public ICompilerServer
+	{
+		public:
+			friend TResult<ICompilerServer*> CreateCompilerServer(const TCompilerOptions&);
+			friend TResult<I32> ForwardCommandLine(const std::string&, const TStringsArray&);
+		protected:
+			typedef std::unordered_map<I32, I32> TWorkersTable; ///< \note A worker's process identifier is mapped onto its client's socket
+		public:
+			Result Init(const TCompilerOptions& options) override;
+			Result Free() override;
+
+			Result Run() override;
+		protected:
+			CCompilerServer() = default;
+			CCompilerServer(const CCompilerServer&) = delete;
+			virtual ~CCompilerServer() = default;
+
+			/*!
+				\brief The method is executed within a worker's process, its standard output is redirected into the client's socket
+
+				\return The method returns an exit code of the compiler
+			*/
+
+			I32 _processRequest(I32 clientSocket) const;
+
+			/*!
+				\brief The method sends trailers to clients whose workers are finished and closes their sockets
+
+				\param[in] waitForAll The method blocks until all running workers are finished if the flag is true
+			*/
+
+			void _collectFinishedWorkers(bool waitForAll = false);
+		protected:
+			static const U32       mTrailerSignature;
+
+			static const U32       mMaxRequestStringLength;
+
+			bool                   mIsInitialized = false;
+
+			I32                    mListeningSocket = -1;
+
+			TWorkersTable          mWorkers;
+
+			TCompilerOptions       mCompilerOptions;
+	};
+
+
+	TResult<ICompilerServer*> CreateCompilerServer(const TCompilerOptions&);
+
+
+	/*!
+		\brief The function sends a command line to a server listening on the socket and prints the server's output
+
+		\return The function returns an exit code of the compiler or an error if the server isn't available, the command
+		line should be compiled locally then
+	*/
+
+	TResult<I32> ForwardCommandLine(const std::string& socketPath, const ICompilerServer::TStringsArray& commandLine);
+}
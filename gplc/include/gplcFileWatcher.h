@@ -0,0 +1,99 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains definition of a watcher which notifies the compiler about changes of source files
+	in watch mode
+
+	\todo
+*/
+#pragma once
+
+
+#include <gplc.h>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+
+namespace gplc
+{
+	class IFileWatcher
+	{
+		public:
+			typedef std::vector<std::string> TStringsArray;
+		public:
+			virtual Result Init() = 0;
+			virtual Result Free() = 0;
+
+			/*!
+				\brief The method replaces the set of watched files, their directories are watched instead of files themselves,
+				because editors often save a file writing a new one and renaming it over the old one
+
+				\param[in] filenames An array of full paths of files
+			*/
+
+			virtual Result Watch(const TStringsArray& filenames) = 0;
+
+			/*!
+				\brief The method blocks until some of watched files are changed
+
+				\param[out] changedFiles An array of full paths of changed files, it contains each file once
+
+				\return The method returns RV_FAIL if the process was interrupted while it waited for changes
+			*/
+
+			virtual Result WaitForChanges(TStringsArray& changedFiles) = 0;
+		protected:
+			IFileWatcher() = default;
+			IFileWatcher(const IFileWatcher&) = delete;
+			virtual ~IFileWatcher() = default;
+	};
+
+
+	/*!
+		\brief The implementation is based on inotify, so it's available on Linux only
+	*/
+
+	class CFileWatcher: public IFileWatcher
+	{
+		public:
+			friend TResult<IFileWatcher*> CreateFileWatcher();
+		protected:
+			typedef std::unordered_map<I32, std::string> TWatchedDirectoriesTable; ///< \note A watch descriptor is mapped onto a path of the directory
+		public:
+			Result Init() override;
+			Result Free() override;
+
+			Result Watch(const TStringsArray& filenames) override;
+
+			Result WaitForChanges(TStringsArray& changedFiles) override;
+		protected:
+			CFileWatcher() = default;
+			CFileWatcher(const CFileWatcher&) = delete;
+			virtual ~CFileWatcher() = default;
+
+			/*!
+				\brief The method reads all pending events and appends watched files which are changed by them
+
+				\return The method returns false if there were no events within the timeout
+			*/
+
+			bool _readEvents(I32 timeout, std::unordered_set<std::string>& changedFiles);
+		protected:
+			static const I32         mDebounceTimeout;
+
+			bool                     mIsInitialized = false;
+
+			I32                      mInotifyHandle = -1;
+
+			TWatchedDirectoriesTable mWatchedDirectories;
+
+			std::unordered_set<std::string> mWatchedFiles;
+	};
+
+
+	TResult<IFileWatcher*> CreateFileWatcher();
+}
@@ -1,7 +1,9 @@
 #include "gplcCommon.h"
 #include "argparse.h"
+#include "llvm/Support/TargetSelect.h"
 #include <iostream>
 #include <filesystem>
+#include <mutex>
 
 
 namespace gplc
@@ -11,10 +13,19 @@ namespace gplc
 		TCompilerOptions compilerOptions{};
 		
 		I32 showVersion = 0;
+		I32 disableBoundsChecks = 0;
+		I32 watchSources = 0;
+		I32 showTimeReport = 0;
+		I32 showStatistics = 0;
 
 		const C8* pPrintArg    = nullptr;
 		const C8* pOutFilename = nullptr;
 		const C8* pEmitArg     = nullptr;
+		const C8* pCacheDir    = nullptr;
+		const C8* pServerSocket  = nullptr;
+		const C8* pConnectSocket = nullptr;
+		const C8* pTimeReportFile = nullptr;
+		const C8* pTraceFile      = nullptr;
 
 		struct argparse_option options[] = {
 			OPT_HELP(),
@@ -24,6 +35,21 @@ namespace gplc
 			OPT_STRING('o', "out", &pOutFilename, "Write output into specified <filename>"),
 			OPT_STRING('E', "emit", &pEmitArg, "[llvm-ir|llvm-bc|asm] Emit intermediate representation in one of specified type"),
 			OPT_INTEGER('O', "opt-level", &compilerOptions.mOptimizationLevel, "Specify optimization level"),
+			OPT_GROUP("Code generation options"),
+			OPT_BOOLEAN(0, "no-bounds-checks", &disableBoundsChecks, "Don't check up indices of arrays in runtime, the same as @unchecked for all functions"),
+			OPT_GROUP("Diagnostics options"),
+			OPT_BOOLEAN(0, "time-report", &showTimeReport, "Print wall time, CPU time, the process's peak memory usage and its growth of each phase of each module"),
+			OPT_STRING(0, "time-report-json", &pTimeReportFile, "Write the time report into the specified <filename> in JSON format"),
+			OPT_STRING(0, "trace-out", &pTraceFile, "Write phases of all modules into the specified <filename> as trace events for chrome://tracing or Perfetto"),
+			OPT_BOOLEAN(0, "stats", &showStatistics, "Print counters of tokens, AST nodes, types, symbol lookups, IR instructions and linked modules"),
+			OPT_GROUP("Build cache options"),
+			OPT_STRING(0, "cache-dir", &pCacheDir, "Load unchanged modules from the specified <directory> instead of recompiling them"),
+			OPT_INTEGER(0, "cache-size", &compilerOptions.mCacheSizeLimit, "Limit the cache's size in megabytes, the least recently used modules are evicted"),
+			OPT_GROUP("Watch options"),
+			OPT_BOOLEAN('w', "watch", &watchSources, "Keep running and rebuild the program when its sources or imported modules are changed"),
+			OPT_GROUP("Server options"),
+			OPT_STRING(0, "server", &pServerSocket, "Run as a server which compiles command lines received through the Unix <socket>"),
+			OPT_STRING(0, "connect", &pConnectSocket, "Forward the command line to a server listening on the <socket>, it's compiled locally if there is no server"),
 			OPT_END(),
 		};
 
@@ -42,9 +68,15 @@ namespace gplc
 		// \note parse input files before any option, because argparse library will remove all argv's values after it processes that
 		compilerOptions.mInputFilename = argc < 1 ? compilerOptions.mInputFilename : argparse.out[0];
 
-		if (compilerOptions.mInputFilename.empty())
+		compilerOptions.mServerSocketPath  = pServerSocket ? pServerSocket : "";
+		compilerOptions.mConnectSocketPath = pConnectSocket ? pConnectSocket : "";
+
+		// \note the server receives input files with requests of its clients
+		if (compilerOptions.mInputFilename.empty() && compilerOptions.mServerSocketPath.empty())
 		{
-			Panic(GetRedConsoleText("Error:").append(" no input file's found")); // causes termination of the utility
+			std::cerr << GetRedConsoleText("Error:").append(" no input file's found") << std::endl;
+
+			return TErrorValue<E_RESULT_VALUE>(RV_INVALID_ARGUMENTS);
 		}
 
 		compilerOptions.mOutputFilename = pOutFilename ? std::filesystem::path(pOutFilename).replace_extension().string() : ""; // store output filename without extension
@@ -61,9 +93,42 @@ namespace gplc
 
 		compilerOptions.mOptimizationLevel = std::min<U8>(3, std::max<U8>(0, compilerOptions.mOptimizationLevel)); // in range of [0; 3]
 
+		compilerOptions.mCodeGenFlags = disableBoundsChecks ? CGF_DISABLE_BOUNDS_CHECKS : 0x0;
+
+		compilerOptions.mCacheDirectory = pCacheDir ? pCacheDir : "";
+
+		compilerOptions.mIsWatchModeEnabled = static_cast<bool>(watchSources);
+
+		compilerOptions.mIsTimeReportEnabled = static_cast<bool>(showTimeReport);
+		compilerOptions.mTimeReportFilename  = pTimeReportFile ? pTimeReportFile : "";
+		compilerOptions.mTraceFilename       = pTraceFile ? pTraceFile : "";
+		compilerOptions.mIsStatisticsEnabled = static_cast<bool>(showStatistics);
+
+		// \note rebuilds in watch mode rely on the cache to skip unchanged modules, so it's enabled even if it isn't specified
+		if (compilerOptions.mIsWatchModeEnabled && compilerOptions.mCacheDirectory.empty())
+		{
+			compilerOptions.mCacheDirectory = (std::filesystem::path(compilerOptions.mInputFilename).parent_path() / ".gplc_cache").string();
+		}
+
 		return TOkValue<TCompilerOptions>(compilerOptions);
 	}
 
+	Result InitLLVMInfrastructure()
+	{
+		static std::once_flag isInfrastructureInitialized;
+
+		std::call_once(isInfrastructureInitialized, []()
+		{
+			llvm::InitializeAllTargetInfos();
+			llvm::InitializeAllTargets();
+			llvm::InitializeAllTargetMCs();
+			llvm::InitializeAllAsmParsers();
+			llvm::InitializeAllAsmPrinters();
+		});
+
+		return RV_SUCCESS;
+	}
+
 	std::string EmitFlagsToExtensionString(E_EMIT_FLAGS flag)
 	{
 		switch (flag)
@@ -10,8 +10,13 @@
 #include "llvm/Target/TargetOptions.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/IR/LegacyPassManager.h"
+#include "llvm/Support/Host.h"
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include <filesystem>
+#include <functional>
+#include <unordered_set>
 
 
 namespace gplc
@@ -33,22 +38,61 @@ namespace gplc
 		mpParser               = new CParser();
 		mpSymTable             = new CSymTable();
 		mpSemanticAnalyser     = new CSemanticAnalyser();
+		mpConstantFolder       = new CConstantFolder();
+		mpFunctionAttributesAnalyser = new CFunctionAttributesAnalyser();
 		mpASTNodesFactory      = new CASTNodesFactory();
 		mpTypeResolver         = new CTypeResolver();
 		mpConstExprInterpreter = new CConstExprInterpreter();
 		mpCodeGenerator        = new CLLVMCodeGenerator();
 		mpModuleResolver       = new CModuleResolver();
-		mpTypesFactory         = new CTypesFactory();
+		mpTypesFactory         = new CTypesFactory(GetHostTargetAlignments()); // \note the target should be known before semantic analysis, because it computes sizes of types
 		mpNativeModules        = new CLLVMNativeModules();
+		mpBuildCache           = nullptr;
+		mpTimeReport           = nullptr;
+
+		if (mCompilerOptions.mIsTimeReportEnabled || !mCompilerOptions.mTimeReportFilename.empty() || !mCompilerOptions.mTraceFilename.empty())
+		{
+			mpTimeReport = new CTimeReport("gplc");
+		}
+
+		// \note counters are global, so they're reset for each driver to report a single build in watch mode
+		CStatistics::Reset();
+		CStatistics::SetEnabled(mCompilerOptions.mIsStatisticsEnabled);
 
 		if (!SUCCESS(result = mpTypeResolver->Init(mpSymTable, mpConstExprInterpreter, mpTypesFactory)))
 		{
 			return result;
 		}
 
+		if (!SUCCESS(result = mpConstExprInterpreter->Init(mpTypeResolver)))
+		{
+			return result;
+		}
+
+		if (!SUCCESS(result = mpCodeGenerator->SetFlags(mCompilerOptions.mCodeGenFlags)))
+		{
+			return result;
+		}
+
+		if (!mCompilerOptions.mCacheDirectory.empty())
+		{
+			mpBuildCache = new CBuildCache();
+
+			// \note the compiler still works without the cache, it just recompiles all modules
+			if (!SUCCESS(mpBuildCache->Init(mCompilerOptions.mCacheDirectory, static_cast<U64>(mCompilerOptions.mCacheSizeLimit) << 20)))
+			{
+				std::cout << "Warning: the build cache's directory (" << mCompilerOptions.mCacheDirectory << ") is unavailable" << std::endl;
+
+				delete mpBuildCache;
+
+				mpBuildCache = nullptr;
+			}
+		}
+
 		mpLexer->OnErrorOutput            += MakeMethodDelegate(this, &CCompilerDriver::_onLexerStageError);
 		mpParser->OnErrorOutput           += MakeMethodDelegate(this, &CCompilerDriver::_onParserStageError);
 		mpSemanticAnalyser->OnErrorOutput += MakeMethodDelegate(this, &CCompilerDriver::_onSemanticAnalyserStageError);
+		mpConstExprInterpreter->OnErrorOutput += MakeMethodDelegate(this, &CCompilerDriver::_onSemanticAnalyserStageError);
 
 		//if (!SUCCESS(result = mpNativeModules->InitModules(mpSymTable, mpASTNodesFactory, mpTypesFactory)))
 		//{
@@ -71,6 +115,15 @@ namespace gplc
 			return RV_FAIL;
 		}
 
+		_outputTimeReport();
+
+		if (mCompilerOptions.mIsStatisticsEnabled)
+		{
+			std::cout << CStatistics::ToString();
+		}
+
+		delete mpTimeReport;
+		delete mpBuildCache;
 		delete mpNativeModules;
 		delete mpTypesFactory;
 		delete mpModuleResolver;
@@ -78,6 +131,8 @@ namespace gplc
 		delete mpParser;
 		delete mpSymTable;
 		delete mpSemanticAnalyser;
+		delete mpConstantFolder;
+		delete mpFunctionAttributesAnalyser;
 		delete mpASTNodesFactory;
 		delete mpTypeResolver;
 		delete mpConstExprInterpreter;
@@ -104,15 +159,19 @@ namespace gplc
 
 		Result result = RV_SUCCESS;
 
+		mInputFiles = inputFiles;
+
 		TLLVMIRData compiledProgram;
 
 		// extract directory with which we will associate current working directory
 		std::string currentWorkingDirectory = _getCurrentWorkingDirectory(inputFiles);
 
+		std::string mainModuleName;
+
+		mIsPanicModeEnabled = false;
+
 		for (auto currFilename : inputFiles)
 		{
-			mIsPanicModeEnabled = false;
-
 			// check whether the specified file exist
 			if (!std::filesystem::exists(currFilename))
 			{
@@ -128,11 +187,38 @@ namespace gplc
 
 			mpSymTable->CreateNamedScope(moduleName);
 
-			if (!SUCCESS(result = _compileSeparateFile(currFilename, moduleName, compiledProgram)))
+			bool isModuleLoaded = false;
+
+			// \note a module whose source and imports' interfaces aren't changed since the last build isn't parsed at all
+			if (mpBuildCache)
 			{
-				mpSymTable->LeaveScope();
+				CTimeReportScope interfaceLoadingPhase(mpTimeReport, std::string(moduleName).append(" (Interface)"));
+
+				isModuleLoaded = SUCCESS(mpModuleResolver->ResolveFromInterface(mpSymTable, mpTypesFactory, mpASTNodesFactory, std::filesystem::current_path().string(), 
+																				currFilename, moduleName,
+																				std::bind(&CCompilerDriver::_compileSeparateFile, this,
+																						  std::placeholders::_1,
+																						  std::placeholders::_2,
+																						  std::placeholders::_3),
+																				std::bind(&CCompilerDriver::_loadCompiledModule, this,
+																						  std::placeholders::_1,
+																						  std::placeholders::_2,
+																						  std::placeholders::_3)));
+			}
 
-				return result;
+			if (!isModuleLoaded)
+			{
+				if (!SUCCESS(result = _compileSeparateFile(currFilename, moduleName, compiledProgram)))
+				{
+					mpSymTable->LeaveScope();
+
+					return result;
+				}
+
+				if (!mIsPanicModeEnabled)
+				{
+					mpModuleResolver->GetModuleEntry(moduleName).mCompiledIRCode = std::move(compiledProgram);
+				}
 			}
 
 			mpSymTable->LeaveScope();
@@ -142,29 +228,46 @@ namespace gplc
 				return RV_FAIL;
 			}
 
-			mpModuleResolver->GetModuleEntry(moduleName).mCompiledIRCode = std::move(compiledProgram);
+			if (mainModuleName.empty())
+			{
+				mainModuleName = moduleName;
+			}
+		}
 
-			auto pLinker = new CLLVMLinker();
+		if (mIsPanicModeEnabled || mainModuleName.empty())
+		{
+			return RV_FAIL;
+		}
 
-			// \todo Implement proper way to append extension for an output file
-			mCompilerOptions.mOutputFilename.append(".exe");
+		// \note all input files are linked into the main module once, after they all are compiled
+		auto pLinker = new CLLVMLinker(mpTimeReport);
 
-			if (!SUCCESS(result = mpModuleResolver->Link(mCompilerOptions.mOutputFilename, pLinker, mCompilerOptions.mEmitFlag != E_EMIT_FLAGS::EF_NONE)))
-			{
-				delete pLinker;
+		// \todo Implement proper way to append extension for an output file
+		mCompilerOptions.mOutputFilename.append(".exe");
 
-				return result;
-			}
+		{
+			CTimeReportScope linkingPhase(mpTimeReport, "Linking");
 
-			if (mCompilerOptions.mEmitFlag != E_EMIT_FLAGS::EF_NONE)
-			{
-				_outputCompilationUnit(!mCompilerOptions.mOutputFilename.empty() ? mCompilerOptions.mOutputFilename : moduleName,
-									   *std::get<llvm::Module*>(compiledProgram));
-			}
+			result = mpModuleResolver->Link(mCompilerOptions.mOutputFilename, pLinker, mCompilerOptions.mEmitFlag != E_EMIT_FLAGS::EF_NONE);
+		}
 
+		if (!SUCCESS(result))
+		{
 			delete pLinker;
+
+			return result;
+		}
+
+		if (mCompilerOptions.mEmitFlag != E_EMIT_FLAGS::EF_NONE)
+		{
+			CTimeReportScope outputPhase(mpTimeReport, "Output emission");
+
+			_outputCompilationUnit(!mCompilerOptions.mOutputFilename.empty() ? mCompilerOptions.mOutputFilename : mainModuleName,
+								   *std::get<llvm::Module*>(mpModuleResolver->GetModuleEntry(mainModuleName).mCompiledIRCode));
 		}
 
+		delete pLinker;
+
 		// \note dump scope's structure on user's demand
 		if (!mIsPanicModeEnabled && (mCompilerOptions.mPrintFlags & PF_SYMTABLE_DUMP))
 		{
@@ -187,6 +290,15 @@ namespace gplc
 			return result;
 		}
 
+		// \note phases of imported modules are nested into the importer's module resolution
+		CTimeReportScope modulePhase(mpTimeReport, moduleName);
+		CTimeReportScope stagePhase(mpTimeReport, "Lexing & parsing");
+
+		// \note the stamp is taken before the source is read, so the interface becomes stale if the source is changed meanwhile
+		TModuleInterfaceInfo sourceStamp;
+
+		mpModuleResolver->TakeSourceStamp(filename, sourceStamp);
+
 		IInputStream* pInputStream = new CFileInputStream(filename);
 
 		auto disposeInputStream = [&pInputStream]()
@@ -222,16 +334,24 @@ namespace gplc
 			return RV_FAIL;
 		}
 
+		stagePhase.NextPhase("Module resolution");
+
 		// \todo resolve all modules here
-		if (!SUCCESS(mpModuleResolver->Resolve(pSourceAST, mpSymTable, mpTypesFactory, std::filesystem::current_path().string(), 
+		if (!SUCCESS(mpModuleResolver->Resolve(pSourceAST, mpSymTable, mpTypesFactory, mpASTNodesFactory, std::filesystem::current_path().string(), 
 											   std::bind(&CCompilerDriver::_compileSeparateFile, this, 
 														 std::placeholders::_1, 
 														 std::placeholders::_2,
+														 std::placeholders::_3),
+											   std::bind(&CCompilerDriver::_loadCompiledModule, this,
+														 std::placeholders::_1,
+														 std::placeholders::_2,
 														 std::placeholders::_3))))
 		{
 			return RV_FAIL;
 		}
 
+		stagePhase.NextPhase("Semantic analysis");
+
 		// analyse its semantic
 		if (!mpSemanticAnalyser->Analyze(pSourceAST, mpTypeResolver, mpSymTable, mpASTNodesFactory))
 		{
@@ -247,12 +367,88 @@ namespace gplc
 			return RV_FAIL;
 		}
 
+		// \note the module's scope is already populated by the analyser, so an unchanged module's code can be taken from the cache
+		std::string cacheKey;
+
+		IBuildCache::TCacheEntry cacheEntry;
+
+		if (mpBuildCache)
+		{
+			stagePhase.NextPhase("Build cache lookup");
+
+			cacheKey = _computeModuleCacheKey(filename, pSourceAST);
+
+			if (SUCCESS(mpBuildCache->Load(cacheKey, cacheEntry)))
+			{
+				compiledModuleData = mpCodeGenerator->LoadModule(cacheEntry.mModuleCode);
+
+				auto ppModule = std::get_if<llvm::Module*>(&compiledModuleData);
+
+				if (!ppModule || *ppModule)
+				{
+					std::cout << "gplc: Compiling " << moduleName << " (Cached)" << std::endl;
+
+					TModuleInterfaceInfo interfaceInfo = sourceStamp;
+
+					interfaceInfo.mCodeKey      = cacheKey;
+					interfaceInfo.mBuildOptions = _getBuildOptionsString();
+
+					// \note the source could be touched without changes, so the interface's stamp is refreshed
+					mpModuleResolver->SaveModuleInterface(mpSymTable, mpConstExprInterpreter, pSourceAST, filename, interfaceInfo, cacheEntry.mInterface);
+
+					disposeInputStream();
+
+					return RV_SUCCESS;
+				}
+			}
+		}
+
+		stagePhase.NextPhase("Constant folding");
+
+		// fold constant subexpressions and prune dead branches, errors like division by zero are reported here
+		if (!SUCCESS(mpConstantFolder->Fold(pSourceAST, mpSymTable, mpConstExprInterpreter, mpASTNodesFactory)) || mIsPanicModeEnabled)
+		{
+			disposeInputStream();
+
+			return RV_FAIL;
+		}
+
+		stagePhase.NextPhase("Function attributes analysis");
+
+		// infer memory effects of functions, they are emitted as LLVM attributes
+		if (!SUCCESS(mpFunctionAttributesAnalyser->Analyze(pSourceAST, mpSymTable)))
+		{
+			disposeInputStream();
+
+			return RV_FAIL;
+		}
+
+		stagePhase.NextPhase("Code generation");
+
 		// emit IR code
 		compiledModuleData = mpCodeGenerator->Generate(pSourceAST, mpSymTable, mpTypeResolver, mpConstExprInterpreter, [](ICodeGenerator* pCodeGenerator)
 		{
 			return RV_SUCCESS;
 		});
 
+		if (mpBuildCache)
+		{
+			stagePhase.NextPhase("Build cache store");
+		}
+
+		if (mpBuildCache && SUCCESS(mpCodeGenerator->SaveModule(compiledModuleData, cacheEntry.mModuleCode)))
+		{
+			TModuleInterfaceInfo interfaceInfo = sourceStamp;
+
+			interfaceInfo.mCodeKey      = cacheKey;
+			interfaceInfo.mBuildOptions = _getBuildOptionsString();
+
+			// \note importers of the module load its interface instead of the source, failures here only disable that
+			mpModuleResolver->SaveModuleInterface(mpSymTable, mpConstExprInterpreter, pSourceAST, filename, interfaceInfo, cacheEntry.mInterface);
+
+			mpBuildCache->Store(cacheKey, cacheEntry);
+		}
+
 		std::cout << "gplc: Compiling " << moduleName << " (Finished)" << std::endl;
 
 		disposeInputStream();
@@ -260,6 +456,80 @@ namespace gplc
 		return RV_SUCCESS;
 	}
 
+	Result CCompilerDriver::_loadCompiledModule(const std::string& moduleName, const TModuleInterfaceInfo& interfaceInfo, TLLVMIRData& compiledModuleData)
+	{
+		if (!mpBuildCache || interfaceInfo.mBuildOptions != _getBuildOptionsString())
+		{
+			return RV_FAIL;
+		}
+
+		CTimeReportScope loadingPhase(mpTimeReport, std::string(moduleName).append(" (Cached)"));
+
+		IBuildCache::TCacheEntry cacheEntry;
+
+		Result result = RV_SUCCESS;
+
+		if (!SUCCESS(result = mpBuildCache->Load(interfaceInfo.mCodeKey, cacheEntry)))
+		{
+			return result;
+		}
+
+		compiledModuleData = mpCodeGenerator->LoadModule(cacheEntry.mModuleCode);
+
+		auto ppModule = std::get_if<llvm::Module*>(&compiledModuleData);
+
+		if (ppModule && !*ppModule)
+		{
+			return RV_FAIL;
+		}
+
+		std::cout << "gplc: Compiling " << moduleName << " (Interface)" << std::endl;
+
+		return RV_SUCCESS;
+	}
+
+	ICompilerDriver::TStringsArray CCompilerDriver::GetSourceFiles() const
+	{
+		TStringsArray sourceFiles;
+
+		std::unordered_set<std::string> visitedFiles;
+
+		auto appendSourceFile = [&sourceFiles, &visitedFiles](const std::string& filename)
+		{
+			std::error_code errorCode;
+
+			const std::string fullPath = std::filesystem::absolute(filename, errorCode).lexically_normal().string();
+
+			if (!errorCode && visitedFiles.insert(fullPath).second)
+			{
+				sourceFiles.push_back(fullPath);
+			}
+		};
+
+		for (const std::string& currFilename : mInputFiles)
+		{
+			appendSourceFile(currFilename);
+		}
+
+		// \note input files themselves have no paths within the graph, only their imports have
+		std::function<void(const IModuleResolver::TModuleEntry&)> visitModule = [&visitModule, &appendSourceFile](const IModuleResolver::TModuleEntry& moduleEntry)
+		{
+			if (!moduleEntry.mModulePath.empty())
+			{
+				appendSourceFile(moduleEntry.mModulePath);
+			}
+
+			for (const IModuleResolver::TModuleEntry& currDependency : moduleEntry.mDependencies)
+			{
+				visitModule(currDependency);
+			}
+		};
+
+		visitModule(mpModuleResolver->GetDependencyGraph());
+
+		return sourceFiles;
+	}
+
 	void CCompilerDriver::_onLexerStageError(const TLexerErrorInfo& errorInfo)
 	{
 		mIsPanicModeEnabled = true;
@@ -291,6 +561,45 @@ namespace gplc
 		return std::filesystem::path(inputFiles.front()).parent_path().string();
 	}
 
+	std::string CCompilerDriver::_computeModuleCacheKey(const std::string& filename, CASTSourceUnitNode* pSourceAST) const
+	{
+		IBuildCache::TCacheKeyDesc keyDesc;
+
+		std::ifstream sourceFile(filename, std::ios::binary);
+
+		std::stringstream sourceCode;
+		sourceCode << sourceFile.rdbuf();
+
+		keyDesc.mSourceCode      = sourceCode.str();
+		keyDesc.mCompilerVersion = std::to_string(ToolVersion.mMajor).append(".").append(std::to_string(ToolVersion.mMinor));
+
+		keyDesc.mOptions         = _getBuildOptionsString();
+
+		for (auto pCurrChild : pSourceAST->GetChildren())
+		{
+			if (!pCurrChild || pCurrChild->GetType() != NT_IMPORT)
+			{
+				continue;
+			}
+
+			keyDesc.mImportsInterfacesHashes.push_back(mpModuleResolver->GetModuleInterfaceHash(dynamic_cast<CASTImportDirectiveNode*>(pCurrChild)->GetImportedModuleName()));
+		}
+
+		return mpBuildCache->ComputeKey(keyDesc);
+	}
+
+	std::string CCompilerDriver::_getBuildOptionsString() const
+	{
+		// \note only options which change the module's code are taken into account
+		return std::to_string(ToolVersion.mMajor).append(".").append(std::to_string(ToolVersion.mMinor))
+												 .append(";")
+												 .append(std::to_string(mCompilerOptions.mCodeGenFlags))
+												 .append(";")
+												 .append(std::to_string(mCompilerOptions.mOptimizationLevel))
+												 .append(";")
+												 .append(llvm::sys::getDefaultTargetTriple());
+	}
+
 	void CCompilerDriver::_outputCompilationUnit(const std::string& filename, llvm::Module& module) const
 	{
 		std::error_code EC;
@@ -316,30 +625,16 @@ namespace gplc
 				break;
 			case E_EMIT_FLAGS::EF_ASM:
 				{
-					// \todo Refactor this part later, define some class that will return assembly code for specific target machine
-					auto targetTriple = llvm::sys::getDefaultTargetTriple();
+					auto targetMachine = GetHostTargetMachine();
 
-					std::string errorMsg;
-
-					auto pTarget = llvm::TargetRegistry::lookupTarget(targetTriple, errorMsg);
-
-					if (!pTarget) 
+					if (!targetMachine) 
 					{
 						Panic(GetRedConsoleText("Error: ").append("Couldn't find specified target"));
 					}
 
-					const C8* CPU      = "generic";
-					const C8* features = "";
-
-					llvm::TargetOptions targetOptions;
-
-					auto RM = llvm::Optional<llvm::Reloc::Model>();
-					
-					auto targetMachine = pTarget->createTargetMachine(targetTriple, CPU, features, targetOptions, RM);
-
 					// \todo move it from here to some proper place
 					module.setDataLayout(targetMachine->createDataLayout());
-					module.setTargetTriple(targetTriple);
+					module.setTargetTriple(targetMachine->getTargetTriple().str());
 
 					llvm::legacy::PassManager passManager;
 
@@ -356,13 +651,47 @@ namespace gplc
 		}
 	}
 
+	void CCompilerDriver::_outputTimeReport() const
+	{
+		if (!mpTimeReport)
+		{
+			return;
+		}
+
+		if (mCompilerOptions.mIsTimeReportEnabled)
+		{
+			std::cout << mpTimeReport->ToString();
+		}
+
+		auto writeReportFile = [](const std::string& filename, const std::string& report)
+		{
+			std::ofstream reportFile(filename, std::ios::trunc);
+
+			if (!reportFile.is_open())
+			{
+				std::cout << "Warning: the time report can't be written into " << filename << std::endl;
+
+				return;
+			}
+
+			reportFile << report;
+		};
+
+		if (!mCompilerOptions.mTimeReportFilename.empty())
+		{
+			writeReportFile(mCompilerOptions.mTimeReportFilename, mpTimeReport->ToJSON());
+		}
+
+		if (!mCompilerOptions.mTraceFilename.empty())
+		{
+			writeReportFile(mCompilerOptions.mTraceFilename, mpTimeReport->ToTraceEvents());
+		}
+	}
+
 	void CCompilerDriver::_initLLVMInfrastructure() const
 	{
-		llvm::InitializeAllTargetInfos();
-		llvm::InitializeAllTargets();
-		llvm::InitializeAllTargetMCs();
-		llvm::InitializeAllAsmParsers();
-		llvm::InitializeAllAsmPrinters();
+		// \note workers of a compiler's server inherit already registered targets
+		InitLLVMInfrastructure();
 
 		if (mCompilerOptions.mPrintFlags & PF_COMPILER_TARGETS)
 		{
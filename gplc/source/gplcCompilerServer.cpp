@@ -0,0 +1,554 @@
+#include "gplcCompilerServer.h"
+#include "gplcCompilerDriver.h"
+#include "gplcCommon.h"
+#include <iostream>
+#include <filesystem>
+#include <cstring>
+#include <csignal>
+#if !defined(_WIN32)
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <sys/wait.h>
+	#include <poll.h>
+	#include <unistd.h>
+	#include <cerrno>
+#endif
+
+
+namespace gplc
+{
+	const U32 CCompilerServer::mTrailerSignature = 0x534c5047; // "GPLS"
+
+	const U32 CCompilerServer::mMaxRequestStringLength = 1 << 16;
+
+
+#if !defined(_WIN32)
+
+	static volatile std::sig_atomic_t IsStopRequested = 0;
+
+
+	static void OnStopSignal(int)
+	{
+		IsStopRequested = 1;
+	}
+
+	static bool WriteBytes(I32 socket, const void* pData, size_t size)
+	{
+		const C8* pCurrData = static_cast<const C8*>(pData);
+
+		while (size)
+		{
+			const ssize_t bytesWritten = write(socket, pCurrData, size);
+
+			if (bytesWritten < 0 && errno == EINTR)
+			{
+				continue;
+			}
+
+			if (bytesWritten <= 0)
+			{
+				return false;
+			}
+
+			pCurrData += bytesWritten;
+			size      -= static_cast<size_t>(bytesWritten);
+		}
+
+		return true;
+	}
+
+	static bool ReadBytes(I32 socket, void* pData, size_t size)
+	{
+		C8* pCurrData = static_cast<C8*>(pData);
+
+		while (size)
+		{
+			const ssize_t bytesRead = read(socket, pCurrData, size);
+
+			if (bytesRead < 0 && errno == EINTR)
+			{
+				continue;
+			}
+
+			if (bytesRead <= 0)
+			{
+				return false;
+			}
+
+			pCurrData += bytesRead;
+			size      -= static_cast<size_t>(bytesRead);
+		}
+
+		return true;
+	}
+
+	static bool InitSocketAddress(const std::string& socketPath, sockaddr_un& address)
+	{
+		std::memset(&address, 0, sizeof(address));
+
+		if (socketPath.empty() || socketPath.length() >= sizeof(address.sun_path))
+		{
+			return false;
+		}
+
+		address.sun_family = AF_UNIX;
+
+		std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+		return true;
+	}
+
+	static I32 ConnectToServer(const std::string& socketPath)
+	{
+		sockaddr_un address;
+
+		if (!InitSocketAddress(socketPath, address))
+		{
+			return -1;
+		}
+
+		const I32 serverSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+
+		if (serverSocket < 0)
+		{
+			return -1;
+		}
+
+		if (connect(serverSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0)
+		{
+			close(serverSocket);
+
+			return -1;
+		}
+
+		return serverSocket;
+	}
+
+
+	Result CCompilerServer::Init(const TCompilerOptions& options)
+	{
+		if (mIsInitialized)
+		{
+			return RV_SUCCESS;
+		}
+
+		mCompilerOptions = options;
+
+		sockaddr_un address;
+
+		if (!InitSocketAddress(mCompilerOptions.mServerSocketPath, address))
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		// \note a socket's file is left by a server which wasn't stopped properly, but it shouldn't be taken from a running one
+		const I32 runningServerSocket = ConnectToServer(mCompilerOptions.mServerSocketPath);
+
+		if (runningServerSocket >= 0)
+		{
+			close(runningServerSocket);
+
+			std::cout << GetRedConsoleText("Error: ").append("Another server is listening on ").append(mCompilerOptions.mServerSocketPath) << std::endl;
+
+			return RV_FAIL;
+		}
+
+		unlink(mCompilerOptions.mServerSocketPath.c_str());
+
+		if ((mListeningSocket = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+		{
+			return RV_FAIL;
+		}
+
+		if (bind(mListeningSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0 || listen(mListeningSocket, SOMAXCONN) < 0)
+		{
+			std::cout << GetRedConsoleText("Error: ").append("Couldn't listen on ").append(mCompilerOptions.mServerSocketPath) << std::endl;
+
+			close(mListeningSocket);
+
+			mListeningSocket = -1;
+
+			return RV_FAIL;
+		}
+
+		// \note the state is initialized before the first fork, so all workers get it for free
+		if (!SUCCESS(InitLLVMInfrastructure()))
+		{
+			return RV_FAIL;
+		}
+
+		GetHostTargetMachine();
+
+		mIsInitialized = true;
+
+		return RV_SUCCESS;
+	}
+
+	Result CCompilerServer::Free()
+	{
+		if (mIsInitialized)
+		{
+			_collectFinishedWorkers(true);
+
+			close(mListeningSocket);
+
+			unlink(mCompilerOptions.mServerSocketPath.c_str());
+
+			mIsInitialized = false;
+		}
+
+		delete this;
+
+		return RV_SUCCESS;
+	}
+
+	Result CCompilerServer::Run()
+	{
+		if (!mIsInitialized)
+		{
+			return RV_FAIL;
+		}
+
+		std::signal(SIGINT, OnStopSignal);
+		std::signal(SIGTERM, OnStopSignal);
+		std::signal(SIGPIPE, SIG_IGN); // \note a client can go away before its build is finished
+
+		std::cout << "gplc: The server is listening on " << mCompilerOptions.mServerSocketPath << std::endl;
+
+		pollfd listeningSocketDesc { mListeningSocket, POLLIN, 0 };
+
+		while (!IsStopRequested)
+		{
+			_collectFinishedWorkers();
+
+			// \note the timeout bounds a delay between a worker's exit and a response to its client
+			if (poll(&listeningSocketDesc, 1, 10) <= 0)
+			{
+				continue;
+			}
+
+			const I32 clientSocket = accept(mListeningSocket, nullptr, nullptr);
+
+			if (clientSocket < 0)
+			{
+				continue;
+			}
+
+			// \note otherwise a worker would print the server's buffered output once again
+			std::cout.flush();
+
+			const pid_t workerId = fork();
+
+			if (workerId < 0)
+			{
+				close(clientSocket);
+
+				continue;
+			}
+
+			if (!workerId)
+			{
+				std::signal(SIGINT, SIG_DFL);
+				std::signal(SIGTERM, SIG_DFL);
+
+				close(mListeningSocket);
+
+				// \note clients of other workers shouldn't wait until this one is finished
+				for (auto& currWorker : mWorkers)
+				{
+					close(currWorker.second);
+				}
+
+				dup2(clientSocket, STDOUT_FILENO);
+				dup2(clientSocket, STDERR_FILENO);
+
+				const I32 exitCode = _processRequest(clientSocket);
+
+				std::cout.flush();
+				std::cerr.flush();
+				fflush(nullptr);
+
+				// \note destructors of the server's static objects shouldn't be run by its workers
+				_exit(exitCode);
+			}
+
+			mWorkers[workerId] = clientSocket;
+		}
+
+		std::cout << "gplc: The server is stopped" << std::endl;
+
+		return RV_SUCCESS;
+	}
+
+	I32 CCompilerServer::_processRequest(I32 clientSocket) const
+	{
+		U32 stringsCount = 0;
+
+		if (!ReadBytes(clientSocket, &stringsCount, sizeof(stringsCount)) || stringsCount < 2 || stringsCount > mMaxRequestStringLength)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		TStringsArray request(stringsCount);
+
+		for (std::string& currString : request)
+		{
+			U32 length = 0;
+
+			if (!ReadBytes(clientSocket, &length, sizeof(length)) || length > mMaxRequestStringLength)
+			{
+				return RV_INVALID_ARGUMENTS;
+			}
+
+			currString.resize(length);
+
+			if (length && !ReadBytes(clientSocket, &currString[0], length))
+			{
+				return RV_INVALID_ARGUMENTS;
+			}
+		}
+
+		std::error_code errorCode;
+
+		std::filesystem::current_path(request.front(), errorCode);
+
+		if (errorCode)
+		{
+			std::cout << GetRedConsoleText("Error: ").append("Working directory not found (").append(request.front()).append(")") << std::endl;
+
+			return RV_FILE_NOT_FOUND;
+		}
+
+		std::vector<const C8*> arguments;
+
+		for (auto iter = request.cbegin() + 1; iter != request.cend(); ++iter)
+		{
+			arguments.push_back(iter->c_str());
+		}
+
+		arguments.push_back(nullptr);
+
+		auto parseOptionsResult = ParseOptions(static_cast<int>(arguments.size() - 1), arguments.data());
+
+		if (!parseOptionsResult.IsOk())
+		{
+			return parseOptionsResult.GetError();
+		}
+
+		TCompilerOptions compilerOptions = parseOptionsResult.Get();
+
+		// \note a forwarded command line can't start another server or be forwarded once again
+		compilerOptions.mServerSocketPath.clear();
+		compilerOptions.mConnectSocketPath.clear();
+
+		if (compilerOptions.mInputFilename.empty())
+		{
+			std::cout << GetRedConsoleText("Error: ").append("no input file's found") << std::endl;
+
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		auto createDriverResult = CreateCompilerDriver(compilerOptions);
+
+		if (!createDriverResult.IsOk())
+		{
+			std::cout << GetRedConsoleText("Error: ").append("The compiler can't be initialized") << std::endl;
+
+			return createDriverResult.GetError();
+		}
+
+		ICompilerDriver* pCompilerDriver = createDriverResult.Get();
+
+		const Result result = pCompilerDriver->Run({ compilerOptions.mInputFilename });
+		const Result freeResult = pCompilerDriver->Free();
+
+		// \note the client's exit code is the status of the compilation, failures of the release are reported only if it succeeded
+		return SUCCESS(result) ? freeResult : result;
+	}
+
+	void CCompilerServer::_collectFinishedWorkers(bool waitForAll)
+	{
+		I32   status   = 0;
+		pid_t workerId = 0;
+
+		while (!mWorkers.empty() && (workerId = waitpid(-1, &status, waitForAll ? 0 : WNOHANG)) != 0)
+		{
+			if (workerId < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				break;
+			}
+
+			auto iter = mWorkers.find(workerId);
+
+			if (iter == mWorkers.end())
+			{
+				continue;
+			}
+
+			const U32 trailer[2] { mTrailerSignature, static_cast<U32>(WIFEXITED(status) ? WEXITSTATUS(status) : RV_FAIL) };
+
+			WriteBytes(iter->second, trailer, sizeof(trailer));
+
+			close(iter->second);
+
+			mWorkers.erase(iter);
+		}
+	}
+
+
+	TResult<ICompilerServer*> CreateCompilerServer(const TCompilerOptions& compilerOptions)
+	{
+		ICompilerServer* pCompilerServer = new CCompilerServer();
+
+		Result result = pCompilerServer->Init(compilerOptions);
+
+		if (!SUCCESS(result))
+		{
+			pCompilerServer->Free();
+
+			return TErrorValue<E_RESULT_VALUE>(static_cast<E_RESULT_VALUE>(result));
+		}
+
+		return TOkValue(pCompilerServer);
+	}
+
+	TResult<I32> ForwardCommandLine(const std::string& socketPath, const ICompilerServer::TStringsArray& commandLine)
+	{
+		const I32 serverSocket = ConnectToServer(socketPath);
+
+		if (serverSocket < 0)
+		{
+			return TErrorValue<E_RESULT_VALUE>(RV_FILE_NOT_FOUND);
+		}
+
+		ICompilerServer::TStringsArray request { std::filesystem::current_path().string() };
+
+		request.insert(request.end(), commandLine.cbegin(), commandLine.cend());
+
+		const U32 stringsCount = static_cast<U32>(request.size());
+
+		bool isRequestSent = WriteBytes(serverSocket, &stringsCount, sizeof(stringsCount));
+
+		for (auto iter = request.cbegin(); isRequestSent && iter != request.cend(); ++iter)
+		{
+			const U32 length = static_cast<U32>(iter->length());
+
+			isRequestSent = WriteBytes(serverSocket, &length, sizeof(length)) && WriteBytes(serverSocket, iter->data(), length);
+		}
+
+		// \note nothing is printed yet, so the command line still can be compiled locally
+		if (!isRequestSent)
+		{
+			close(serverSocket);
+
+			return TErrorValue<E_RESULT_VALUE>(RV_FAIL);
+		}
+
+		U32 trailer[2] { 0, 0 };
+
+		// \note the last bytes of the stream are held back until its end, because they can be the trailer
+		std::vector<C8> output;
+
+		C8 buffer[4096];
+
+		while (true)
+		{
+			const ssize_t bytesRead = read(serverSocket, buffer, sizeof(buffer));
+
+			if (bytesRead < 0 && errno == EINTR)
+			{
+				continue;
+			}
+
+			if (bytesRead <= 0)
+			{
+				break;
+			}
+
+			output.insert(output.end(), buffer, buffer + bytesRead);
+
+			if (output.size() > sizeof(trailer))
+			{
+				const size_t outputSize = output.size() - sizeof(trailer);
+
+				std::cout.write(output.data(), outputSize);
+
+				output.erase(output.begin(), output.begin() + outputSize);
+			}
+		}
+
+		close(serverSocket);
+
+		std::cout.flush();
+
+		if (output.size() == sizeof(trailer))
+		{
+			std::memcpy(trailer, output.data(), sizeof(trailer));
+		}
+
+		if (trailer[0] != CCompilerServer::mTrailerSignature)
+		{
+			std::cout.write(output.data(), output.size());
+
+			std::cout << GetRedConsoleText("Error: ").append("The server's response was interrupted") << std::endl;
+
+			return TOkValue<I32>(RV_FAIL);
+		}
+
+		return TOkValue<I32>(static_cast<I32>(trailer[1]));
+	}
+
+#else
+
+	Result CCompilerServer::Init(const TCompilerOptions& options)
+	{
+		std::cout << GetRedConsoleText("Error: ").append("The server mode isn't supported on this platform") << std::endl;
+
+		return RV_FAIL;
+	}
+
+	Result CCompilerServer::Free()
+	{
+		delete this;
+
+		return RV_SUCCESS;
+	}
+
+	Result CCompilerServer::Run()
+	{
+		return RV_FAIL;
+	}
+
+	I32 CCompilerServer::_processRequest(I32 clientSocket) const
+	{
+		return RV_FAIL;
+	}
+
+	void CCompilerServer::_collectFinishedWorkers(bool waitForAll)
+	{
+	}
+
+
+	TResult<ICompilerServer*> CreateCompilerServer(const TCompilerOptions& compilerOptions)
+	{
+		ICompilerServer* pCompilerServer = new CCompilerServer();
+
+		Result result = pCompilerServer->Init(compilerOptions);
+
+		pCompilerServer->Free();
+
+		return TErrorValue<E_RESULT_VALUE>(static_cast<E_RESULT_VALUE>(result));
+	}
+
+	TResult<I32> ForwardCommandLine(const std::string& socketPath, const ICompilerServer::TStringsArray& commandLine)
+	{
+		return TErrorValue<E_RESULT_VALUE>(RV_FAIL);
+	}
+
+#endif
+}
@@ -0,0 +1,231 @@
+#include "gplcFileWatcher.h"
+#include "gplcCommon.h"
+#include <iostream>
+#include <filesystem>
+#if defined(__linux__)
+	#include <sys/inotify.h>
+	#include <poll.h>
+	#include <unistd.h>
+	#include <cerrno>
+#endif
+
+
+namespace gplc
+{
+	const I32 CFileWatcher::mDebounceTimeout = 50; // in milliseconds
+
+
+#if defined(__linux__)
+
+	Result CFileWatcher::Init()
+	{
+		if (mIsInitialized)
+		{
+			return RV_SUCCESS;
+		}
+
+		if ((mInotifyHandle = inotify_init1(IN_CLOEXEC)) < 0)
+		{
+			return RV_FAIL;
+		}
+
+		mIsInitialized = true;
+
+		return RV_SUCCESS;
+	}
+
+	Result CFileWatcher::Free()
+	{
+		if (mIsInitialized)
+		{
+			close(mInotifyHandle); // \note all watches are removed with the descriptor
+
+			mIsInitialized = false;
+		}
+
+		delete this;
+
+		return RV_SUCCESS;
+	}
+
+	Result CFileWatcher::Watch(const TStringsArray& filenames)
+	{
+		if (!mIsInitialized)
+		{
+			return RV_FAIL;
+		}
+
+		std::unordered_set<std::string> directories;
+
+		mWatchedFiles.clear();
+
+		for (const std::string& currFilename : filenames)
+		{
+			mWatchedFiles.insert(currFilename);
+
+			directories.insert(std::filesystem::path(currFilename).parent_path().string());
+		}
+
+		// \note directories which contain none of the files anymore aren't watched
+		for (auto iter = mWatchedDirectories.begin(); iter != mWatchedDirectories.end();)
+		{
+			if (directories.erase(iter->second))
+			{
+				++iter;
+
+				continue;
+			}
+
+			inotify_rm_watch(mInotifyHandle, iter->first);
+
+			iter = mWatchedDirectories.erase(iter);
+		}
+
+		for (const std::string& currDirectory : directories)
+		{
+			const I32 watchDescriptor = inotify_add_watch(mInotifyHandle, currDirectory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE);
+
+			if (watchDescriptor < 0)
+			{
+				std::cout << "Warning: the directory (" << currDirectory << ") can't be watched" << std::endl;
+
+				continue;
+			}
+
+			mWatchedDirectories[watchDescriptor] = currDirectory;
+		}
+
+		return RV_SUCCESS;
+	}
+
+	Result CFileWatcher::WaitForChanges(TStringsArray& changedFiles)
+	{
+		if (!mIsInitialized)
+		{
+			return RV_FAIL;
+		}
+
+		std::unordered_set<std::string> changedFilesSet;
+
+		while (changedFilesSet.empty())
+		{
+			if (!_readEvents(-1, changedFilesSet))
+			{
+				return RV_FAIL;
+			}
+
+			// \note an editor may produce a burst of events saving a file, they're merged into a single rebuild
+			while (_readEvents(mDebounceTimeout, changedFilesSet))
+			{
+			}
+		}
+
+		changedFiles.assign(changedFilesSet.begin(), changedFilesSet.end());
+
+		return RV_SUCCESS;
+	}
+
+	bool CFileWatcher::_readEvents(I32 timeout, std::unordered_set<std::string>& changedFiles)
+	{
+		pollfd pollDesc { mInotifyHandle, POLLIN, 0 };
+
+		if (poll(&pollDesc, 1, timeout) <= 0)
+		{
+			return false;
+		}
+
+		alignas(inotify_event) C8 eventsBuffer[4096];
+
+		const ssize_t bytesRead = read(mInotifyHandle, eventsBuffer, sizeof(eventsBuffer));
+
+		if (bytesRead < 0)
+		{
+			return errno == EINTR || errno == EAGAIN;
+		}
+
+		for (const C8* pCurrEvent = eventsBuffer; pCurrEvent < eventsBuffer + bytesRead;)
+		{
+			const inotify_event* pEvent = reinterpret_cast<const inotify_event*>(pCurrEvent);
+
+			pCurrEvent += sizeof(inotify_event) + pEvent->len;
+
+			auto iter = mWatchedDirectories.find(pEvent->wd);
+
+			if (iter == mWatchedDirectories.end() || !pEvent->len)
+			{
+				continue;
+			}
+
+			std::string filename = (std::filesystem::path(iter->second) / pEvent->name).string();
+
+			if (mWatchedFiles.find(filename) != mWatchedFiles.end())
+			{
+				changedFiles.insert(std::move(filename));
+			}
+		}
+
+		return true;
+	}
+
+
+	TResult<IFileWatcher*> CreateFileWatcher()
+	{
+		IFileWatcher* pFileWatcher = new CFileWatcher();
+
+		Result result = pFileWatcher->Init();
+
+		if (!SUCCESS(result))
+		{
+			pFileWatcher->Free();
+
+			return TErrorValue<E_RESULT_VALUE>(static_cast<E_RESULT_VALUE>(result));
+		}
+
+		return TOkValue(pFileWatcher);
+	}
+
+#else
+
+	Result CFileWatcher::Init()
+	{
+		std::cout << GetRedConsoleText("Error: ").append("The watch mode isn't supported on this platform") << std::endl;
+
+		return RV_FAIL;
+	}
+
+	Result CFileWatcher::Free()
+	{
+		delete this;
+
+		return RV_SUCCESS;
+	}
+
+	Result CFileWatcher::Watch(const TStringsArray& filenames)
+	{
+		return RV_FAIL;
+	}
+
+	Result CFileWatcher::WaitForChanges(TStringsArray& changedFiles)
+	{
+		return RV_FAIL;
+	}
+
+	bool CFileWatcher::_readEvents(I32 timeout, std::unordered_set<std::string>& changedFiles)
+	{
+		return false;
+	}
+
+
+	TResult<IFileWatcher*> CreateFileWatcher()
+	{
+		IFileWatcher* pFileWatcher = new CFileWatcher();
+
+		Result result = pFileWatcher->Init();
+
+		pFileWatcher->Free();
+
+		return TErrorValue<E_RESULT_VALUE>(static_cast<E_RESULT_VALUE>(result));
+	}
+
+#endif
+}
@@ -1,13 +1,91 @@
 #include "gplcCompilerDriver.h"
+#include "gplcCompilerServer.h"
+#include "gplcFileWatcher.h"
 #include "gplcCommon.h"
+#include <iostream>
+#include <chrono>
 
 
 using namespace gplc;
 
 
+static Result RunWatchMode(const TCompilerOptions& compilerOptions)
+{
+	IFileWatcher* pFileWatcher = CreateFileWatcher().Get(); // this will raise panic if fails
+
+	IFileWatcher::TStringsArray changedFiles;
+
+	while (true)
+	{
+		const auto startTime = std::chrono::steady_clock::now();
+
+		// \note each rebuild starts with a new driver, unchanged modules are loaded from their interfaces and the build cache instead of being compiled
+		ICompilerDriver* pCompilerDriver = CreateCompilerDriver(compilerOptions).Get();
+
+		const Result result = pCompilerDriver->Run({ compilerOptions.mInputFilename });
+
+		const ICompilerDriver::TStringsArray sourceFiles = pCompilerDriver->GetSourceFiles();
+
+		pCompilerDriver->Free();
+
+		const auto elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+		std::cout << (SUCCESS(result) ? std::string("Build succeeded") : GetRedConsoleText("Build failed")) << " in " << elapsedTime << " ms, watching "
+				  << sourceFiles.size() << " file(s) for changes..." << std::endl;
+
+		// \note files which are changed while the program is being built are reported with the next call, because previous watches are kept until then
+		if (!SUCCESS(pFileWatcher->Watch(sourceFiles)) || !SUCCESS(pFileWatcher->WaitForChanges(changedFiles)))
+		{
+			break;
+		}
+
+		for (const std::string& currFilename : changedFiles)
+		{
+			std::cout << "Changed: " << currFilename << std::endl;
+		}
+	}
+
+	return pFileWatcher->Free();
+}
+
+
 int main(int argc, const char** argv)
 {
-	TCompilerOptions parserOptions = ParseOptions(argc, argv).Get();
+	// \note argparse library changes argv's values, so the command line is copied before to be forwarded to a server
+	const ICompilerServer::TStringsArray commandLine(argv, argv + argc);
+
+	auto parseOptionsResult = ParseOptions(argc, argv);
+
+	if (!parseOptionsResult.IsOk())
+	{
+		return parseOptionsResult.GetError();
+	}
+
+	TCompilerOptions parserOptions = parseOptionsResult.Get();
+
+	if (!parserOptions.mServerSocketPath.empty())
+	{
+		ICompilerServer* pCompilerServer = CreateCompilerServer(parserOptions).Get(); // this will raise panic if fails
+
+		pCompilerServer->Run();
+
+		return pCompilerServer->Free();
+	}
+
+	if (!parserOptions.mConnectSocketPath.empty())
+	{
+		auto exitCode = ForwardCommandLine(parserOptions.mConnectSocketPath, commandLine);
+
+		if (exitCode.IsOk())
+		{
+			return exitCode.Get();
+		}
+	}
+
+	if (parserOptions.mIsWatchModeEnabled)
+	{
+		return RunWatchMode(parserOptions);
+	}
 
 	ICompilerDriver* pCompilerDriver = CreateCompilerDriver(parserOptions).Get(); // this will raise panic if fails
 
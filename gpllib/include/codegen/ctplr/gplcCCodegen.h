@@ -35,6 +35,12 @@ namespace gplc
 			TLLVMIRData Generate(CASTSourceUnitNode* pNode, ISymTable* pSymTable, ITypeResolver* pTypeResolver, IConstExprInterpreter* pInterpreter,
 								 const TOnPreGenerateCallback& onPreGenerateCallback) override;
 
+			Result SetFlags(U32 flags) override;
+
+			Result SaveModule(const TLLVMIRData& compiledModule, std::vector<U8>& output) override;
+
+			TLLVMIRData LoadModule(const std::vector<U8>& data) override;
+
 			TLLVMIRData VisitProgramUnit(CASTSourceUnitNode* pProgramNode) override;
 
 			TLLVMIRData VisitDeclaration(CASTDeclarationNode* pNode) override;
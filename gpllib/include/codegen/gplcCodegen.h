@@ -16,6 +16,7 @@
 #include "common/gplcVisitor.h"
 #include <functional>
 #include <string>
+#include <vector>
 
 
 namespace gplc
@@ -27,6 +28,12 @@ namespace gplc
 	template <typename T> class ITypeVisitor;
 
 
+	enum E_CODE_GENERATOR_FLAGS : U32
+	{
+		CGF_DISABLE_BOUNDS_CHECKS = 0x1, ///< \note Indices of arrays aren't checked up in runtime, the same as @unchecked for the whole program
+	};
+
+
 	class ICodeGenerator: public IASTNodeVisitor<TLLVMIRData>
 	{
 		public:
@@ -38,7 +45,31 @@ namespace gplc
 			virtual TLLVMIRData Generate(CASTSourceUnitNode* pNode, ISymTable* pSymTable, ITypeResolver* pTypeResolver, IConstExprInterpreter* pInterpreter,
 										 const TOnPreGenerateCallback& onPreGenerateCallback) = 0;
 
+			/*!
+				\brief The method specifies options of code generation, which are combination of E_CODE_GENERATOR_FLAGS
+
+				\return The method returns RV_SUCCESS if the flags are supported by the generator
+			*/
+
+			virtual Result SetFlags(U32 flags) = 0;
+
 			virtual ITypeVisitor<TLLVMIRData>* GetTypeGenerator() const = 0;
+
+			/*!
+				\brief The method serializes a result of Generate, so it can be stored in a build cache
+
+				\return The method returns RV_SUCCESS if the module was written into the output array
+			*/
+
+			virtual Result SaveModule(const TLLVMIRData& compiledModule, std::vector<U8>& output) = 0;
+
+			/*!
+				\brief The method restores a module which was written with SaveModule
+
+				\return The method returns the same value as Generate does, or an empty one if the data is invalid
+			*/
+
+			virtual TLLVMIRData LoadModule(const std::vector<U8>& data) = 0;
 		protected:
 			ICodeGenerator(const ICodeGenerator& codeGenerator) = default;
 	};
@@ -14,6 +14,7 @@
 
 #include "codegen/gplcCodegen.h"
 #include "common/gplcVisitor.h"
+#include "common/gplcSymTable.h"
 #include "lexer/gplcTokens.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/IRBuilder.h"
@@ -21,11 +22,13 @@
 #include <variant>
 #include <unordered_map>
 #include <stack>
+#include <vector>
 
 
 namespace gplc
 {
 	struct TSymbolDesc;
+	struct TLoopHints;
 
 	class ITypeResolver;
 	class CASTExpressionNode;
@@ -42,11 +45,70 @@ namespace gplc
 
 			typedef std::unordered_map<TSymbolHandle, llvm::Value*> TValuesTable;
 
+			typedef std::unordered_map<TSymbolHandle, llvm::Function*> TFunctionsTable;
+
 			typedef std::stack<llvm::IRBuilder<>>                   TIRBuidlersStack;
 
-			typedef std::stack<CASTExpressionNode*>                 TExpressionsStack;
+			/*!
+				\brief Each deferred expression is stored with a scope of its defer operator, its names are resolved
+				within that scope when the expression is emitted at an exit of some nested block
+			*/
+
+			typedef std::vector<std::pair<CASTExpressionNode*, ISymTable::TScopeHandle>> TExpressionsArray;
+
+			/*!
+				\brief Deferred expressions of each statements block which is being generated, the innermost block is the last one
+			*/
+
+			typedef std::vector<TExpressionsArray>                  TDeferredExpressionStack;
+
+			typedef std::stack<std::vector<llvm::Value*>>           TScopedAllocasStack;
+
+			typedef std::unordered_map<std::string, llvm::Constant*> TConstantsTable;
+
+			/*!
+				\brief The structure describes a variable which controls a while loop, e.g. i in while i < 10 { ... }.
+				An access arr[i] within the loop's body doesn't need a bounds check if arr's length isn't less than
+				mUpperBound and i isn't changed since the loop's condition was checked up
+			*/
+
+			struct TInductionVariableInfo
+			{
+				TSymbolHandle      mVariableHandle       = InvalidSymbolHandle; ///< \note The variable's name can be shadowed within the loop's body, so it's identified by the handle
+
+				U64                mUpperBound           = 0;       ///< \note An exclusive upper bound of the variable's value
+
+				bool               mIsValid              = false;   ///< \note The flag is reset when the variable can be changed within the current iteration
+
+				bool               mIsLowerBoundProven   = false;   ///< \note The flag is set for unsigned variables
 
-			typedef std::stack<TExpressionsStack>                   TDeferredExpressionStack;
+				bool               mIsMonotonic          = false;   ///< \note The variable is only incremented within the loop, so it's enough to check up its initial value
+
+				llvm::Instruction* mpPreheaderTerminator = nullptr; ///< \note A branch into the loop's condition, hoisted checks are placed before it
+
+				std::vector<llvm::CallInst*> mHoistableChecks;      ///< \note Checks of accesses by a monotonic variable, see _hoistBoundsChecks
+			};
+
+			/*!
+				\brief The structure describes a loop which is lowered into the canonical form. The preheader jumps into
+				the header, the header checks up the condition, the body jumps into the latch which is the only back edge of
+				the loop. 'continue' jumps into the latch, 'break' jumps into the exit block
+			*/
+
+			struct TLoopInfo
+			{
+				llvm::BasicBlock*      mpHeaderBlock = nullptr;
+
+				llvm::BasicBlock*      mpLatchBlock  = nullptr;
+
+				llvm::BasicBlock*      mpExitBlock   = nullptr;
+
+				size_t                 mDeferredScopesCount = 0; ///< \note Blocks with deferred expressions that enclose the loop, 'break' and 'continue' don't leave them
+
+				TInductionVariableInfo mInductionVariable;
+			};
+
+			typedef std::vector<TLoopInfo>                          TLoopsArray;
 		public:
 			CLLVMCodeGenerator() = default;
 			virtual ~CLLVMCodeGenerator() = default;
@@ -54,6 +116,12 @@ namespace gplc
 			TLLVMIRData Generate(CASTSourceUnitNode* pNode, ISymTable* pSymTable, ITypeResolver* pTypeResolver, IConstExprInterpreter* pInterpreter,
 								 const TOnPreGenerateCallback& onPreGenerateCallback) override;
 
+			Result SetFlags(U32 flags) override;
+
+			Result SaveModule(const TLLVMIRData& compiledModule, std::vector<U8>& output) override;
+
+			TLLVMIRData LoadModule(const std::vector<U8>& data) override;
+
 			TLLVMIRData VisitProgramUnit(CASTSourceUnitNode* pProgramNode) override;
 
 			TLLVMIRData VisitDeclaration(CASTDeclarationNode* pNode) override;
@@ -130,6 +198,150 @@ namespace gplc
 
 			llvm::Value* _allocateVariableOnStack(const std::string& identifier, bool isFuncArg = false);
 
+			/*!
+				\brief The method places an alloca into the entry block of the current function, so it's executed only once
+				even if a variable is declared within a loop and can be promoted into a register by LLVM
+			*/
+
+			/*!
+				\brief The method returns an initializer of a global variable if its value is computed in compile time
+
+				\return A constant of pInternalType or nullptr if the value should be computed within the module's init function
+			*/
+
+			llvm::Constant* _createStaticInitializer(CASTNode* pValue, CType* pType, llvm::Type* pInternalType);
+
+			/*!
+				\brief The method returns an initializer for a variable of a given type which is initialized with its default value
+			*/
+
+			llvm::Constant* _createDefaultStaticInitializer(CType* pType, CASTNode* pValue, llvm::Type* pInternalType);
+
+			/*!
+				\brief The method returns a constant which contains default values of all struct's fields
+
+				\return A constant or nullptr if some of defaults should be computed by $ctor in runtime
+			*/
+
+			llvm::Constant* _getStructDefaultInitializer(CType* pType);
+
+			/*!
+				\brief The method returns a private constant global that is copied into a local struct on its declaration
+			*/
+
+			llvm::Constant* _getStructDefaultTemplate(CType* pType, llvm::Constant* pDefaultValue);
+
+			bool _isStaticallyEvaluable(CASTNode* pNode) const;
+
+			/*!
+				\brief The method emits a check up of an index of a static sized array if it can't be proven that the index is in range.
+				Out of range indices cause the program's termination in the same way as __abort does
+			*/
+
+			void _emitBoundsCheck(CArrayType* pArrayType, CASTExpressionNode* pIndexExpr, llvm::Value* pIndexValue);
+
+			bool _isIndexInRange(CASTExpressionNode* pIndexExpr, llvm::Value* pIndexValue, bool isSigned, U64 length);
+
+			/*!
+				\brief The method returns the innermost loop's induction variable if the index is that variable and its upper bound
+				doesn't exceed the length, otherwise nullptr is returned
+			*/
+
+			TInductionVariableInfo* _getInductionVariableOfIndex(CASTExpressionNode* pIndexExpr, U64 length);
+
+			/*!
+				\brief The method replaces checks of accesses by a monotonic variable with a single check up of its initial value
+				in the loop's preheader. It's done only if one of the accesses is executed on each path through the body, 
+				otherwise the hoisted check could abort the program which never accesses the array with a negative index
+			*/
+
+			void _hoistBoundsChecks(TLoopInfo& loopInfo, llvm::BasicBlock* pBodyBlock);
+
+			/*!
+				\brief The method returns true if each path from the body's first block reaches pBlock before it leaves the body,
+				i.e. pBlock dominates the latch and all exits of the loop
+			*/
+
+			bool _isExecutedOnEachIteration(const TLoopInfo& loopInfo, llvm::BasicBlock* pBodyBlock, llvm::BasicBlock* pBlock) const;
+
+			/*!
+				\brief The method returns an internal function $bounds_check(index, length) which aborts the program if index >= length
+				(both are treated as unsigned). The function is always inlined, so calls to it don't split basic blocks of the caller
+			*/
+
+			llvm::Function* _getBoundsCheckFunction();
+
+			/*!
+				\brief The method emits str.length. The length of a literal of the module's pool is a constant,
+				strlen is called for other strings, because their origin isn't known
+			*/
+
+			llvm::Value* _emitStringLength(CASTExpressionNode* pStringExpr);
+
+			TInductionVariableInfo _getInductionVariableInfo(CASTWhileLoopStatementNode* pNode) const;
+
+			/*!
+				\brief The method sets LLVM attributes of a function which is defined within the module. Memory effects are
+				inferred by IFunctionAttributesAnalyser, @inline, @noinline and @restrict are specified by a user
+			*/
+
+			void _setFunctionAttributes(llvm::Function* pFunction, CASTFuncDefinitionNode* pNode, const CType* pFuncType, const CFunctionType* pLambdaType);
+
+			/*!
+				\brief The method removes readnone and readonly from functions which contain bounds checks, because a failed check
+				terminates the program. IFunctionAttributesAnalyser doesn't know which checks are elided, so callers of such 
+				functions lose the attributes too
+			*/
+
+			void _removeMemoryAttributesOfCheckedFunctions();
+
+			/*!
+				\brief The method returns a function which is called directly or through a constant pointer of a function
+				which is defined later, nullptr is returned for other indirect calls
+			*/
+
+			llvm::Function* _getCalledFunction(llvm::CallInst* pCall) const;
+
+			/*!
+				\brief The method inserts the latch block of the innermost loop after its body and links it with the header.
+				The back edge is marked with llvm.loop metadata if the loop has hints
+			*/
+
+			void _emitLoopLatch(const TLoopInfo& loopInfo, llvm::BasicBlock* pBodyEndBlock, U32 attributes, const TLoopHints& hints);
+
+			/*!
+				\return The method returns a distinct self referencing llvm.loop node which contains vectorization and
+				unrolling hints, nullptr is returned if there are no hints
+			*/
+
+			llvm::MDNode* _createLoopMetadata(U32 attributes, const TLoopHints& hints);
+
+			/*!
+				\brief The method invalidates facts about induction variables of all enclosing loops. If the name is
+				empty all of them are invalidated, because a store via a pointer or a call can change any variable
+			*/
+
+			void _invalidateInductionVariables(TSymbolHandle variableHandle = InvalidSymbolHandle);
+
+			bool _isIncrementedOnly(CASTNode* pNode, const std::string& name) const;
+
+			/*!
+				\return The method returns a name of an identifier which can be wrapped with unary expressions without operators,
+				an empty string in other cases
+			*/
+
+			std::string _getPlainIdentifierName(CASTNode* pNode) const;
+
+			llvm::Value* _createEntryBlockAlloca(llvm::Type* pType, const std::string& identifier);
+
+			/*!
+				\brief The method marks a start of a local variable's lifetime, its end is marked when the enclosing block is left
+			*/
+
+			void _startScopedLifetime(llvm::Value* pAllocation);
+
+			void _endScopedLifetimes();
+
 			void _defineInitModuleGlobalsFunction();
 
 			void _defineEntryPoint();
@@ -142,7 +354,14 @@ namespace gplc
 
 			inline bool _isGlobalScope() const;
 
-			llvm::BasicBlock* _constructDeferBlock(TExpressionsStack& expressionsStack);
+			/*!
+				\brief The method emits deferred expressions of blocks which are left by an exit edge, starting from the innermost one.
+				Each edge gets its own copy of them, so no extra basic blocks are created
+
+				\param[in] firstScopeIndex An index of the outermost block that is left within mDefferedExpressionsStack
+			*/
+
+			void _emitDeferredExpressions(size_t firstScopeIndex);
 
 			std::string _extractIdentifier(CASTUnaryExpressionNode* pNode) const;
 
@@ -153,6 +372,16 @@ namespace gplc
 			llvm::Value* _emitTypeConversion(CASTTypeNode* pType, CASTUnaryExpressionNode* pExpr);
 
 			llvm::Value* _getStructElementValue(llvm::IRBuilder<>& irBuilder, llvm::Value* pStructValue, I32 index);
+
+			/*!
+				\brief The method returns an address of a field of @soa array's element which is accessed via arr[i].field
+
+				\return A pointer to arr.field[i] or nullptr if pElementExpr isn't an indexed access to @soa array
+			*/
+
+			llvm::Value* _getSoAElementFieldAddress(CASTExpressionNode* pElementExpr, I32 fieldIndex);
+
+			void _initTargetDataLayout();
 		protected:
 			TLLVMLiteralVisitor*     mpLiteralIRGenerator;
 
@@ -174,21 +403,33 @@ namespace gplc
 
 			TValuesTable             mVariablesTable;
 
+			TFunctionsTable          mDirectCalleesTable; ///< \note Functions which are never reassigned, they are called directly without loading a pointer
+
 			llvm::Function*          mpInitModuleGlobalsFunction;
 
 			llvm::IRBuilder<>*       mpInitModuleGlobalsIRBuilder;
 
-			llvm::BasicBlock*        mpLoopConditionBlock;
-
-			llvm::BasicBlock*        mpLoopEndBlock;
-
-			llvm::BasicBlock*        mpLastVisitedEndBlock; ///< \note the field is used to store a pointer to BB when we create conditional branches, loops, etc
+			llvm::BasicBlock*        mpLastVisitedEndBlock; ///< \note the field is used to store a pointer to BB where the code continues after conditional branches, loops and blocks
 
 			IConstExprInterpreter*   mpConstExprInterpreter;
 
 			bool                     mShouldSkipLoopTail;
 
 			TDeferredExpressionStack mDefferedExpressionsStack;
+
+			llvm::BasicBlock*        mpCurrAllocasBlock; ///< \note The entry block of the current function, it contains only allocas
+
+			TScopedAllocasStack      mScopedAllocasStack;
+
+			TConstantsTable          mStructDefaultsTable; ///< \note nullptr is stored for structs which defaults are computed in runtime
+
+			U32                      mFlags = 0x0;
+
+			bool                     mAreBoundsChecksEnabled;
+
+			llvm::Function*          mpBoundsCheckFunction;
+
+			TLoopsArray              mLoopsStack; ///< \note The last element describes the innermost loop
 	};
 }
 
@@ -14,6 +14,7 @@
 
 #include "gplcLinker.h"
 #include "common/gplcTypes.h"
+#include "common/gplcTimeReport.h"
 #include <vector>
 
 
@@ -22,7 +23,11 @@ namespace gplc
 	class CLLVMLinker: public ILinker
 	{
 		public:
-			CLLVMLinker() = default;
+			/*!
+				\param[in] pTimeReport The report gets phases of emission of the object file and the system linker, it can be nullptr
+			*/
+
+			CLLVMLinker(ITimeReport* pTimeReport = nullptr);
 			virtual ~CLLVMLinker() = default;
 
 			Result Link(const std::string& outputFilename, TModulesArray& modulesRegistry, TModuleEntry* pMainModuleDependencies, bool isMainModule = false,
@@ -33,6 +38,8 @@ namespace gplc
 			Result _generateObjectFile(llvm::Module* pModule, const std::string& filename);
 		protected:
 			CLLVMLinker(const CLLVMLinker&) = delete;
+		protected:
+			ITimeReport* mpTimeReport;
 	};
 }
 
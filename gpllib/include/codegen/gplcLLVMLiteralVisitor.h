@@ -15,6 +15,8 @@
 #include "common/gplcTypes.h"
 #include "common/gplcVisitor.h"
 #include "llvm/IR/Module.h"
+#include <unordered_map>
+#include <string>
 
 
 namespace gplc
@@ -29,8 +31,12 @@ namespace gplc
 
 	class CLLVMLiteralVisitor : public ILiteralVisitor<TLLVMIRData>
 	{
+		protected:
+			typedef std::unordered_map<std::string, llvm::Constant*> TStringLiteralsPool;
+
+			typedef std::unordered_map<const llvm::Value*, U64> TStringLiteralsLengths;
 		public:
-			CLLVMLiteralVisitor(llvm::LLVMContext& context, CLLVMCodeGenerator* pCodeGenerator);
+			CLLVMLiteralVisitor(llvm::LLVMContext& context, llvm::Module* pModule, CLLVMCodeGenerator* pCodeGenerator);
 			virtual ~CLLVMLiteralVisitor();
 
 			TLLVMIRData VisitIntLiteral(const CIntValue* pLiteral) override;
@@ -41,13 +47,39 @@ namespace gplc
 			TLLVMIRData VisitStringLiteral(const CStringValue* pLiteral) override;
 			TLLVMIRData VisitBoolLiteral(const CBoolValue* pLiteral) override;
 			TLLVMIRData VisitNullLiteral(const CPointerValue* pLiteral) override;
+
+			/*!
+				\brief The method returns a pointer to the first character of a string literal. All occurrences of
+				the same literal within the module share a single private unnamed_addr constant
+
+				\return The method returns a constant expression of i8* type
+			*/
+
+			llvm::Constant* GetStringLiteral(const std::string& value);
+
+			/*!
+				\brief The method returns the length of a string literal which was created with GetStringLiteral
+
+				\return The method returns nullptr if the value isn't a pointer to a literal of the pool, e.g. it's
+				returned by a foreign function
+			*/
+
+			llvm::Constant* GetStringLiteralLength(const llvm::Value* pString) const;
 		protected:
 			CLLVMLiteralVisitor() = default;
 			CLLVMLiteralVisitor(const CLLVMLiteralVisitor& visitor) = default;
+
+			llvm::GlobalVariable* _createStringLiteralStorage(const std::string& value);
 		protected:
-			CLLVMCodeGenerator* mpCodeGenerator;
+			CLLVMCodeGenerator*    mpCodeGenerator;
+
+			llvm::LLVMContext*     mContext;
+
+			llvm::Module*          mpModule;
+
+			TStringLiteralsPool    mStringLiteralsPool; ///< \note The pool lives as long as the visitor does, the latter is recreated for each module
 
-			llvm::LLVMContext*  mContext;
+			TStringLiteralsLengths mStringLiteralsLengths; ///< \note Lengths are keyed by storages of literals
 	};
 }
 
@@ -0,0 +1,46 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains declaration of an accessor to a LLVM's target machine of a host
+
+	\todo
+*/
+
+#ifndef GPLC_LLVM_TARGET_MACHINE_H
+#define GPLC_LLVM_TARGET_MACHINE_H
+
+
+namespace llvm
+{
+	class TargetMachine;
+}
+
+
+namespace gplc
+{
+	struct TTargetAlignmentsInfo;
+
+
+	/*!
+		\brief The function returns a target machine for the default triple of a host. The machine is created once
+		per process and is shared by the code generator, the linker and the driver, so a compiler's server creates
+		it before it starts serving requests
+
+		\return The function returns nullptr if the host's target isn't registered
+	*/
+
+	llvm::TargetMachine* GetHostTargetMachine();
+
+	/*!
+		\brief The function returns ABI alignments of builtin types which are taken from a data layout of the host's target machine.
+		The alignments are passed into a types factory, so layouts of structures are the same as LLVM computes for them
+
+		\return The function returns alignments of LLVM's default data layout if the host's target isn't registered
+	*/
+
+	TTargetAlignmentsInfo GetHostTargetAlignments();
+}
+
+#endif
@@ -44,6 +44,8 @@ namespace gplc
 		protected:
 			CLLVMTypeVisitor() = default;
 			CLLVMTypeVisitor(const CLLVMTypeVisitor& visitor) = default;
+
+			llvm::Type* _getSoAArrayType(const CArrayType* pArrayType, const CStructType* pElementType);
 		protected:
 			llvm::LLVMContext* mContext;
 
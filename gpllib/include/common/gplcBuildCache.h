@@ -0,0 +1,146 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains definition of a persistent cache of compiled modules
+
+	\todo
+*/
+
+#ifndef GPLC_BUILD_CACHE_H
+#define GPLC_BUILD_CACHE_H
+
+
+#include "common/gplcTypes.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+
+namespace gplc
+{
+	/*!
+		\brief The interface describes an on-disk storage of compiled modules which is addressed by
+		a hash of everything that affects a result of compilation of a module
+	*/
+
+	class IBuildCache
+	{
+		public:
+			typedef std::vector<U8>          TBytesArray;
+
+			typedef std::vector<std::string> TStringsArray;
+
+			/*!
+				\brief The structure contains all inputs of a module's compilation. Imported modules are represented
+				by hashes of their interfaces, so changes of their functions' bodies don't change the key
+			*/
+
+			typedef struct TCacheKeyDesc
+			{
+				std::string   mSourceCode;
+
+				std::string   mCompilerVersion;
+
+				std::string   mOptions;
+
+				TStringsArray mImportsInterfacesHashes;
+			} TCacheKeyDesc, *TCacheKeyDescPtr;
+
+			typedef struct TCacheEntry
+			{
+				TBytesArray mModuleCode;  ///< \note A serialized compiled module, see ICodeGenerator::SaveModule
+
+				TBytesArray mInterface;   ///< \note Exported declarations of the module
+			} TCacheEntry, *TCacheEntryPtr;
+		public:
+			IBuildCache() = default;
+			virtual ~IBuildCache() = default;
+
+			/*!
+				\brief The method opens the cache's directory, it's created if doesn't exist yet
+
+				\param[in] maxSize A size of the cache in bytes, the least recently used entries are evicted
+				when it's exceeded
+			*/
+
+			virtual Result Init(const std::string& cacheDirectory, U64 maxSize) = 0;
+
+			virtual std::string ComputeKey(const TCacheKeyDesc& keyDesc) const = 0;
+
+			/*!
+				\brief The method reads an entry and marks it as the most recently used one
+
+				\return The method returns RV_FILE_NOT_FOUND if there is no valid entry for the key
+			*/
+
+			virtual Result Load(const std::string& key, TCacheEntry& entry) = 0;
+
+			virtual Result Store(const std::string& key, const TCacheEntry& entry) = 0;
+
+			virtual U64 GetSize() const = 0;
+		protected:
+			IBuildCache(const IBuildCache&) = delete;
+	};
+
+
+	/*!
+		\brief Every entry is stored in its own file named after the key. Modification times of the files
+		are used as access times, so the order of eviction survives between runs of the compiler
+	*/
+
+	class CBuildCache : public IBuildCache
+	{
+		protected:
+			typedef struct TEntryInfo
+			{
+				U64 mSize;
+
+				I64 mLastAccessTime;
+			} TEntryInfo, *TEntryInfoPtr;
+
+			typedef std::unordered_map<std::string, TEntryInfo> TEntriesTable;
+		public:
+			CBuildCache() = default;
+			virtual ~CBuildCache() = default;
+
+			Result Init(const std::string& cacheDirectory, U64 maxSize) override;
+
+			std::string ComputeKey(const TCacheKeyDesc& keyDesc) const override;
+
+			Result Load(const std::string& key, TCacheEntry& entry) override;
+
+			Result Store(const std::string& key, const TCacheEntry& entry) override;
+
+			U64 GetSize() const override;
+		protected:
+			CBuildCache(const CBuildCache&) = delete;
+
+			std::string _getEntryPath(const std::string& key) const;
+
+			void _touchEntry(const std::string& key);
+
+			/*!
+				\brief The method removes the least recently used entries until the size of the cache fits into the limit
+			*/
+
+			void _evictEntries();
+		protected:
+			static const C8* mEntryFileExtension;
+
+			static const U32 mEntrySignature;
+
+			static const U32 mEntryFormatVersion;
+
+			std::string      mCacheDirectory;
+
+			U64              mMaxSize = 0;
+
+			U64              mCurrSize = 0;
+
+			TEntriesTable    mEntries;
+	};
+}
+
+#endif
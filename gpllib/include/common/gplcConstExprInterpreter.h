@@ -3,8 +3,8 @@
 	\date   02.08.2019
 	\copyright
 
-	\brief The file contains implementation of interpreter of constant expression that
-	is used to compute array size in compile time
+	\brief The file contains implementation of interpreter of constant expressions that
+	is used to compute array sizes, enumerators' values and other compile time constants
 
 	\todo
 */
@@ -15,29 +15,94 @@
 #include "gplcTypes.h"
 #include "gplcVisitor.h"
 #include "utils/CResult.h"
+#include "utils/Delegate.h"
+#include <variant>
+#include <vector>
+#include <unordered_map>
 
 
 namespace gplc
 {
 	class ISymTable;
+	class ITypeResolver;
 	class CASTExpressionNode;
 
 
+	/*!
+		\brief The structure represents a typed value which is computed in compile time.
+
+		Signed integers are stored as I64, unsigned ones as U64, mType specifies their actual width.
+		Both float and double values are stored as F64, float ones are rounded after each operation
+	*/
+
+	struct TConstValue
+	{
+		E_COMPILER_TYPES                  mType;
+
+		std::variant<I64, U64, F64, bool> mValue;
+	};
+
+
 	class IConstExprInterpreter : public IASTNodeVisitor<TLLVMIRData>
 	{
 		public:
+			virtual Result Init(ITypeResolver* pTypeResolver) = 0;
+
+			/*!
+				\brief The method evaluates an integral constant expression
+
+				\return An error is returned if the expression can't be evaluated in compile time
+			*/
+
 			virtual TResult<U32> Eval(CASTExpressionNode* pExpr, ISymTable* pSymTable) = 0;
+
+			/*!
+				\brief The method evaluates a constant expression of any arithmetic or logical type.
+				Division by zero and overflows are reported through OnErrorOutput
+
+				\return An error is returned if the expression can't be evaluated in compile time
+			*/
+
+			virtual TResult<TConstValue> EvalValue(CASTExpressionNode* pExpr, ISymTable* pSymTable) = 0;
+		public:
+			CDelegate<void, const TSemanticAnalyserMessageInfo&> OnErrorOutput;
 	};
 
 
 	class CConstExprInterpreter : public IConstExprInterpreter
 	{
+		protected:
+			/*!
+				\brief The values are returned by visitor's methods, a value of an evaluated expression is stored in mCurrValue
+			*/
+
+			enum E_EVAL_STATUS : U32
+			{
+				ES_SUCCESS,
+				ES_BREAK,
+				ES_CONTINUE,
+				ES_RETURN,
+				ES_NOT_CONSTANT, ///< The node can't be evaluated in compile time
+				ES_ERROR,        ///< Division by zero or overflow has happened, the error is already reported
+			};
+
+			typedef std::unordered_map<std::string, TConstValue> TCallFrame;
+
+			typedef std::vector<TCallFrame> TCallFramesArray;
 		public:
 			CConstExprInterpreter() = default;
 			virtual ~CConstExprInterpreter() = default;
 
+			/*!
+				\brief The method is optional to call, without a type resolver sizeof, typeid, casts and local variables can't be evaluated
+			*/
+
+			Result Init(ITypeResolver* pTypeResolver) override;
+
 			TResult<U32> Eval(CASTExpressionNode* pExpr, ISymTable* pSymTable) override;
 
+			TResult<TConstValue> EvalValue(CASTExpressionNode* pExpr, ISymTable* pSymTable) override;
+
 			TLLVMIRData VisitProgramUnit(CASTSourceUnitNode* pProgramNode) override;
 
 			TLLVMIRData VisitDeclaration(CASTDeclarationNode* pNode) override;
@@ -98,8 +163,33 @@ namespace gplc
 
 			TLLVMIRData VisitVariantDeclaration(CASTVariantDeclNode* pNode) override;
 		protected:
-			ISymTable* mpSymTable;
+			E_EVAL_STATUS _evalNode(CASTNode* pNode);
+
+			E_EVAL_STATUS _evalArithmeticOp(E_TOKEN_TYPE opType, const TConstValue& left, const TConstValue& right);
+
+			E_EVAL_STATUS _evalComparisonOp(E_TOKEN_TYPE opType, const TConstValue& left, const TConstValue& right);
+
+			/*!
+				\brief The method converts mCurrValue into a given type. Implicit conversions report
+				an overflow if the value doesn't fit into the type, explicit ones truncate it
+			*/
+
+			E_EVAL_STATUS _convertCurrValue(E_COMPILER_TYPES type, bool isExplicit = false);
+
+			E_EVAL_STATUS _notifyError(E_SEMANTIC_ANALYSER_MESSAGE message) const;
+
+			TCallFrame* _getCurrCallFrame();
+		protected:
+			ISymTable*       mpSymTable     = nullptr;
+
+			ITypeResolver*   mpTypeResolver = nullptr;
+
+			TConstValue      mCurrValue;
+
+			TCallFramesArray mCallFrames;
+
+			U32              mStepsCount    = 0;
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
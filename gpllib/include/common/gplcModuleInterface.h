@@ -0,0 +1,248 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains definition of a binary format of modules' interfaces (.gpli files)
+
+	\todo
+*/
+
+#ifndef GPLC_MODULE_INTERFACE_H
+#define GPLC_MODULE_INTERFACE_H
+
+
+#include "common/gplcTypes.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+
+namespace llvm
+{
+	class MemoryBuffer;
+}
+
+
+namespace gplc
+{
+	class ISymTable;
+	class ITypesFactory;
+	class IASTNodesFactory;
+	class IConstExprInterpreter;
+	class CType;
+	class CBaseValue;
+	struct TConstValue;
+
+
+	/*!
+		\brief The structure contains a header of an interface, it's enough to decide whether the interface
+		is up to date without loading its symbols
+	*/
+
+	typedef struct TModuleInterfaceInfo
+	{
+		typedef struct TImportInfo
+		{
+			std::string mModulePath;
+
+			std::string mModuleName;
+
+			std::string mInterfaceHash; ///< \note A hash of the imported module's interface at the moment the interface was written
+		} TImportInfo, *TImportInfoPtr;
+
+		typedef std::vector<TImportInfo> TImportsArray;
+
+		U64           mSourceSize             = 0;
+
+		I64           mSourceModificationTime = 0;
+
+		std::string   mCodeKey;       ///< \note A key of the module's code within the build cache, it's empty if the cache isn't used
+
+		std::string   mBuildOptions;  ///< \note Options which the code was compiled with, the code can't be reused if they're changed
+
+		std::string   mInterfaceHash; ///< \note A hash of exported symbols, it doesn't change if only bodies of functions are changed
+
+		TImportsArray mImports;
+	} TModuleInterfaceInfo, *TModuleInterfaceInfoPtr;
+
+
+	/*!
+		\brief The interface describes a serializer of a module's named scope. Exported symbols, graphs
+		of their types, values of enumerators and fields of structures with their constant defaults are written
+	*/
+
+	class IModuleInterfaceWriter
+	{
+		public:
+			typedef std::vector<U8> TBytesArray;
+		public:
+			IModuleInterfaceWriter() = default;
+			virtual ~IModuleInterfaceWriter() = default;
+
+			/*!
+				\brief The method should be called after the module's semantic analysis from a scope where
+				the module's named scope is visible
+
+				\param[in, out] info The header of the interface, its mInterfaceHash is computed by the method
+
+				\return The method returns RV_SUCCESS if the interface was written into the output array
+			*/
+
+			virtual Result Write(ISymTable* pSymTable, IConstExprInterpreter* pInterpreter, const std::string& moduleName, TModuleInterfaceInfo& info,
+								 TBytesArray& output) = 0;
+		protected:
+			IModuleInterfaceWriter(const IModuleInterfaceWriter&) = delete;
+	};
+
+
+	/*!
+		\brief The interface describes a reader of .gpli files. Open maps a file and reads its header only,
+		types are decoded when a symbol which refers to them is loaded
+	*/
+
+	class IModuleInterfaceReader
+	{
+		public:
+			typedef std::vector<U8> TBytesArray;
+		public:
+			IModuleInterfaceReader() = default;
+			virtual ~IModuleInterfaceReader() = default;
+
+			virtual Result Open(const std::string& filename) = 0;
+
+			virtual Result Open(const TBytesArray& data) = 0;
+
+			virtual const TModuleInterfaceInfo& GetInfo() const = 0;
+
+			/*!
+				\brief The method attaches the module's symbols to the current scope of the table, which should be
+				the module's named scope. A symbol is declared on its first lookup, so the reader should live as long
+				as the table does
+			*/
+
+			virtual Result Load(ISymTable* pSymTable, ITypesFactory* pTypesFactory, IASTNodesFactory* pNodesFactory) = 0;
+		protected:
+			IModuleInterfaceReader(const IModuleInterfaceReader&) = delete;
+	};
+
+
+	class CModuleInterfaceWriter : public IModuleInterfaceWriter
+	{
+		protected:
+			typedef std::unordered_map<const CType*, U32> TTypesIndicesTable;
+
+			typedef std::vector<TBytesArray>              TTypesRecordsArray;
+		public:
+			CModuleInterfaceWriter() = default;
+			virtual ~CModuleInterfaceWriter() = default;
+
+			Result Write(ISymTable* pSymTable, IConstExprInterpreter* pInterpreter, const std::string& moduleName, TModuleInterfaceInfo& info,
+						 TBytesArray& output) override;
+		protected:
+			CModuleInterfaceWriter(const CModuleInterfaceWriter&) = delete;
+
+			template <typename TScopeEntry>
+			Result _writeScope(const TScopeEntry* pScopeEntry, const std::string& scopeName, TBytesArray& output);
+
+			/*!
+				\return The method returns an index of the type within the types table, the type is appended if it's not there yet
+			*/
+
+			U32 _getTypeIndex(const CType* pType);
+		protected:
+			ISymTable*             mpSymTable    = nullptr;
+
+			IConstExprInterpreter* mpInterpreter = nullptr;
+
+			std::string            mModuleName;
+
+			TTypesIndicesTable     mTypesIndices;
+
+			TTypesRecordsArray     mTypesRecords;
+	};
+
+
+	class CModuleInterfaceReader : public IModuleInterfaceReader
+	{
+		protected:
+			enum E_TYPE_STATE : U8
+			{
+				TS_NOT_DECODED,
+				TS_DECODING,   ///< \note The state is used to detect cycles within malformed files
+				TS_DECODED,
+			};
+
+			typedef std::vector<U32>          TOffsetsArray;
+
+			typedef std::vector<CType*>       TTypesArray;
+
+			typedef std::vector<E_TYPE_STATE> TTypesStatesArray;
+
+			typedef std::unordered_map<std::string, U64> TSymbolsOffsetsTable;
+		public:
+			CModuleInterfaceReader();
+			virtual ~CModuleInterfaceReader();
+
+			Result Open(const std::string& filename) override;
+
+			Result Open(const TBytesArray& data) override;
+
+			const TModuleInterfaceInfo& GetInfo() const override;
+
+			Result Load(ISymTable* pSymTable, ITypesFactory* pTypesFactory, IASTNodesFactory* pNodesFactory) override;
+		protected:
+			CModuleInterfaceReader(const CModuleInterfaceReader&) = delete;
+
+			Result _readHeader();
+
+			/*!
+				\brief The method collects offsets of symbols of the module's scope without decoding them
+			*/
+
+			Result _indexScope(U64 offset);
+
+			Result _loadSymbol(const std::string& name);
+
+			Result _loadScope(U64& offset);
+
+			Result _loadVariable(U64& offset);
+
+			Result _loadNamedScope(U64& offset);
+
+			/*!
+				\brief The method creates a literal of the value which is read from the interface, e.g. a value of an enumerator
+			*/
+
+			CBaseValue* _createLiteralValue(const TConstValue& value) const;
+
+			CType* _getType(U32 index);
+
+			CType* _decodeType(U64 offset);
+		protected:
+			std::unique_ptr<llvm::MemoryBuffer> mpBuffer;
+
+			TModuleInterfaceInfo                mInfo;
+
+			U64                                 mBodyOffset;
+
+			TOffsetsArray                       mTypesOffsets;
+
+			TTypesArray                         mTypes;
+
+			TTypesStatesArray                   mTypesStates;
+
+			TSymbolsOffsetsTable                mVariablesOffsets;    ///< \note Offsets of symbols which aren't declared yet
+
+			TSymbolsOffsetsTable                mNamedScopesOffsets;
+
+			ISymTable*                          mpSymTable;
+
+			ITypesFactory*                      mpTypesFactory;
+
+			IASTNodesFactory*                   mpNodesFactory;
+	};
+}
+
+#endif
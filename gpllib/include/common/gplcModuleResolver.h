@@ -12,10 +12,12 @@
 
 
 #include "gplcTypes.h"
+#include "gplcModuleInterface.h"
 #include <string>
 #include <functional>
 #include <unordered_map>
 #include <vector>
+#include <memory>
 
 
 namespace gplc
@@ -25,6 +27,8 @@ namespace gplc
 	class CASTNode;
 	class CASTImportDirectiveNode;
 	class ITypesFactory;
+	class IASTNodesFactory;
+	class IConstExprInterpreter;
 	class ILinker;
 
 
@@ -32,6 +36,13 @@ namespace gplc
 	{
 		public:
 			typedef std::function<Result (const std::string&, const std::string&, TLLVMIRData&)> TOnCompileCallback;
+
+			/*!
+				\brief The callback should return a compiled code of a module whose interface is up to date, if it fails
+				the module is compiled from its source
+			*/
+
+			typedef std::function<Result (const std::string&, const TModuleInterfaceInfo&, TLLVMIRData&)> TOnLoadCallback;
 	
 			typedef struct TModuleEntry
 			{
@@ -41,6 +52,8 @@ namespace gplc
 
 				TDependenciesArray mDependencies;
 
+				std::string        mModulePath; ///< \note A full path of the module's source, it's empty for input files which are compiled by a driver
+
 			} TModuleEntry, *TModuleEntryPtr;
 
 			typedef struct TCompiledModuleData
@@ -57,15 +70,61 @@ namespace gplc
 			IModuleResolver() = default;
 			virtual ~IModuleResolver() = default;
 
-			virtual Result Resolve(CASTSourceUnitNode* pModuleAST, ISymTable* pSymTable, ITypesFactory* pTypesFactory, const std::string& currentWorkinDir,
-								   const TOnCompileCallback& onCompileModule) = 0;
+			virtual Result Resolve(CASTSourceUnitNode* pModuleAST, ISymTable* pSymTable, ITypesFactory* pTypesFactory, IASTNodesFactory* pNodesFactory,
+								   const std::string& currentWorkinDir, const TOnCompileCallback& onCompileModule, const TOnLoadCallback& onLoadModule = nullptr) = 0;
+
+			/*!
+				\brief The method declares a module from its interface within the current scope of the table without
+				parsing the module's source. Imports of the module are resolved in the same way as by Resolve
+
+				\return The method returns RV_FAIL if the interface isn't up to date or the module's code isn't available,
+				the module should be compiled from its source then
+			*/
+
+			virtual Result ResolveFromInterface(ISymTable* pSymTable, ITypesFactory* pTypesFactory, IASTNodesFactory* pNodesFactory, const std::string& currentWorkinDir,
+												const std::string& sourceFilename, const std::string& moduleName, const TOnCompileCallback& onCompileModule,
+												const TOnLoadCallback& onLoadModule) = 0;
 
 			virtual void ResolveModuleType(ISymTable* pSymTable, ITypesFactory* pTypesFactory, const std::string& moduleName) = 0;
 
+			/*!
+				\brief The method writes the size and the modification time of a module's source into the header of its interface
+
+				\return The method returns RV_FILE_NOT_FOUND if the source's attributes can't be read
+			*/
+
+			virtual Result TakeSourceStamp(const std::string& sourceFilename, TModuleInterfaceInfo& info) const = 0;
+
+			/*!
+				\brief The method writes an interface of an analysed module next to its source (<module>.gpli), so
+				importers of the module skip its parsing and analysis while the interface is up to date
+
+				\param[in] info The header of the interface, mCodeKey and mBuildOptions should be filled by a caller. The source's
+				stamp should be taken with TakeSourceStamp before the source is read, so changes which are made during the module's
+				compilation make the interface stale
+
+				\param[out] interfaceData The written interface
+			*/
+
+			virtual Result SaveModuleInterface(ISymTable* pSymTable, IConstExprInterpreter* pInterpreter, CASTSourceUnitNode* pModuleAST,
+											   const std::string& sourceFilename, TModuleInterfaceInfo info, std::vector<U8>& interfaceData) = 0;
+
 			virtual Result Link(const std::string& outputFilename, ILinker* pLinker, bool skipFinalLinking = false) = 0;
 
 			virtual TCompiledModuleData& GetModuleEntry(const std::string& moduleName) = 0;
 
+			/*!
+				\return The method returns the main module's entry, the graph contains all modules which were resolved within the session
+			*/
+
+			virtual const TModuleEntry& GetDependencyGraph() const = 0;
+
+			/*!
+				\return The method returns a hash of the module's interface or an empty string if the module has no interface
+			*/
+
+			virtual std::string GetModuleInterfaceHash(const std::string& moduleName) const = 0;
+
 			virtual void DumpDependencyGraph() const = 0;
 		protected:
 			IModuleResolver(const IModuleResolver&) = delete;
@@ -74,37 +133,81 @@ namespace gplc
 
 	class CModuleResolver: public IModuleResolver
 	{
+		protected:
+			typedef std::unordered_map<std::string, std::string> TInterfacesHashesTable;
+
+			typedef std::vector<std::unique_ptr<IModuleInterfaceReader>> TInterfacesReadersArray;
 		public:
 			CModuleResolver();
 			virtual ~CModuleResolver() = default;
 
-			Result Resolve(CASTSourceUnitNode* pModuleAST, ISymTable* pSymTable, ITypesFactory* pTypesFactory, const std::string& currentWorkinDir,
-						   const TOnCompileCallback& onCompileModule) override;
+			Result Resolve(CASTSourceUnitNode* pModuleAST, ISymTable* pSymTable, ITypesFactory* pTypesFactory, IASTNodesFactory* pNodesFactory,
+						   const std::string& currentWorkinDir, const TOnCompileCallback& onCompileModule, const TOnLoadCallback& onLoadModule = nullptr) override;
+
+			Result ResolveFromInterface(ISymTable* pSymTable, ITypesFactory* pTypesFactory, IASTNodesFactory* pNodesFactory, const std::string& currentWorkinDir,
+										const std::string& sourceFilename, const std::string& moduleName, const TOnCompileCallback& onCompileModule,
+										const TOnLoadCallback& onLoadModule) override;
 
 			void ResolveModuleType(ISymTable* pSymTable, ITypesFactory* pTypesFactory, const std::string& moduleName) override;
 
+			Result TakeSourceStamp(const std::string& sourceFilename, TModuleInterfaceInfo& info) const override;
+
+			Result SaveModuleInterface(ISymTable* pSymTable, IConstExprInterpreter* pInterpreter, CASTSourceUnitNode* pModuleAST,
+									   const std::string& sourceFilename, TModuleInterfaceInfo info, std::vector<U8>& interfaceData) override;
+
 			Result Link(const std::string& outputFilename, ILinker* pLinker, bool skipFinalLinking = false) override;
 
 			TCompiledModuleData& GetModuleEntry(const std::string& moduleName) override;
 
+			const TModuleEntry& GetDependencyGraph() const override;
+
+			std::string GetModuleInterfaceHash(const std::string& moduleName) const override;
+
 			void DumpDependencyGraph() const override;
 		protected:
 			CModuleResolver(const CModuleResolver&) = delete;
 
+			/*!
+				\return The method returns an entry of the dependency graph for a module which is compiled on a driver's demand
+			*/
+
+			TModuleEntry* _pushTopLevelModule(const std::string& moduleName);
+
 			Result _visitNode(CASTNode* pNode);
 
-			Result _resolveImport(CASTImportDirectiveNode* pNode);
+			Result _resolveImport(const std::string& modulePath, const std::string& moduleName);
+
+			/*!
+				\brief The method declares symbols of the module from its interface within the current scope
+
+				\return The method returns RV_FAIL if the interface is stale or the module's code isn't available
+			*/
+
+			Result _loadModuleInterface(const std::string& moduleFullPath, const std::string& moduleName, TLLVMIRData& compiledModuleData);
+
+			/*!
+				\brief The interface is up to date if the module's source isn't changed since it was written and
+				interfaces of all its imports are the same which the module was compiled against
+			*/
+
+			bool _isInterfaceUpToDate(const std::string& moduleFullPath, IModuleInterfaceReader* pReader) const;
+
+			std::string _getModuleFullPath(const std::string& modulePath) const;
 			
 			void _printDependencyGraphLevel(const TModuleEntry* pCurrModuleEntry, U32 currLevel = 0) const;
 		protected:
 			static std::string mFileExtension;
 
+			static std::string mInterfaceFileExtension;
+
 			ISymTable*         mpSymTable;
 
 			std::string        mCurrentWorkingDir;
 
 			TOnCompileCallback mOnCompileModuleCallback;
 
+			TOnLoadCallback    mOnLoadModuleCallback;
+
 			TModuleEntry       mRootModuleDeps;
 
 			TModuleEntry*      mpCurrVisitingModule;
@@ -112,6 +215,12 @@ namespace gplc
 			TModulesArray      mModulesRegistry;
 
 			ITypesFactory*     mpTypesFactory;
+
+			IASTNodesFactory*  mpNodesFactory;
+
+			TInterfacesHashesTable mInterfacesHashes; ///< \note Hashes of interfaces of modules which are resolved within the session
+
+			TInterfacesReadersArray mInterfacesReaders; ///< \note Symbols of loaded modules are read on demand, so their files are kept opened
 	};
 }
 
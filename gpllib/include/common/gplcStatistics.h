@@ -0,0 +1,90 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains definition of a registry of named counters which are updated by subsystems of the compiler
+
+	\todo
+*/
+
+#ifndef GPLC_STATISTICS_H
+#define GPLC_STATISTICS_H
+
+
+#include "common/gplcTypes.h"
+#include <string>
+#include <map>
+
+
+namespace gplc
+{
+	/*!
+		\brief The registry is disabled by default, updates of counters cost a single check of a flag then. The registry isn't
+		synchronized, since all modules are compiled on the same thread
+
+		Counters are grouped by subsystems which update them, e.g. ("lexer", "tokens 'identifier'")
+	*/
+
+	class CStatistics
+	{
+		public:
+			typedef std::map<std::string, U64>           TCountersMap;
+
+			typedef std::map<std::string, TCountersMap> TCountersGroupsMap;
+		public:
+			static void SetEnabled(bool isEnabled);
+
+			static inline bool IsEnabled()
+			{
+				return mIsEnabled;
+			}
+
+			static void Add(const std::string& group, const std::string& name, U64 value = 1);
+
+			/*!
+				\brief The method stores the value if it's greater than the counter's one
+			*/
+
+			static void UpdateMax(const std::string& group, const std::string& name, U64 value);
+
+			static U64 GetValue(const std::string& group, const std::string& name);
+
+			static const TCountersGroupsMap& GetCounters();
+
+			static void Reset();
+
+			/*!
+				\return The method returns a table of all counters sorted by their groups and names
+			*/
+
+			static std::string ToString();
+		protected:
+			static bool               mIsEnabled;
+
+			static TCountersGroupsMap mCounters;
+	};
+
+
+	/*!
+		\brief The macros don't evaluate their arguments if the statistics is disabled, so names of counters can be built in place
+	*/
+
+	#define GPLC_STATISTIC_ADD(group, name, value) \
+			do { \
+				if (gplc::CStatistics::IsEnabled()) \
+				{ \
+					gplc::CStatistics::Add((group), (name), (value)); \
+				} \
+			} while (0)
+
+	#define GPLC_STATISTIC_MAX(group, name, value) \
+			do { \
+				if (gplc::CStatistics::IsEnabled()) \
+				{ \
+					gplc::CStatistics::UpdateMax((group), (name), (value)); \
+				} \
+			} while (0)
+}
+
+#endif
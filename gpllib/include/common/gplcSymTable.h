@@ -13,6 +13,7 @@
 
 #include "gplcTypes.h"
 #include <vector>
+#include <deque>
 #include <unordered_map>
 #include <functional>
 #include "utils/CResult.h"
@@ -21,6 +22,7 @@
 namespace gplc
 {
 	class CASTExpressionNode;
+	class CASTFuncDefinitionNode;
 	class CType;
 
 
@@ -42,6 +44,12 @@ namespace gplc
 		CASTExpressionNode* mpValue;
 
 		CType*              mpType;
+
+		CASTFuncDefinitionNode* mpFuncDefinition = nullptr; ///< \note It's set for functions defined within the source code, so they can be evaluated in compile time
+
+		bool                mIsReassigned    = false;   ///< \note It's set for functions which are assigned or whose address is taken, only they are called through a pointer
+
+		bool                mIsConstant      = false;   ///< \note It's set for enumerators, only values of such symbols can be evaluated in compile time
 	};
 
 
@@ -58,10 +66,17 @@ namespace gplc
 
 			typedef std::unordered_map<std::string, TSymTableEntry*> TNamedScopesMap;
 
-			typedef std::vector<std::pair<bool, TSymbolDesc>>        TSymbolsArray;
+			typedef std::deque<std::pair<bool, TSymbolDesc>>         TSymbolsArray; ///< \note The deque keeps descriptors in place when symbols are added during a lookup
 
 			typedef std::function<void(ISymTable*)>                  TSymTableTransactionCallback;
 
+			/*!
+				\brief The loader should declare a symbol or a named scope with the given name within the current scope of
+				the table. It returns RV_FAIL if there is no such symbol
+			*/
+
+			typedef std::function<Result(ISymTable*, const std::string&)> TLazySymbolsLoader;
+
 			/*!
 				\brief The TSymTableEntry structure
 			*/
@@ -79,9 +94,13 @@ namespace gplc
 				CType*                       mpType;	///< A type of a named scope, equals to nullptr for unnamed scopes
 
 				I32                          mScopeIndex;
+
+				TLazySymbolsLoader           mLazySymbolsLoader; ///< \note It's set for scopes of imported modules, their symbols are declared on first lookup
 			};
 
 		public:
+			typedef const TSymTableEntry* TScopeHandle; ///< \note It's an opaque handle of a scope, see GetCurrentScopeHandle
+
 			ISymTable();
 			virtual ~ISymTable();
 
@@ -100,12 +119,33 @@ namespace gplc
 			*/
 
 			virtual Result VisitNamedScopeWithRestore(const std::string& scopeName, const TSymTableTransactionCallback& transaction) = 0;
+
+			/*!
+				\brief The method works the same as VisitNamedScopeWithRestore, but enters a scope which was the current one
+				when its handle was got. It's used to resolve names of an expression which is evaluated later, e.g. a deferred one
+			*/
+
+			virtual Result VisitScopeWithRestore(TScopeHandle scopeHandle, const TSymTableTransactionCallback& transaction) = 0;
 			virtual Result VisitScope() = 0;
 
+			/*!
+				\brief The method removes an unnamed scope which would be entered with the next VisitScope call.
+				It's used when a block of statements is eliminated from AST after the semantic analysis
+			*/
+
+			virtual Result RemoveScope() = 0;
+
 			virtual Result LeaveScope() = 0;
 
 			virtual TSymbolHandle AddVariable(const TSymbolDesc& typeDesc) = 0;
 
+			/*!
+				\brief The method attaches the loader to the current scope. LookUp, LookUpNamedScope and VisitNamedScope
+				call it when the scope doesn't contain a requested name yet
+			*/
+
+			virtual Result SetLazySymbolsLoader(const TLazySymbolsLoader& loader) = 0;
+
 			virtual const TSymbolDesc* LookUp(const std::string& variableName) const = 0;
 			virtual TSymbolDesc* LookUp(TSymbolHandle symbolHandle) = 0;
 			virtual const TSymbolDesc* LookUp(TSymbolHandle symbolHandle) const = 0;
@@ -121,6 +161,17 @@ namespace gplc
 			virtual CType* GetParentScopeType() const = 0;
 			virtual CType* GetCurrentScopeType() const = 0;
 
+			virtual TScopeHandle GetCurrentScopeHandle() const = 0;
+
+			/*!
+				\brief The method returns a handle of a scope where a symbol, which is visible from the current scope, is declared.
+				The handle is passed into VisitScopeWithRestore to resolve names as they're resolved at the symbol's definition
+
+				\return The method returns nullptr if there is no symbol with the given name
+			*/
+
+			virtual TScopeHandle GetSymbolScopeHandle(const std::string& variableName) const = 0;
+
 			virtual void DumpScopesStructure() const = 0;
 		protected:
 			ISymTable(const ISymTable& table);
@@ -146,11 +197,16 @@ namespace gplc
 
 			Result VisitNamedScope(const std::string& scopeName) override;
 			Result VisitNamedScopeWithRestore(const std::string& scopeName, const TSymTableTransactionCallback& transaction) override;
+			Result VisitScopeWithRestore(TScopeHandle scopeHandle, const TSymTableTransactionCallback& transaction) override;
 			Result VisitScope() override;
 
+			Result RemoveScope() override;
+
 			Result LeaveScope() override;
 
 			TSymbolHandle AddVariable(const TSymbolDesc& typeDesc) override;
+
+			Result SetLazySymbolsLoader(const TLazySymbolsLoader& loader) override;
 			
 			const TSymbolDesc* LookUp(const std::string& variableName) const override;
 			TSymbolDesc* LookUp(TSymbolHandle symbolHandle) override;
@@ -167,13 +223,27 @@ namespace gplc
 			CType* GetParentScopeType() const override;
 			CType* GetCurrentScopeType() const override;
 
+			TScopeHandle GetCurrentScopeHandle() const override;
+
+			TScopeHandle GetSymbolScopeHandle(const std::string& variableName) const override;
+
 			void DumpScopesStructure() const override;
 		protected:
 			CSymTable(const CSymTable& table);
 
 			bool _internalLookUp(TSymTableEntry* entry, const std::string& variableName) const;
 
-			TSymbolHandle _lookUp(TSymTableEntry* entry, const std::string& variableName) const;
+			TSymbolHandle _lookUp(TSymTableEntry* entry, const std::string& variableName, TSymTableEntry** ppFoundEntry = nullptr) const;
+
+			TSymTableEntry* _findNamedScope(TSymTableEntry* pEntry, const std::string& scopeName) const;
+
+			/*!
+				\brief The method runs a lazy loader of the scope, the table's state is restored after that
+
+				\return The method returns true if the loader has declared the symbol
+			*/
+
+			bool _materializeSymbol(TSymTableEntry* pEntry, const std::string& name) const;
 
 			void _removeScope(TSymTableEntry** scope);
 		protected:
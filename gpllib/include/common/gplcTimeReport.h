@@ -0,0 +1,174 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains definition of a report about time and memory which are spent by phases of the compiler
+
+	\todo
+*/
+
+#ifndef GPLC_TIME_REPORT_H
+#define GPLC_TIME_REPORT_H
+
+
+#include "common/gplcTypes.h"
+#include <string>
+#include <vector>
+#include <chrono>
+#include <ctime>
+
+
+namespace gplc
+{
+	/*!
+		\brief The interface describes a tree of measured phases. Phases are nested in the same way as calls which
+		execute them, so a phase of an imported module lies within the module resolution's phase of its importer
+	*/
+
+	class ITimeReport
+	{
+		public:
+			typedef struct TPhaseInfo
+			{
+				std::string             mName;
+
+				F64                     mStartTime = 0.0; ///< \note The time is specified in milliseconds since the report's creation
+
+				F64                     mWallTime  = 0.0; ///< \note The time is specified in milliseconds
+
+				F64                     mCPUTime   = 0.0; ///< \note The time is specified in milliseconds
+
+				U64                     mPeakRSS   = 0;   ///< \note Peak resident set size of the whole process in kilobytes at the end of the phase
+
+				U64                     mPeakRSSGrowth = 0; ///< \note Kilobytes by which the phase raised the process's peak, it's zero if an earlier phase reached more
+
+				std::vector<TPhaseInfo> mChildren;
+			} TPhaseInfo, *TPhaseInfoPtr;
+		public:
+			ITimeReport() = default;
+			virtual ~ITimeReport() = default;
+
+			/*!
+				\brief The method starts a new phase within the current one
+			*/
+
+			virtual void BeginPhase(const std::string& name) = 0;
+
+			/*!
+				\brief The method finishes the current phase, the method does nothing if there is no started phase
+			*/
+
+			virtual void EndPhase() = 0;
+
+			/*!
+				\return The method returns a phase which contains all others, it's finished only when the report is printed
+			*/
+
+			virtual const TPhaseInfo& GetRootPhase() = 0;
+
+			/*!
+				\return The method returns a table of phases where nested phases are indented
+			*/
+
+			virtual std::string ToString() = 0;
+
+			virtual std::string ToJSON() = 0;
+
+			/*!
+				\brief The method converts phases into events of Chrome's trace event format, the result can be loaded
+				into chrome://tracing or Perfetto
+
+				\return The method returns a JSON object with an array of complete events, one per phase
+			*/
+
+			virtual std::string ToTraceEvents() = 0;
+		protected:
+			ITimeReport(const ITimeReport&) = delete;
+	};
+
+
+	class CTimeReport: public ITimeReport
+	{
+		public:
+			typedef std::chrono::steady_clock TClock;
+		public:
+			explicit CTimeReport(const std::string& rootPhaseName);
+			virtual ~CTimeReport() = default;
+
+			void BeginPhase(const std::string& name) override;
+
+			void EndPhase() override;
+
+			const TPhaseInfo& GetRootPhase() override;
+
+			std::string ToString() override;
+
+			std::string ToJSON() override;
+
+			std::string ToTraceEvents() override;
+		protected:
+			CTimeReport(const CTimeReport&) = delete;
+
+			void _updateRootPhase();
+
+			F64 _getElapsedTime(TClock::time_point time) const;
+
+			F64 _getCPUTime(std::clock_t time) const;
+
+			static U64 _getPeakRSS();
+
+			static void _printPhase(std::string& output, const TPhaseInfo& phase, U32 level);
+
+			static void _writePhaseJSON(std::string& output, const TPhaseInfo& phase);
+
+			static void _writePhaseTraceEvents(std::string& output, const TPhaseInfo& phase);
+
+			static void _writeEscapedString(std::string& output, const std::string& value);
+		protected:
+			typedef struct TActivePhase
+			{
+				TPhaseInfo*       mpPhase;
+
+				std::clock_t      mStartCPUTime;
+
+				U64               mStartPeakRSS;
+			} TActivePhase, *TActivePhasePtr;
+
+			TClock::time_point        mStartTime;
+
+			std::clock_t              mStartCPUTime;
+
+			U64                       mStartPeakRSS;
+
+			TPhaseInfo                mRootPhase;
+
+			std::vector<TActivePhase> mActivePhases;
+	};
+
+
+	/*!
+		\brief The class measures a phase within its lifetime, it does nothing if there is no report
+	*/
+
+	class CTimeReportScope
+	{
+		public:
+			CTimeReportScope(ITimeReport* pTimeReport, const std::string& phaseName);
+			~CTimeReportScope();
+
+			/*!
+				\brief The method finishes the scope's phase and starts the next one at the same level, so sequential stages
+				are measured by a single scope
+			*/
+
+			void NextPhase(const std::string& phaseName);
+		protected:
+			CTimeReportScope(const CTimeReportScope&) = delete;
+			CTimeReportScope& operator= (const CTimeReportScope&) = delete;
+		protected:
+			ITimeReport* mpTimeReport;
+	};
+}
+
+#endif
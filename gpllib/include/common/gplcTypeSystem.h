@@ -34,6 +34,16 @@ namespace gplc
 	E_COMPILER_TYPES NodeToCompilerType(E_NODE_TYPE nodeType);
 
 
+	/*!
+		\brief The function returns a type which is a result of usual arithmetic conversions
+		applied to given operands' types
+
+		\return A common type of both operands or CT_LAST if there is no such one
+	*/
+
+	E_COMPILER_TYPES GetCommonArithmeticType(E_COMPILER_TYPES leftType, E_COMPILER_TYPES rightType);
+
+
 	/*!
 		\brief The sizes of builtin types in bytes
 	*/
@@ -58,6 +68,38 @@ namespace gplc
 	};
 
 
+	/*!
+		\brief The structure contains ABI alignments of builtin types on a target. Sizes of builtin types are
+		fixed, but their alignments aren't, e.g. int64 and double are aligned by 4 bytes on 32 bits x86
+	*/
+
+	struct TTargetAlignmentsInfo
+	{
+		typedef std::unordered_map<U32, U32> TAlignmentsMap;
+
+		TAlignmentsMap mIntegersAlignments; ///< Alignments of integers by their sizes in bytes
+
+		TAlignmentsMap mFloatsAlignments;   ///< Alignments of floating point types by their sizes in bytes
+
+		U32            mPointerAlignment = BTS_POINTER;
+
+		bool operator== (const TTargetAlignmentsInfo& info) const;
+	};
+
+
+	/*!
+		\brief The structure is shared by all types of a single factory. It contains alignments of the target which
+		the types are compiled for and a version of layouts, so compilers which run in parallel don't affect each other
+	*/
+
+	struct TTargetLayoutContext
+	{
+		TTargetAlignmentsInfo mAlignments;
+
+		U32                   mLayoutsVersion = 1; ///< \note The value is changed each time when any layout of the factory's types may become outdated
+	};
+
+
 	/*!
 		\brief The interface describes a functionality of a type
 		resolver which is used within semantic analysys pass
@@ -149,8 +191,6 @@ namespace gplc
 
 	class CType: public IVisitable<TLLVMIRData, ITypeVisitor<TLLVMIRData>>
 	{
-		protected:
-			typedef std::unordered_map<E_COMPILER_TYPES, std::unordered_map<E_COMPILER_TYPES, bool>> TCastMap;
 		public:
 			CType(E_COMPILER_TYPES type, U32 size, U32 attributes, const std::string& name = "", CType* pParent = nullptr);
 			virtual ~CType();
@@ -179,6 +219,12 @@ namespace gplc
 
 			virtual U32 GetSize() const;
 
+			/*!
+				\brief The method returns an alignment of a type's instance in bytes
+			*/
+
+			virtual U32 GetAlignment() const;
+
 			virtual U32 GetAttributes() const;
 
 			virtual const std::string& GetName() const;
@@ -202,6 +248,15 @@ namespace gplc
 			virtual bool AreConvertibleTo(const CType* pType) const;
 
 			virtual std::string ToShortAliasString() const;
+
+			/*!
+				\brief The method specifies a context which provides alignments of builtin types, the ones are used to compute
+				layouts of aggregates. Types without the context are aligned by their own sizes and don't cache their layouts
+
+				\note The method is called by a types factory when the type is created
+			*/
+
+			void SetLayoutContext(TTargetLayoutContext* pLayoutContext);
 		protected:
 			CType();
 			CType(const CType& type);
@@ -211,9 +266,16 @@ namespace gplc
 			Result _removeChildTypeDesc(CType** type);
 
 			CBaseValue* _getBuiltinTypeDefaultValue(E_COMPILER_TYPES type) const;
-		protected:
-			static TCastMap           mCastMap;
 
+			/*!
+				\brief The method returns an alignment of a builtin type of the given size on a target which is specified
+				with the layout context of this type
+			*/
+
+			U32 _getBuiltinTypeAlignment(E_COMPILER_TYPES type, U32 size) const;
+
+			void _invalidateLayouts();
+		protected:
 			E_COMPILER_TYPES          mType;
 
 			U32                       mSize;
@@ -225,6 +287,8 @@ namespace gplc
 			std::vector<const CType*> mChildren;
 
 			CType*                    mpParent;
+
+			TTargetLayoutContext*     mpLayoutContext = nullptr;
 	};
 
 
@@ -266,6 +330,23 @@ namespace gplc
 	{
 		public:
 			typedef std::vector<std::pair<std::string, CType*>> TFieldsArray;
+
+			/*!
+				\brief The structure describes a memory layout of a structure's instance. Fields are
+				placed in declaration order by default, AV_REORDER_FIELDS allows to sort them by their alignment
+				to minimize padding, AV_PACKED_LAYOUT removes padding at all
+			*/
+
+			struct TLayoutInfo
+			{
+				std::vector<U32> mFieldsOrder;	///< mFieldsOrder[i] is an index (within GetFieldsTypes()) of a field which is placed i-th in memory
+
+				std::vector<U32> mFieldsOffsets; ///< mFieldsOffsets[i] is an offset of i-th field in declaration order
+
+				U32              mSize      = 0;
+
+				U32              mAlignment = 1;
+			};
 		public:
 			CStructType(const TFieldsArray& fieldsTypes, U32 attributes = 0x0, CType* pParent = nullptr);
 			virtual ~CStructType() = default;
@@ -278,6 +359,27 @@ namespace gplc
 
 			const TFieldsArray& GetFieldsTypes() const;
 
+			/*!
+				\brief The method computes a memory layout of the structure based on sizes and alignments of its fields.
+				The layout is cached until fields of any structure or alignments of the target change
+			*/
+
+			const TLayoutInfo& GetLayoutInfo() const;
+
+			/*!
+				\brief The method returns an index of a field in memory, the one should be used for GEP instructions
+
+				\return An index of a field or -1 if there is no field with the given name
+			*/
+
+			I32 GetFieldIndex(const std::string& fieldName) const;
+
+			U32 GetSize() const override;
+
+			U32 GetAlignment() const override;
+
+			bool IsPacked() const;
+
 			CASTExpressionNode* GetDefaultValue(IASTNodesFactory* pNodesFactory) const override;
 			
 			U64 GetTypeId() const override;
@@ -289,7 +391,13 @@ namespace gplc
 			CStructType() = default;
 			CStructType(const CStructType& structure) = default;
 		protected:
-			TFieldsArray mFieldsTypes;
+			TFieldsArray        mFieldsTypes;
+
+			mutable TLayoutInfo mLayoutInfo;
+
+			mutable U32         mLayoutInfoVersion = 0; ///< \note The cached layout is valid while it equals to a version of the layout context
+
+			mutable bool        mIsLayoutBeingComputed = false; ///< \note It breaks a recursion if a structure contains itself through a named type
 	};
 
 	
@@ -388,6 +496,8 @@ namespace gplc
 			
 			U32 GetSize() const override;
 
+			U32 GetAlignment() const override;
+
 			CType* GetDependentType() const;
 
 			U32 GetAttributes() const override;
@@ -427,8 +537,21 @@ namespace gplc
 
 			std::string ToShortAliasString() const override;
 
+			U32 GetSize() const override;
+
+			U32 GetAlignment() const override;
+
 			CType* GetBaseType() const;
 
+			/*!
+				\brief The method returns a structure type of array's elements if the array is stored
+				as a structure of arrays, which is true for structures marked with @soa attribute
+
+				\return A pointer to the structure type or nullptr if the array has an ordinary layout
+			*/
+
+			const CStructType* GetSoAElementType() const;
+
 			U32 GetElementsCount() const;
 
 			U64 GetTypeId() const override;
@@ -489,6 +612,42 @@ namespace gplc
 
 			U64 GetTypeId() const override;
 
+			/*!
+				\brief The method returns a tag of the given alternative. Tags are dense, they're equal to indices of
+				alternatives in declaration order, so checks of them can be lowered into a jump table
+
+				\return The method returns -1 if the variant doesn't contain the type
+			*/
+
+			I32 GetTag(const CType* pAltType) const;
+
+			/*!
+				\brief The method returns the smallest size in bytes of an integer which can hold any tag of the variant
+			*/
+
+			U32 GetTagSize() const;
+
+			/*!
+				\brief The method returns a size of the payload in bytes, which is a size of the largest alternative
+			*/
+
+			U32 GetPayloadSize() const;
+
+			/*!
+				\brief The method returns a size in bytes of integers which the payload consists of. It's the largest
+				alignment of alternatives, but the one isn't greater than a size of uint64
+			*/
+
+			U32 GetPayloadAlignment() const;
+
+			/*!
+				\brief The method returns a size of the tagged union { tag, [N x payload element] } which the variant is lowered into
+			*/
+
+			U32 GetSize() const override;
+
+			U32 GetAlignment() const override;
+
 			bool AreSame(const CType* pType) const override;
 
 			std::string ToShortAliasString() const override;
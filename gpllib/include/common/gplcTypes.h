@@ -83,7 +83,7 @@ namespace gplc
 		\return A logical expression
 	*/
 
-	#define SUCCESS(resultType) (resultType == RV_SUCCESS)	/*(~(resultType & RV_FAIL))*/
+	#define SUCCESS(resultType) ((resultType) == RV_SUCCESS)	/*(~(resultType & RV_FAIL))*/
 
 
 	/*!
@@ -202,6 +202,16 @@ namespace gplc
 		TT_ABORT_INTRINSIC,
 		TT_CAST_INTRINSIC,
 		TT_VARIANT_TYPE,
+		TT_PACKED_KEYWORD,
+		TT_REORDER_KEYWORD,
+		TT_SOA_KEYWORD,
+		TT_UNCHECKED_KEYWORD,
+		TT_VECTORIZE_KEYWORD,
+		TT_NOVECTORIZE_KEYWORD,
+		TT_UNROLL_KEYWORD,
+		TT_RESTRICT_KEYWORD,
+		TT_INLINE_KEYWORD,
+		TT_NOINLINE_KEYWORD,
 	};
 
 
@@ -220,6 +230,7 @@ namespace gplc
 		PE_UNEXPECTED_TOKEN,
 		PE_INVALID_ENVIRONMENT,					///< Some of input arguments of Parse method of IParser are invalid
 		PE_INVALID_TYPE,
+		PE_LOOP_HINT_OUTSIDE_LOOP,				///< @vectorize, @novectorize and @unroll are specified for something which isn't a loop
 	};
 
 
@@ -267,6 +278,10 @@ namespace gplc
 		SAE_INVALID_NUMBER_OF_ARGUMENTS,
 		SAE_TRY_TO_DEREF_NON_POINTER_TYPE,
 		SAE_TRY_TO_REREF_INVALID_POINTER,
+		SAE_SOA_ELEMENT_ACCESS_IS_NOT_ALLOWED,
+		SAE_DIVISION_BY_ZERO_IN_CONST_EXPR,
+		SAE_INTEGER_OVERFLOW_IN_CONST_EXPR,
+		SAE_IMPORTED_FUNCTION_CANNOT_BE_REASSIGNED,
 	};
 
 
@@ -286,6 +301,18 @@ namespace gplc
 		AV_KEEP_UNINITIALIZED = 0x100,
 		AV_FUNC_PROTOTYPE     = 0x200,
 		AV_INVALID_POINTER    = 0x400, ///< \note The attribute is used in pair with AV_KEEP_UNITIALIZED to check up whether the pointer was initialized before dereferencing or not
+		AV_PACKED_LAYOUT      = 0x800, ///< \note A structure's fields are placed without any padding between them
+		AV_REORDER_FIELDS     = 0x1000, ///< \note A structure's fields can be reordered by the compiler to minimize padding
+		AV_SOA_LAYOUT         = 0x2000, ///< \note Arrays of a structure are stored as a structure of arrays, one per field
+		AV_UNCHECKED_ACCESS   = 0x4000, ///< \note Indices of an array or ones which are used within a function aren't checked up in runtime
+		AV_VECTORIZE          = 0x8000, ///< \note A loop should be vectorized, the width is specified with TLoopHints::mVectorizeWidth
+		AV_NO_VECTORIZE       = 0x10000, ///< \note A loop shouldn't be vectorized
+		AV_UNROLL             = 0x20000, ///< \note A loop should be unrolled, the count is specified with TLoopHints::mUnrollCount
+		AV_RESTRICT           = 0x40000, ///< \note Memory which is pointed by an argument isn't accessed through other pointers within a function
+		AV_INLINE             = 0x80000, ///< \note A function is always inlined into its callers
+		AV_NO_INLINE          = 0x100000, ///< \note A function is never inlined
+		AV_READNONE           = 0x200000, ///< \note A function doesn't access memory except its own locals, the attribute is inferred by IFunctionAttributesAnalyser
+		AV_READONLY           = 0x400000, ///< \note A function doesn't write memory except its own locals, the attribute is inferred by IFunctionAttributesAnalyser
 	};
 
 
@@ -12,8 +12,11 @@
 
 
 #include "gplcTypes.h"
+#include "gplcStatistics.h"
 #include <vector>
 #include <string>
+#include <set>
+#include <tuple>
 
 
 namespace gplc
@@ -29,6 +32,9 @@ namespace gplc
 	class ISymTable;
 	class CVariantType;
 
+	struct TTargetAlignmentsInfo;
+	struct TTargetLayoutContext;
+
 
 	class ITypesFactory
 	{
@@ -56,7 +62,15 @@ namespace gplc
 	class CTypesFactory: public ITypesFactory
 	{
 		public:
-			CTypesFactory() = default;
+			CTypesFactory();
+
+			/*!
+				\brief The constructor specifies alignments of builtin types on a target, created types use them to compute
+				layouts of aggregates. A driver should create the factory before semantic analysis of the first module,
+				otherwise sizes which are evaluated by the analysis won't match the emitted code
+			*/
+
+			explicit CTypesFactory(const TTargetAlignmentsInfo& targetAlignments);
 			virtual ~CTypesFactory();
 			
 			CType* CreateType(E_COMPILER_TYPES type, U32 size, U32 attributes, const std::string& name = "", CType* pParent = nullptr) override;
@@ -72,14 +86,24 @@ namespace gplc
 			CTypesFactory(const CTypesFactory&) = delete;
 
 			template <typename T>
-			inline T* _insertValue(T* pValue)
+			inline T* _insertValue(T* pValue, const C8* pKindName)
 			{
+				GPLC_STATISTIC_ADD("types", std::string("created ").append(pKindName).append(" types"), 1);
+
+				pValue->SetLayoutContext(mpLayoutContext);
+
 				mpCachedTypes.push_back(pValue);
 
 				return pValue;
 			}
 		protected:
-			std::vector<CType*> mpCachedTypes;
+			typedef std::set<std::tuple<E_COMPILER_TYPES, U32, U32, std::string, CType*>> TBuiltinTypesSet;
+
+			std::vector<CType*>   mpCachedTypes;
+
+			TTargetLayoutContext* mpLayoutContext;
+
+			TBuiltinTypesSet      mCreatedBuiltinTypes; ///< \note The set is filled only if the statistics is enabled
 	};
 }
 
@@ -24,12 +24,18 @@
 #include "common/gplcConstExprInterpreter.h"
 #include "common/gplcModuleResolver.h"
 #include "common/gplcTypesFactory.h"
+#include "common/gplcBuildCache.h"
+#include "common/gplcModuleInterface.h"
+#include "common/gplcTimeReport.h"
+#include "common/gplcStatistics.h"
 
 /// Parser's files group
 #include "parser/gplcParser.h"
 #include "parser/gplcASTNodes.h"
 #include "parser/gplcSemanticAnalyser.h"
 #include "parser/gplcASTNodesFactory.h"
+#include "parser/gplcConstantFolder.h"
+#include "parser/gplcFunctionAttributesAnalyser.h"
 
 #include "utils/CASTLispyPrinter.h"
 #include "utils/CResult.h"
@@ -43,6 +49,7 @@
 #include "codegen/gplcLLVMLiteralVisitor.h"
 #include "codegen/gplcLLVMTypeVisitor.h"
 #include "codegen/gplcLLVMLinker.h"
+#include "codegen/gplcLLVMTargetMachine.h"
 #include "codegen/ctplr/gplcCCodegen.h"
 #include "codegen/ctplr/gplcCTypeVisitor.h"
 #include "codegen/ctplr/gplcCLiteralVisitor.h"
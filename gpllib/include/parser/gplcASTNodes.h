@@ -89,6 +89,9 @@ namespace gplc
 		NT_VARIANT_DECL,
 	};
 
+
+	std::string NodeTypeToString(E_NODE_TYPE type);
+
 	/*!
 		\brief CASTNode class
 	*/
@@ -109,9 +112,24 @@ namespace gplc
 			Result AttachChildren(const std::vector<CASTNode*>& nodes);
 
 			Result DettachChild(CASTNode** node);
+
+			/*!
+				\brief The method replaces a child node with a new one. The old node isn't released,
+				because all nodes are owned by IASTNodesFactory
+			*/
+
+			Result ReplaceChild(CASTNode* pChild, CASTNode* pNewChild);
+
+			/*!
+				\brief The method removes a child node without its releasing
+			*/
+
+			Result RemoveChild(CASTNode* pChild);
 						
 			void SetAttribute(U32 attribute);
 
+			void ResetAttribute(U32 attribute);
+
 			const std::vector<CASTNode*> GetChildren() const;
 
 			U32 GetChildrenCount() const;
@@ -353,10 +371,23 @@ namespace gplc
 	};
 
 
+	/*!
+		\brief The structure contains parameters of @vectorize(width) and @unroll(count) attributes of a loop,
+		zero values mean that a choice is left up to the optimizer
+	*/
+
+	struct TLoopHints
+	{
+		U32 mVectorizeWidth = 0;
+
+		U32 mUnrollCount    = 0;
+	};
+
+
 	class CASTLoopStatementNode : public CASTNode
 	{
 		public:
-			CASTLoopStatementNode(CASTBlockNode* pBody);
+			CASTLoopStatementNode(CASTBlockNode* pBody, const TLoopHints& hints = {});
 			virtual ~CASTLoopStatementNode() = default;
 
 			std::string Accept(IASTNodeVisitor<std::string>* pVisitor) override;
@@ -364,16 +395,20 @@ namespace gplc
 			TLLVMIRData Accept(IASTNodeVisitor<TLLVMIRData>* pVisitor) override;
 
 			CASTBlockNode* GetBody() const;
+
+			const TLoopHints& GetHints() const;
 		protected:
 			CASTLoopStatementNode() = default;
 			CASTLoopStatementNode(const CASTLoopStatementNode& node) = default;
+		protected:
+			TLoopHints mHints;
 	};
 
 	
 	class CASTWhileLoopStatementNode : public CASTNode
 	{
 		public:
-			CASTWhileLoopStatementNode(CASTExpressionNode* pCondition, CASTBlockNode* pBody);
+			CASTWhileLoopStatementNode(CASTExpressionNode* pCondition, CASTBlockNode* pBody, const TLoopHints& hints = {});
 			virtual ~CASTWhileLoopStatementNode() = default;
 
 			std::string Accept(IASTNodeVisitor<std::string>* pVisitor) override;
@@ -383,9 +418,13 @@ namespace gplc
 			CASTExpressionNode* GetCondition() const;
 
 			CASTBlockNode* GetBody() const;
+
+			const TLoopHints& GetHints() const;
 		protected:
 			CASTWhileLoopStatementNode() = default;
 			CASTWhileLoopStatementNode(const CASTWhileLoopStatementNode& node) = default;
+		protected:
+			TLoopHints mHints;
 	};
 
 
@@ -538,7 +577,7 @@ namespace gplc
 	class CASTStructDeclNode : public CASTTypeNode
 	{
 		public:
-			CASTStructDeclNode(CASTIdentifierNode* pStructName, CASTBlockNode* pStructFields);
+			CASTStructDeclNode(CASTIdentifierNode* pStructName, CASTBlockNode* pStructFields, U32 attributes = 0x0);
 			virtual ~CASTStructDeclNode() = default;
 
 			std::string Accept(IASTNodeVisitor<std::string>* pVisitor) override;
@@ -15,6 +15,7 @@
 #include <vector>
 #include <string>
 #include "gplcASTNodes.h"
+#include "common/gplcStatistics.h"
 
 
 namespace gplc
@@ -39,8 +40,8 @@ namespace gplc
 			virtual CASTBinaryExpressionNode* CreateBinaryExpr(CASTExpressionNode* pLeft, E_TOKEN_TYPE opType, CASTExpressionNode* pRight) = 0;
 			virtual CASTAssignmentNode* CreateAssignNode(CASTExpressionNode* pLeft, CASTExpressionNode* pRight) = 0;
 			virtual CASTIfStatementNode* CreateIfStmtNode(CASTExpressionNode* pCondition, CASTBlockNode* pThenBlock, CASTBlockNode* pElseBlock) = 0;
-			virtual CASTLoopStatementNode* CreateLoopStmtNode(CASTBlockNode* pBody) = 0;
-			virtual CASTWhileLoopStatementNode* CreateWhileStmtNode(CASTExpressionNode* pCondition, CASTBlockNode* pBody) = 0;
+			virtual CASTLoopStatementNode* CreateLoopStmtNode(CASTBlockNode* pBody, const TLoopHints& hints = {}) = 0;
+			virtual CASTWhileLoopStatementNode* CreateWhileStmtNode(CASTExpressionNode* pCondition, CASTBlockNode* pBody, const TLoopHints& hints = {}) = 0;
 			virtual CASTFunctionClosureNode* CreateFuncClosureNode() = 0;
 			virtual CASTFunctionArgsNode* CreateFuncArgsNode() = 0;
 			virtual CASTFunctionDeclNode* CreateFuncDeclNode(CASTFunctionClosureNode* pClosure, CASTFunctionArgsNode* pArgs, CASTNode* pReturnValue, U32 attributes = 0x0) = 0;
@@ -49,7 +50,7 @@ namespace gplc
 			virtual CASTDefinitionNode* CreateDefNode(CASTDeclarationNode* pDecl, CASTNode* pValue) = 0;
 			virtual CASTFuncDefinitionNode* CreateFuncDefNode(CASTDeclarationNode* pDecl, CASTFunctionDeclNode* pLambdaType, CASTNode* pBody) = 0;
 			virtual CASTEnumDeclNode* CreateEnumDeclNode(CASTIdentifierNode* pEnumName) = 0;
-			virtual CASTStructDeclNode* CreateStructDeclNode(CASTIdentifierNode* pStructName, CASTBlockNode* pStructFields) = 0;
+			virtual CASTStructDeclNode* CreateStructDeclNode(CASTIdentifierNode* pStructName, CASTBlockNode* pStructFields, U32 attributes = 0x0) = 0;
 			virtual CASTNamedTypeNode* CreateNamedTypeNode(CASTIdentifierNode* pIdentifier, U32 attributes = 0x0) = 0;
 			virtual CASTBreakOperatorNode* CreateBreakNode() = 0;
 			virtual CASTContinueOperatorNode* CreateContinueNode() = 0;
@@ -83,8 +84,8 @@ namespace gplc
 			CASTBinaryExpressionNode* CreateBinaryExpr(CASTExpressionNode* pLeft, E_TOKEN_TYPE opType, CASTExpressionNode* pRight) override;
 			CASTAssignmentNode* CreateAssignNode(CASTExpressionNode* pLeft, CASTExpressionNode* pRight) override;
 			CASTIfStatementNode* CreateIfStmtNode(CASTExpressionNode* pCondition, CASTBlockNode* pThenBlock, CASTBlockNode* pElseBlock) override;
-			CASTLoopStatementNode* CreateLoopStmtNode(CASTBlockNode* pBody) override;
-			CASTWhileLoopStatementNode* CreateWhileStmtNode(CASTExpressionNode* pCondition, CASTBlockNode* pBody) override;
+			CASTLoopStatementNode* CreateLoopStmtNode(CASTBlockNode* pBody, const TLoopHints& hints = {}) override;
+			CASTWhileLoopStatementNode* CreateWhileStmtNode(CASTExpressionNode* pCondition, CASTBlockNode* pBody, const TLoopHints& hints = {}) override;
 			CASTFunctionClosureNode* CreateFuncClosureNode() override;
 			CASTFunctionArgsNode* CreateFuncArgsNode() override;
 			CASTFunctionDeclNode* CreateFuncDeclNode(CASTFunctionClosureNode* pClosure, CASTFunctionArgsNode* pArgs, CASTNode* pReturnValue, U32 attributes = 0x0) override;
@@ -93,7 +94,7 @@ namespace gplc
 			CASTDefinitionNode* CreateDefNode(CASTDeclarationNode* pDecl, CASTNode* pValue) override;
 			CASTFuncDefinitionNode* CreateFuncDefNode(CASTDeclarationNode* pDecl, CASTFunctionDeclNode* pLambdaType, CASTNode* pBody) override;
 			CASTEnumDeclNode* CreateEnumDeclNode(CASTIdentifierNode* pEnumName) override;
-			CASTStructDeclNode* CreateStructDeclNode(CASTIdentifierNode* pStructName, CASTBlockNode* pStructFields) override;
+			CASTStructDeclNode* CreateStructDeclNode(CASTIdentifierNode* pStructName, CASTBlockNode* pStructFields, U32 attributes = 0x0) override;
 			CASTNamedTypeNode* CreateNamedTypeNode(CASTIdentifierNode* pIdentifier, U32 attributes = 0x0) override;
 			CASTBreakOperatorNode* CreateBreakNode() override;
 			CASTContinueOperatorNode* CreateContinueNode() override;
@@ -111,6 +112,8 @@ namespace gplc
 			template <typename T>
 			inline T* _insertNode(T* pNode)
 			{
+				GPLC_STATISTIC_ADD("ast", std::string("nodes ").append(NodeTypeToString(pNode->GetType())), 1);
+
 				mpCachedNodes.push_back(pNode);
 
 				return pNode;
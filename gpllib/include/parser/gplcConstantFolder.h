@@ -0,0 +1,115 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains definition of AST-to-AST pass that folds constant subexpressions
+
+	\todo
+*/
+
+#ifndef GPLC_CONSTANT_FOLDER_H
+#define GPLC_CONSTANT_FOLDER_H
+
+
+#include "common/gplcTypes.h"
+#include "utils/CResult.h"
+
+
+namespace gplc
+{
+	class CASTNode;
+	class CASTSourceUnitNode;
+	class CASTBlockNode;
+	class CASTIfStatementNode;
+	class CASTExpressionNode;
+	class CASTUnaryExpressionNode;
+	class CASTBinaryExpressionNode;
+	class CBaseValue;
+	class ISymTable;
+	class IConstExprInterpreter;
+	class IASTNodesFactory;
+	struct TConstValue;
+
+
+	/*!
+		\brief The interface describes a pass which is run between the semantic analysis and
+		code generation stages. It doesn't depend on a backend, so both CLLVMCodeGenerator and
+		CCCodeGenerator get already simplified AST
+	*/
+
+	class IConstantFolder
+	{
+		public:
+			IConstantFolder() = default;
+			virtual ~IConstantFolder() = default;
+
+			/*!
+				\brief The method folds constant subexpressions in place, simplifies x * 1, x + 0, !!b
+				and prunes dead branches of if statements with constant conditions. Scopes of pruned
+				blocks are removed from the symbol table
+
+				\return The method returns RV_SUCCESS if the AST was processed
+			*/
+
+			virtual Result Fold(CASTSourceUnitNode* pSourceUnit, ISymTable* pSymTable, IConstExprInterpreter* pInterpreter, IASTNodesFactory* pNodesFactory) = 0;
+		protected:
+			IConstantFolder(const IConstantFolder&) = delete;
+	};
+
+
+	class CConstantFolder : public IConstantFolder
+	{
+		public:
+			CConstantFolder() = default;
+			virtual ~CConstantFolder() = default;
+
+			Result Fold(CASTSourceUnitNode* pSourceUnit, ISymTable* pSymTable, IConstExprInterpreter* pInterpreter, IASTNodesFactory* pNodesFactory) override;
+		protected:
+			CConstantFolder(const CConstantFolder&) = delete;
+
+			/*!
+				\return The method returns a node that should replace the given one, nullptr means the statement
+				should be removed
+			*/
+
+			CASTNode* _foldStatement(CASTNode* pNode);
+
+			void _foldBlock(CASTBlockNode* pBlock);
+
+			CASTNode* _foldIfStatement(CASTIfStatementNode* pNode);
+
+			CASTNode* _foldExpression(CASTNode* pNode);
+
+			CASTNode* _foldUnaryExpression(CASTUnaryExpressionNode* pNode);
+
+			CASTNode* _foldBinaryExpression(CASTBinaryExpressionNode* pNode);
+
+			/*!
+				\brief The method folds a child of a given node and replaces it if it's needed
+			*/
+
+			void _foldChild(CASTNode* pParent, CASTNode* pChild);
+
+			CASTNode* _evalConstantExpression(CASTExpressionNode* pExpr);
+
+			CASTNode* _createLiteral(const TConstValue& value);
+
+			/*!
+				\return The method returns a literal's value if the node is a literal possibly wrapped with
+				unary expressions without operators, nullptr in other cases
+			*/
+
+			CBaseValue* _getConstantValue(CASTNode* pNode) const;
+
+			bool _isConstantValueEqualTo(CASTNode* pNode, I32 value) const;
+		protected:
+			ISymTable*             mpSymTable     = nullptr;
+
+			IConstExprInterpreter* mpInterpreter  = nullptr;
+
+			IASTNodesFactory*      mpNodesFactory = nullptr;
+	};
+}
+
+#endif
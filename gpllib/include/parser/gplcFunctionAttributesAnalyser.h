@@ -0,0 +1,147 @@
+/*!
+	\author Ildar Kasimov
+	\date   19.10.2026
+	\copyright
+
+	\brief The file contains definition of a pass that infers memory effects of functions
+
+	\todo
+*/
+
+#ifndef GPLC_FUNCTION_ATTRIBUTES_ANALYSER_H
+#define GPLC_FUNCTION_ATTRIBUTES_ANALYSER_H
+
+
+#include "common/gplcTypes.h"
+#include "utils/CResult.h"
+#include <vector>
+#include <unordered_map>
+#include <string>
+
+
+namespace gplc
+{
+	class CASTNode;
+	class CASTSourceUnitNode;
+	class CASTBlockNode;
+	class CASTFuncDefinitionNode;
+	class ISymTable;
+
+
+	/*!
+		\brief The interface describes a pass which is run between the semantic analysis and
+		code generation stages. It marks definitions of functions which don't access memory outside
+		of their own stack frames with AV_READNONE and ones which only read it with AV_READONLY
+	*/
+
+	class IFunctionAttributesAnalyser
+	{
+		public:
+			IFunctionAttributesAnalyser() = default;
+			virtual ~IFunctionAttributesAnalyser() = default;
+
+			/*!
+				\brief The method analyses all functions of a module including nested ones. Calls of functions which
+				are defined within the module are taken into account, any other call is treated as a write into memory
+
+				\return The method returns RV_SUCCESS if the AST was processed
+			*/
+
+			virtual Result Analyze(CASTSourceUnitNode* pSourceUnit, ISymTable* pSymTable) = 0;
+		protected:
+			IFunctionAttributesAnalyser(const IFunctionAttributesAnalyser&) = delete;
+	};
+
+
+	class CFunctionAttributesAnalyser : public IFunctionAttributesAnalyser
+	{
+		protected:
+			/*!
+				\brief The values are ordered, so effects of a function are the maximum of its own ones and ones of its callees
+			*/
+
+			enum E_MEMORY_EFFECTS : U8
+			{
+				ME_NONE,
+				ME_READ_ONLY,
+				ME_UNKNOWN,
+			};
+
+			struct TFunctionInfo
+			{
+				CASTFuncDefinitionNode*              mpDefinition;
+
+				E_MEMORY_EFFECTS                     mEffects = ME_NONE;
+
+				std::vector<CASTFuncDefinitionNode*> mCallees;
+			};
+
+			/*!
+				\brief Names which are declared within a scope of the current function, nested functions are mapped into
+				their definitions, variables are mapped into nullptr
+			*/
+
+			typedef std::unordered_map<std::string, CASTFuncDefinitionNode*> TLocalScope;
+
+			typedef std::vector<TLocalScope>                                 TLocalScopesArray;
+
+			typedef std::vector<TFunctionInfo>                               TFunctionsArray;
+
+			typedef std::unordered_map<CASTFuncDefinitionNode*, U32>         TFunctionsIndicesTable;
+		public:
+			CFunctionAttributesAnalyser() = default;
+			virtual ~CFunctionAttributesAnalyser() = default;
+
+			Result Analyze(CASTSourceUnitNode* pSourceUnit, ISymTable* pSymTable) override;
+		protected:
+			CFunctionAttributesAnalyser(const CFunctionAttributesAnalyser&) = delete;
+
+			void _analyzeFunction(CASTFuncDefinitionNode* pNode);
+
+			void _analyzeStatement(CASTNode* pNode);
+
+			void _analyzeBlock(CASTBlockNode* pBlock);
+
+			void _analyzeExpression(CASTNode* pNode);
+
+			/*!
+				\brief The method analyses the left side of an assignment
+			*/
+
+			void _analyzeStoreTarget(CASTNode* pNode);
+
+			void _analyzeFunctionCall(CASTNode* pNode);
+
+			void _declareLocals(CASTNode* pDeclaration, CASTFuncDefinitionNode* pFuncDefinition = nullptr);
+
+			/*!
+				\return The method returns true if the name is declared within the current function
+			*/
+
+			bool _isLocal(const std::string& name, CASTFuncDefinitionNode** ppFuncDefinition = nullptr) const;
+
+			bool _isEnumeration(CASTNode* pNode) const;
+
+			std::string _getPlainIdentifierName(CASTNode* pNode) const;
+
+			void _addEffects(E_MEMORY_EFFECTS effects);
+
+			/*!
+				\brief The method propagates effects of callees into their callers until nothing changes
+			*/
+
+			void _propagateEffects();
+		protected:
+			ISymTable*             mpSymTable          = nullptr;
+
+			TFunctionsArray        mFunctions;
+
+			TFunctionsIndicesTable mFunctionsIndices;
+
+			U32                    mCurrFunctionIndex  = 0;
+
+			TLocalScopesArray      mLocalScopes;
+	};
+}
+
+#endif
@@ -30,6 +30,7 @@ namespace gplc
 	class CASTBlockNode;
 	class CASTLoopStatementNode;
 	class CASTWhileLoopStatementNode;
+	struct TLoopHints;
 	class CASTFunctionDeclNode;
 	class CASTFunctionClosureNode;
 	class CASTFunctionArgsNode;
@@ -288,7 +289,7 @@ namespace gplc
 			/*!
 				\brief The method tries to parse the following rule
 
-				<loop-statement> ::= 'loop' <block>
+				<loop-statement> ::= 'loop' <attributes>? <block>
 			*/
 
 			CASTLoopStatementNode* _parseLoopStatement(ILexer* pLexer);
@@ -296,7 +297,7 @@ namespace gplc
 			/*!
 				\brief The method parses the following rule
 
-				<while-loop-stmt> ::= 'while' <expression> '{' <block> '}'
+				<while-loop-stmt> ::= 'while' <attributes>? <expression> '{' <block> '}'
 			*/
 
 			CASTWhileLoopStatementNode* _parseWhileLoopStatement(ILexer* pLexer);
@@ -364,6 +365,16 @@ namespace gplc
 
 			bool _parseEnumValues(const std::string& enumName, ILexer* pLexer);
 
+			/*!
+				\brief The method parses the following rule
+
+				<struct-decl> ::= 'struct' <attributes> <identifier> '{' <struct-fields> '}'
+
+				Supported attributes are @packed (no padding between fields), @reorder (fields
+				are sorted by their alignment to minimize padding) and @soa (arrays of the structure
+				are stored as a structure of arrays)
+			*/
+
 			CASTStructDeclNode* _parseStructDeclaration(ILexer* pLexer);
 
 			CASTBlockNode* _parseStructFields(const std::string& structName, ILexer* pLexer);
@@ -392,7 +403,23 @@ namespace gplc
 
 			CASTTypeNode* _getBasicType(E_TOKEN_TYPE typeToken) const;
 
-			U32 _parseAttributes(ILexer* pLexer);
+			/*!
+				\brief The method parses a sequence of @ attributes. Loop's hints @vectorize and @unroll can have
+				an integral argument, e.g. @vectorize(4), it's written into pLoopHints. If pLoopHints equals to nullptr
+				the hints aren't allowed
+			*/
+
+			U32 _parseAttributes(ILexer* pLexer, TLoopHints* pLoopHints = nullptr);
+
+			/*!
+				\brief The method parses an optional argument of an attribute
+
+				<attribute-arg> ::= '(' <int-literal> ')'
+
+				\return The method returns false if the argument is malformed, value stays unchanged if there is no argument
+			*/
+
+			bool _parseAttributeArgument(ILexer* pLexer, U32& value);
 
 			CASTIntrinsicCallNode* _parseIntrinsicCall(ILexer* pLexer);
 
@@ -136,6 +136,16 @@ namespace gplc
 
 			bool _containsBreak(CASTBlockNode* pLoopBody) const;
 
+			/*!
+				\brief The method marks a function as reassigned if a given expression is its identifier. Calls of other
+				functions are emitted as direct ones by the code generator
+
+				\return The method returns false if the expression is a function of an imported module, the module calls
+				its own functions directly, so they can't be reassigned by importers
+			*/
+
+			bool _markReassignedFunction(CASTNode* pExpr, CType* pExprType);
+
 			void _notifyWarning(E_SEMANTIC_ANALYSER_MESSAGE message) const;
 
 			void _notifyError(E_SEMANTIC_ANALYSER_MESSAGE message) const;
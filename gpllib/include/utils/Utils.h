@@ -13,6 +13,7 @@
 
 
 #include "common/gplcTypes.h"
+#include "llvm/Support/SHA1.h"
 #include <string>
 #include <iostream>
 
@@ -50,6 +51,34 @@ namespace gplc
 	}
 
 
+	/*!
+		\brief The class computes SHA-1 digest of a sequence of strings. Unlike ComputeHash the result is
+		wide enough to address compiled modules in the build cache and to compare modules' interfaces
+	*/
+
+	class CDigestBuilder
+	{
+		public:
+			CDigestBuilder() = default;
+
+			/*!
+				\brief The method appends a string prefixed with its length, so ("ab", "c") and ("a", "bc") give different digests
+			*/
+
+			CDigestBuilder& Append(const std::string& value);
+
+			CDigestBuilder& Append(const U8* pData, size_t size);
+
+			/*!
+				\return The method returns the digest as a string of 40 hexadecimal digits
+			*/
+
+			std::string GetDigest() const;
+		protected:
+			llvm::SHA1 mHasher;
+	};
+
+
 	#define UNIMPLEMENTED() \
 			 do { \
 				std::cerr << "The feature is not implemented yet (" << __FILE__ << "; " << __LINE__ << ")\n"; \
@@ -37,6 +37,31 @@ namespace gplc
 		return result;
 	}
 
+	Result CCCodeGenerator::SetFlags(U32 flags)
+	{
+		// \note the generator doesn't emit runtime checks, so there is nothing to disable
+		return RV_SUCCESS;
+	}
+
+	Result CCCodeGenerator::SaveModule(const TLLVMIRData& compiledModule, std::vector<U8>& output)
+	{
+		auto pSourceCode = std::get_if<std::string>(&compiledModule);
+
+		if (!pSourceCode)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		output.assign(pSourceCode->cbegin(), pSourceCode->cend());
+
+		return RV_SUCCESS;
+	}
+
+	TLLVMIRData CCCodeGenerator::LoadModule(const std::vector<U8>& data)
+	{
+		return std::string(data.cbegin(), data.cend());
+	}
+
 	TLLVMIRData CCCodeGenerator::VisitProgramUnit(CASTSourceUnitNode* pProgramNode)
 	{
 		if (pProgramNode->GetChildrenCount() < 1)
@@ -82,12 +82,13 @@ namespace gplc
 
 		auto structFields = pStructType->GetFieldsTypes();
 
-		for (U32 i = 0; i < structFields.size(); ++i)
+		for (U32 i : pStructType->GetLayoutInfo().mFieldsOrder)
 		{
 			structBody.append(std::get<std::string>(structFields[i].second->Accept(this))).append(" ").append(structFields[i].first).append(";\n");
 		}
 
 		return std::string("struct ")
+					.append(pStructType->IsPacked() ? "__attribute__((packed)) " : "")
 					.append(pStructType->GetName())
 					.append(" {\n")
 					.append(structBody)
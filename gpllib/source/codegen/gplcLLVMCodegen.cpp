@@ -2,14 +2,27 @@
 #include "common/gplcSymTable.h"
 #include "codegen/gplcLLVMLiteralVisitor.h"
 #include "codegen/gplcLLVMTypeVisitor.h"
+#include "codegen/gplcLLVMTargetMachine.h"
 #include "parser/gplcASTNodes.h"
 #include "common/gplcValues.h"
 #include "common/gplcTypeSystem.h"
 #include "common/gplcConstExprInterpreter.h"
+#include "common/gplcStatistics.h"
 #include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/IR/MDBuilder.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/CFG.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Host.h"
+#include "llvm/Support/TargetRegistry.h"
+#include "llvm/Target/TargetMachine.h"
+#include "llvm/Target/TargetOptions.h"
 #include "utils/Utils.h"
+#include <algorithm>
+#include <unordered_set>
+#include <limits>
 #include <cassert>
 
 
@@ -27,26 +40,42 @@ namespace gplc
 
 		mpLastVisitedEndBlock = nullptr;
 
-		mpLiteralIRGenerator = new CLLVMLiteralVisitor(mContext, this);
-
-		mpTypeGenerator = new CLLVMTypeVisitor(mContext);
-
 		mpTypeResolver = pTypeResolver;
 
 		mpConstExprInterpreter = pInterpreter;
 
 		mVariablesTable.clear();
 
+		mDirectCalleesTable.clear();
+
+		mStructDefaultsTable.clear(); // \note the types generator is recreated for each module, so are the types of cached constants
+
+		mAreBoundsChecksEnabled = !(mFlags & CGF_DISABLE_BOUNDS_CHECKS);
+
+		mpBoundsCheckFunction = nullptr;
+
+		mLoopsStack.clear();
+
 		mpSymTable = pSymTable;
 
 		mIRBuildersStack.push(llvm::IRBuilder<>(mContext)); // module's builder
 
 		mpGlobalIRBuilder = &mIRBuildersStack.top();
 
-		mDefferedExpressionsStack = {};
+		mDefferedExpressionsStack.clear();
+
+		mpCurrAllocasBlock = nullptr;
+
+		mScopedAllocasStack = {};
 
 		mpModule = new llvm::Module(pNode->GetModuleName(), mContext);
 
+		mpLiteralIRGenerator = new CLLVMLiteralVisitor(mContext, mpModule, this);
+
+		_initTargetDataLayout();
+
+		mpTypeGenerator = new CLLVMTypeVisitor(mContext);
+
 		onPreGenerateCallback(this);
 
 		_defineInitModuleGlobalsFunction();
@@ -63,6 +92,8 @@ namespace gplc
 		assert(mpSymTable->GetCurrentScopeType() == pCurrScopeEntry);
 #endif
 
+		_removeMemoryAttributesOfCheckedFunctions();
+
 		mpInitModuleGlobalsIRBuilder->CreateRetVoid();
 
 		// \note FOR DEBUG PURPOSE ONLY
@@ -76,9 +107,66 @@ namespace gplc
 
 		delete mpInitModuleGlobalsIRBuilder;
 
+		if (CStatistics::IsEnabled())
+		{
+			// \note instructions are counted once the module is complete, so builders of visitors aren't slowed down by it
+			for (const llvm::Function& currFunction : *mpModule)
+			{
+				for (const llvm::Instruction& currInstruction : llvm::instructions(currFunction))
+				{
+					CStatistics::Add("codegen", std::string("instructions ").append(currInstruction.getOpcodeName()));
+				}
+			}
+
+			CStatistics::Add("codegen", "functions", mpModule->size());
+		}
+
 		return mpModule;
 	}
 
+	Result CLLVMCodeGenerator::SetFlags(U32 flags)
+	{
+		mFlags = flags;
+
+		return RV_SUCCESS;
+	}
+
+	Result CLLVMCodeGenerator::SaveModule(const TLLVMIRData& compiledModule, std::vector<U8>& output)
+	{
+		auto ppModule = std::get_if<llvm::Module*>(&compiledModule);
+
+		if (!ppModule || !*ppModule)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		llvm::SmallVector<C8, 0> buffer;
+		llvm::raw_svector_ostream out(buffer);
+
+		llvm::WriteBitcodeToFile(**ppModule, out);
+
+		output.assign(buffer.begin(), buffer.end());
+
+		return RV_SUCCESS;
+	}
+
+	TLLVMIRData CLLVMCodeGenerator::LoadModule(const std::vector<U8>& data)
+	{
+		llvm::StringRef bitcode(reinterpret_cast<const C8*>(data.data()), data.size());
+
+		// \note the module is created within the generator's context, so it can be linked with ones which are generated from sources
+		auto moduleOrError = llvm::parseBitcodeFile(llvm::MemoryBufferRef(bitcode, "cached_module"), mContext);
+
+		if (!moduleOrError)
+		{
+			llvm::consumeError(moduleOrError.takeError());
+
+			return {};
+		}
+
+		return moduleOrError->release();
+	}
+
 	TLLVMIRData CLLVMCodeGenerator::VisitProgramUnit(CASTSourceUnitNode* pProgramNode)
 	{
 		if (pProgramNode->GetChildrenCount() < 1)
@@ -141,6 +229,8 @@ namespace gplc
 
 			llvm::Value* pCurrVariableAllocation = nullptr;
 
+			llvm::Constant* pStaticInitializer = nullptr;
+
 			if (isGlobalScope)
 			{
 				switch (pType->GetType())
@@ -159,14 +249,19 @@ namespace gplc
 					default:
 						pCurrVariableAllocation = mpModule->getOrInsertGlobal(_mangleGlobalModuleIdentifier(pType, identifier), pIdentifiersType);
 
-						llvm::dyn_cast<llvm::GlobalVariable>(pCurrVariableAllocation)->setInitializer(llvm::Constant::getNullValue(pIdentifiersType));
+						// \note default values which are known in compile time are placed into the global's initializer instead of the init function
+						pStaticInitializer = _createDefaultStaticInitializer(pType, pCurrSymbolDesc->mpValue, pIdentifiersType);
+
+						llvm::dyn_cast<llvm::GlobalVariable>(pCurrVariableAllocation)->setInitializer(pStaticInitializer ? pStaticInitializer : llvm::Constant::getNullValue(pIdentifiersType));
 
 						break;
 				}
 			}
 			else
 			{
-				pCurrVariableAllocation = currIRBuidler.CreateAlloca(pIdentifiersType, nullptr, dynamic_cast<CASTIdentifierNode*>(pCurrIdentifier)->GetName());
+				pCurrVariableAllocation = _createEntryBlockAlloca(pIdentifiersType, dynamic_cast<CASTIdentifierNode*>(pCurrIdentifier)->GetName());
+
+				_startScopedLifetime(pCurrVariableAllocation);
 			}
 
 			mVariablesTable[mpSymTable->GetSymbolHandleByName(identifier)] = pCurrVariableAllocation;
@@ -177,6 +272,11 @@ namespace gplc
 			{
 				return {};
 			}
+
+			if (pStaticInitializer)
+			{
+				continue;
+			}
 			
 			// \todo replace this with visitor which generates initializing code per type, something like ITypeInitializer
 			switch (currType)
@@ -194,10 +294,31 @@ namespace gplc
 					break;
 				case CT_STRUCT:
 					{
+						const llvm::DataLayout& dataLayout = mpModule->getDataLayout();
+
+						const U64 structSize = dataLayout.getTypeAllocSize(pIdentifiersType);
+
+						const llvm::Align structAlignment = dataLayout.getABITypeAlign(pIdentifiersType);
+
+						// \note constant defaults are copied from a template, the constructor is called only if some of them are computed in runtime
+						if (llvm::Constant* pDefaultValue = _getStructDefaultInitializer(pType))
+						{
+							if (pDefaultValue->isNullValue())
+							{
+								currIRBuidler.CreateMemSet(pCurrVariableAllocation, llvm::ConstantInt::get(llvm::Type::getInt8Ty(mContext), 0), structSize, structAlignment);
+							}
+							else
+							{
+								currIRBuidler.CreateMemCpy(pCurrVariableAllocation, structAlignment, _getStructDefaultTemplate(pType, pDefaultValue), structAlignment, structSize);
+							}
+
+							break;
+						}
+
 						// \todo if we call a constructor from other module first should declare it as external
 						std::string constructorName = pType->GetMangledName() + "$ctor";
 						
-						auto pInputArgType = llvm::PointerType::get(std::get<llvm::Type*>(pType->Accept(mpTypeGenerator)), 0);
+						auto pInputArgType = llvm::PointerType::get(pIdentifiersType, 0);
 
 						auto pConstructor = mpModule->getOrInsertFunction(constructorName, llvm::FunctionType::get(pInputArgType, { pInputArgType }, false));
 
@@ -205,11 +326,8 @@ namespace gplc
 					}
 					break;
 				case CT_VARIANT:
-					{
-						currIRBuidler.CreateStore(llvm::ConstantInt::get(llvm::Type::getInt16Ty(mContext), 0),
-												  _getStructElementValue(currIRBuidler, pCurrVariableAllocation, 0)); // store 0 inside tag field
-
-					}
+					// \note zero tag and zero payload
+					currIRBuidler.CreateStore(llvm::Constant::getNullValue(pIdentifiersType), pCurrVariableAllocation);
 					break;
 				case CT_POINTER:
 					currIRBuidler.CreateStore(llvm::ConstantPointerNull::get(llvm::dyn_cast<llvm::PointerType>(pIdentifiersType)), pCurrVariableAllocation, "ptr_init");
@@ -251,6 +369,14 @@ namespace gplc
 		// \note the second case is true when identifier is a user-defined function pointer
 		if ((pSymbolDesc->mpType->GetType() == CT_FUNCTION && !(attributes & AV_NATIVE_FUNC)))
 		{
+			auto directCalleeIter = mDirectCalleesTable.find(identifierHandle);
+
+			// \note the function is returned as a value, because callers expect an identifier to yield llvm::Value*
+			if (directCalleeIter != mDirectCalleesTable.cend())
+			{
+				return static_cast<llvm::Value*>(directCalleeIter->second);
+			}
+
 			llvm::Value* pValueInstruction = (mVariablesTable.find(identifierHandle) == mVariablesTable.cend()) ? _declareImportedFunction(pSymbolDesc) : _getIdentifierValue(name);
 			
 			return irBuilder.CreateLoad(pValueInstruction, name);
@@ -338,7 +464,21 @@ namespace gplc
 
 		auto& currIRBuilder = mIRBuildersStack.top();
 
-		return currIRBuilder.CreateStore(rightIRCode, leftIRCode, false);
+		auto pStoreInstruction = currIRBuilder.CreateStore(rightIRCode, leftIRCode, false);
+
+		// \note a store into an element of an array or a field can't change an induction variable, unlike a store via a pointer
+		const std::string& leftIdentifier = _getPlainIdentifierName(pNode->GetLeft());
+
+		if (!leftIdentifier.empty())
+		{
+			_invalidateInductionVariables(mpSymTable->GetSymbolHandleByName(leftIdentifier));
+		}
+		else if (pNode->GetLeft()->GetType() != NT_INDEXED_ACCESS_OPERATOR && pNode->GetLeft()->GetType() != NT_ACCESS_OPERATOR)
+		{
+			_invalidateInductionVariables();
+		}
+
+		return pStoreInstruction;
 	}
 
 	TLLVMIRData CLLVMCodeGenerator::VisitStatementsBlock(CASTBlockNode* pNode)
@@ -350,17 +490,14 @@ namespace gplc
 			_allocateVariableOnStack(currArg.getName(), true);
 		}
 
-		auto pBlock = llvm::BasicBlock::Create(mContext, "entry", mpCurrActiveFunction, mpLoopEndBlock);
+		auto pBlock = llvm::BasicBlock::Create(mContext, "entry", mpCurrActiveFunction, mLoopsStack.empty() ? nullptr : mLoopsStack.back().mpExitBlock);
 		
 		mIRBuildersStack.push(llvm::IRBuilder<>(pBlock));
-		mDefferedExpressionsStack.push({});
+		mDefferedExpressionsStack.push_back({});
+		mScopedAllocasStack.push({});
 
 		E_NODE_TYPE nodeType;
 
-		llvm::BasicBlock* pDeferEndBlock = nullptr;
-
-		bool isDeferUsed = false;
-
 		for (auto pCurrStatement : pNode->GetStatements())
 		{
 			if (mShouldSkipLoopTail)
@@ -371,42 +508,31 @@ namespace gplc
 			nodeType = pCurrStatement->GetType();
 
 			// \note skip rest operators til the end of a loop
-			if ((mShouldSkipLoopTail = ((mpLoopConditionBlock || mpLoopEndBlock) && (nodeType == NT_BREAK_OPERATOR || nodeType == NT_CONTINUE_OPERATOR))) ||
-				(nodeType == NT_RETURN_STATEMENT))
-			{
-				// \note execute defer block before the interrupting operator
-				pDeferEndBlock = _constructDeferBlock(mDefferedExpressionsStack.top());
-
-				if (pDeferEndBlock)
-				{
-					mIRBuildersStack.push(llvm::IRBuilder<>(pDeferEndBlock));
-					isDeferUsed = true;
-				}
-			}
+			mShouldSkipLoopTail = !mLoopsStack.empty() && (nodeType == NT_BREAK_OPERATOR || nodeType == NT_CONTINUE_OPERATOR);
 
+			// \note return, break and continue emit deferred expressions of the blocks they leave by themselves
 			pCurrStatement->Accept(this);
-
-			if (isDeferUsed)
-			{
-				// \note extract pushed "defer_end_block" from the stack
-				mIRBuildersStack.pop();
-			}
 		}
 
-		// \note create deffer block if there is at least one deffered statement in the stack
-		// we should execute this one if block has no any interrupting operator at its end like 'break', 'return' and 'continue'
-		if (!isDeferUsed)
-		{
-			pDeferEndBlock = _constructDeferBlock(mDefferedExpressionsStack.top());
-		}
+		// \note the fallthrough edge leaves only this block, the emission is skipped if the block already ends with return, break or continue
+		_emitDeferredExpressions(mDefferedExpressionsStack.size() - 1);
+
+		// \note lifetimes of the block's locals are finished if the control reaches its end
+		_endScopedLifetimes();
+
+		// \note the code after the block continues in its last basic block, it differs from the first one if there are branches within the block
+		mpLastVisitedEndBlock = mIRBuildersStack.top().GetInsertBlock();
+
+		// \note break and continue skip only the rest of their own block
+		mShouldSkipLoopTail = false;
 
-		mDefferedExpressionsStack.pop();
+		mScopedAllocasStack.pop();
+		mDefferedExpressionsStack.pop_back();
 		mIRBuildersStack.pop();
 
 		mpSymTable->LeaveScope();
 		
-		// \note return defer block if it exists
-		return pDeferEndBlock ? pDeferEndBlock : pBlock;
+		return pBlock;
 	}
 
 	TLLVMIRData CLLVMCodeGenerator::VisitIfStatement(CASTIfStatementNode* pNode)
@@ -425,22 +551,23 @@ namespace gplc
 
 		llvm::BasicBlock* pThenBlock = llvm::dyn_cast<llvm::BasicBlock>(std::get<llvm::Value*>(pNode->GetThenBlock()->Accept(this)));
 		
-		// add end point for then branch
-		if (pThenBlock->back().getOpcode() != llvm::Instruction::Ret)
+		// add end point for then branch, it's skipped if the branch ends with return, break or continue
+		if (!mpLastVisitedEndBlock->getTerminator())
 		{
-			llvm::IRBuilder<> thenBlockIRBuilder{ pThenBlock };
+			llvm::IRBuilder<> thenBlockIRBuilder{ mpLastVisitedEndBlock };
 			thenBlockIRBuilder.CreateBr(pEndBlock);
 		}
 
 		llvm::BasicBlock* pElseBlock = pNode->GetElseBlock() ? llvm::dyn_cast<llvm::BasicBlock>(std::get<llvm::Value*>(pNode->GetElseBlock()->Accept(this))) : nullptr;
 
-		if (pElseBlock)
+		if (pElseBlock && !mpLastVisitedEndBlock->getTerminator())
 		{
 			// add end point for else branch
-			llvm::IRBuilder<> elseBlockIRBuilder{ pElseBlock };
+			llvm::IRBuilder<> elseBlockIRBuilder{ mpLastVisitedEndBlock };
 			elseBlockIRBuilder.CreateBr(pEndBlock);
 		}
-		else
+
+		if (!pElseBlock)
 		{
 			pElseBlock = pEndBlock;
 		}
@@ -459,33 +586,33 @@ namespace gplc
 	{
 		llvm::IRBuilder<>& currIRBuilder = mIRBuildersStack.top();
 
-		//llvm::BasicBlock* pConditionBlock = llvm::BasicBlock::Create(mContext, "cond", mpCurrActiveFunction);
-		llvm::BasicBlock* pEndBlock       = llvm::BasicBlock::Create(mContext, "end", mpCurrActiveFunction);
+		TLoopInfo loopInfo;
+
+		loopInfo.mpExitBlock  = llvm::BasicBlock::Create(mContext, "loop_exit", mpCurrActiveFunction);
+		loopInfo.mpLatchBlock = llvm::BasicBlock::Create(mContext, "loop_latch"); // \note the latch is inserted after the body
 
-		mpLoopConditionBlock = nullptr; // the member is used for break and continue operators
-		mpLoopEndBlock       = pEndBlock;
+		loopInfo.mDeferredScopesCount = mDefferedExpressionsStack.size();
+
+		// \note the loop has no condition, so indices within its body are checked up as is
+		mLoopsStack.push_back(loopInfo);
 
 		llvm::BasicBlock* pLoopBody = llvm::dyn_cast<llvm::BasicBlock>(std::get<llvm::Value*>(pNode->GetBody()->Accept(this)));
 
+		llvm::BasicBlock* pLoopBodyEndBlock = mpLastVisitedEndBlock;
+
+		mLoopsStack.pop_back();
+
+		// \note there is no condition, so the first block of the body is the loop's header
+		loopInfo.mpHeaderBlock = pLoopBody;
+
 		// link loop with its parent block
-		
 		currIRBuilder.CreateBr(pLoopBody);
 
-		llvm::IRBuilder<> loopIRBuilder { pLoopBody };
-		
-		if (!mShouldSkipLoopTail)
-		{
-			loopIRBuilder.CreateBr(pLoopBody);
-		}
-		
-		currIRBuilder.SetInsertPoint(pEndBlock);
-
-		mpLastVisitedEndBlock = pEndBlock;
+		_emitLoopLatch(loopInfo, pLoopBodyEndBlock, pNode->GetAttributes(), pNode->GetHints());
 
-		mpLoopConditionBlock = nullptr;
-		mpLoopEndBlock       = nullptr;
+		currIRBuilder.SetInsertPoint(loopInfo.mpExitBlock);
 
-		mShouldSkipLoopTail = false;
+		mpLastVisitedEndBlock = loopInfo.mpExitBlock;
 
 		return pLoopBody;
 	}
@@ -494,40 +621,43 @@ namespace gplc
 	{
 		llvm::IRBuilder<>& currIRBuilder = mIRBuildersStack.top();
 
-		llvm::BasicBlock* pConditionBlock = llvm::BasicBlock::Create(mContext, "cond", mpCurrActiveFunction);
+		TLoopInfo loopInfo;
 
-		mIRBuildersStack.push(llvm::IRBuilder<>(pConditionBlock));
+		loopInfo.mpHeaderBlock = llvm::BasicBlock::Create(mContext, "loop_header", mpCurrActiveFunction);
+		loopInfo.mpExitBlock   = llvm::BasicBlock::Create(mContext, "loop_exit", mpCurrActiveFunction);
+		loopInfo.mpLatchBlock  = llvm::BasicBlock::Create(mContext, "loop_latch"); // \note the latch is inserted after the body
+
+		mIRBuildersStack.push(llvm::IRBuilder<>(loopInfo.mpHeaderBlock));
 		llvm::Value* pLoopCondition = std::get<llvm::Value*>(pNode->GetCondition()->Accept(this));
+		llvm::BasicBlock* pConditionEndBlock = mIRBuildersStack.top().GetInsertBlock();
 		mIRBuildersStack.pop();
 
-		llvm::BasicBlock* pEndBlock = llvm::BasicBlock::Create(mContext, "end", mpCurrActiveFunction);
+		loopInfo.mInductionVariable = _getInductionVariableInfo(pNode);
 
-		mpLoopConditionBlock = pConditionBlock; // the member is used for break and continue operators
-		mpLoopEndBlock       = pEndBlock;
+		// \note the preheader is the current block, it's the only predecessor of the header besides the latch
+		loopInfo.mInductionVariable.mpPreheaderTerminator = currIRBuilder.CreateBr(loopInfo.mpHeaderBlock);
 
-		currIRBuilder.CreateBr(pConditionBlock);
+		loopInfo.mDeferredScopesCount = mDefferedExpressionsStack.size();
+
+		mLoopsStack.push_back(loopInfo);
 
 		llvm::BasicBlock* pLoopBody = llvm::dyn_cast<llvm::BasicBlock>(std::get<llvm::Value*>(pNode->GetBody()->Accept(this)));
 
-		// create loop to condition's check up
-		llvm::IRBuilder<> loopIRBuilder { pLoopBody };
+		llvm::BasicBlock* pLoopBodyEndBlock = mpLastVisitedEndBlock;
 
-		if (!mShouldSkipLoopTail)
-		{
-			loopIRBuilder.CreateBr(pConditionBlock);
-		}
+		loopInfo.mInductionVariable = mLoopsStack.back().mInductionVariable;
 
-		currIRBuilder.SetInsertPoint(pConditionBlock);
-		llvm::Value* pBRInstruction = currIRBuilder.CreateCondBr(pLoopCondition, pLoopBody, pEndBlock);
+		mLoopsStack.pop_back();
 
-		currIRBuilder.SetInsertPoint(pEndBlock);
+		llvm::Value* pBRInstruction = llvm::IRBuilder<>(pConditionEndBlock).CreateCondBr(pLoopCondition, pLoopBody, loopInfo.mpExitBlock);
 
-		mpLastVisitedEndBlock = pEndBlock;
+		_emitLoopLatch(loopInfo, pLoopBodyEndBlock, pNode->GetAttributes(), pNode->GetHints());
 
-		mpLoopConditionBlock = nullptr;
-		mpLoopEndBlock       = nullptr;
+		_hoistBoundsChecks(loopInfo, pLoopBody);
 
-		mShouldSkipLoopTail = false;
+		currIRBuilder.SetInsertPoint(loopInfo.mpExitBlock);
+
+		mpLastVisitedEndBlock = loopInfo.mpExitBlock;
 
 		return pBRInstruction;
 	}
@@ -557,6 +687,9 @@ namespace gplc
 
 		auto pNodeArgs = pNode->GetArgs();
 
+		// \note a callee can change any variable which address has escaped
+		_invalidateInductionVariables();
+
 		if (!pNodeArgs)
 		{
 			return currIRBuilder.CreateCall(pCallee);
@@ -582,7 +715,18 @@ namespace gplc
 				{
 					CType* pType = mpTypeResolver->Resolve(dynamic_cast<CASTTypeNode*>(pArgs->GetChildren()[0]));
 
-					return llvm::ConstantInt::get(llvm::Type::getInt64Ty(mContext), pType->GetSize());
+					// \note the types system knows alignments of the target, so the size is the same as the interpreter evaluates for globals
+					const U64 typeSize = pType->GetSize();
+
+#if !defined(NDEBUG)
+					TLLVMIRData typeData = pType->Accept(mpTypeGenerator);
+
+					llvm::Type** ppInternalType = std::get_if<llvm::Type*>(&typeData);
+
+					assert(!ppInternalType || !*ppInternalType || !(*ppInternalType)->isSized() || (mpModule->getDataLayout().getTypeAllocSize(*ppInternalType) == typeSize));
+#endif
+
+					return llvm::ConstantInt::get(llvm::Type::getInt64Ty(mContext), typeSize);
 				}
 			case NT_TYPEID_OPERATOR:
 				{
@@ -609,6 +753,8 @@ namespace gplc
 					
 					args.push_back(llvm::ConstantInt::getFalse(mContext));
 
+					_invalidateInductionVariables(); // \note the destination can contain any variable
+
 					return irBuilder.CreateIntrinsic(llvm::Intrinsic::memcpy, types, args);
 				}
 			case NT_MEMSET32_INTRINSIC:
@@ -630,6 +776,8 @@ namespace gplc
 
 					args.push_back(llvm::ConstantInt::getFalse(mContext));
 
+					_invalidateInductionVariables();
+
 					// \todo FIXME: this intrinsic doesn't work
 					return irBuilder.CreateIntrinsic(llvm::Intrinsic::memset, types, args);
 				}
@@ -653,12 +801,17 @@ namespace gplc
 	{
 		auto& currIRBuilder = mIRBuildersStack.top();
 
-		if (!pNode->GetExpr())
+		// \note the returned value is evaluated before deferred expressions of all blocks of the function are executed
+		llvm::Value* pReturnValue = pNode->GetExpr() ? std::get<llvm::Value*>(pNode->GetExpr()->Accept(this)) : nullptr;
+
+		_emitDeferredExpressions(0);
+
+		if (!pReturnValue)
 		{
 			return currIRBuilder.CreateRetVoid();
 		}
 
-		return currIRBuilder.CreateRet(std::get<llvm::Value*>(pNode->GetExpr()->Accept(this)));
+		return currIRBuilder.CreateRet(pReturnValue);
 	}
 
 	TLLVMIRData CLLVMCodeGenerator::VisitDefinitionNode(CASTDefinitionNode* pNode)
@@ -675,6 +828,8 @@ namespace gplc
 		llvm::Type* pIdentifiersType   = nullptr;
 		llvm::Value* pIdentifiersValue = nullptr;
 
+		llvm::Constant* pStaticInitializer = nullptr;
+
 		auto& irBuilder = isGlobalScope ? *mpInitModuleGlobalsIRBuilder : mIRBuildersStack.top();
 		
 		for (auto pCurrIdentifier : pIdentifiers)
@@ -690,7 +845,16 @@ namespace gplc
 			// compute only once, because all identifiers are the same type
 			pIdentifiersType = pIdentifiersType ? pIdentifiersType : std::get<llvm::Type*>(pType->Accept(mpTypeGenerator));
 
-			pIdentifiersValue = pIdentifiersValue ? pIdentifiersValue : std::get<llvm::Value*>(pNode->GetValue()->Accept(this));
+			// \note a global with a value that is known in compile time is initialized statically, the init function doesn't touch it
+			if (isGlobalScope && !pIdentifiersValue && !pStaticInitializer)
+			{
+				pStaticInitializer = _createStaticInitializer(pNode->GetValue(), pType, pIdentifiersType);
+			}
+
+			if (!pStaticInitializer)
+			{
+				pIdentifiersValue = pIdentifiersValue ? pIdentifiersValue : std::get<llvm::Value*>(pNode->GetValue()->Accept(this));
+			}
 			
 			llvm::Value* pCurrVariableAllocation = nullptr;
 
@@ -700,15 +864,22 @@ namespace gplc
 
 				pCurrVariableAllocation = mpModule->getOrInsertGlobal(mangledIdentifier, pIdentifiersType);
 
-				mpModule->getGlobalVariable(mangledIdentifier)->setInitializer(llvm::Constant::getNullValue(pIdentifiersType));
+				mpModule->getGlobalVariable(mangledIdentifier)->setInitializer(pStaticInitializer ? pStaticInitializer : llvm::Constant::getNullValue(pIdentifiersType));
 			}
 			else
 			{
-				pCurrVariableAllocation = irBuilder.CreateAlloca(pIdentifiersType, nullptr, dynamic_cast<CASTIdentifierNode*>(pCurrIdentifier)->GetName());
+				pCurrVariableAllocation = _createEntryBlockAlloca(pIdentifiersType, dynamic_cast<CASTIdentifierNode*>(pCurrIdentifier)->GetName());
+
+				_startScopedLifetime(pCurrVariableAllocation);
 			}
 
 			mVariablesTable[mpSymTable->GetSymbolHandleByName(currIdentifierName)] = pCurrVariableAllocation;
 
+			if (pStaticInitializer)
+			{
+				continue;
+			}
+
 			if (pType->GetType() == CT_POINTER && pIdentifiersValue->getType()->isIntegerTy())
 			{
 				// \note this case is for null literal which is represented via 0 value of i32 type
@@ -755,7 +926,13 @@ namespace gplc
 
 		llvm::Function* pPrevActiveFunction = mpCurrActiveFunction;
 
-		mpCurrActiveFunction = llvm::Function::Create(pLambdaFunctionType, llvm::Function::ExternalLinkage, lambdaName, mpModule);
+		// \note other modules access the function through its pointer, so the function itself isn't visible outside of the module
+		mpCurrActiveFunction = llvm::Function::Create(pLambdaFunctionType, llvm::Function::InternalLinkage, lambdaName, mpModule);
+
+		llvm::BasicBlock* pPrevAllocasBlock = mpCurrAllocasBlock;
+
+		// \note all local variables of the function are allocated here, this block jumps into the function's body
+		mpCurrAllocasBlock = llvm::BasicBlock::Create(mContext, "allocas", mpCurrActiveFunction);
 
 		// set names for function's arguments
 		auto funcArgsTypes = pInternalLambdaType->GetArgsTypes();
@@ -773,33 +950,92 @@ namespace gplc
 		
 		llvm::IRBuilder<>* pCurrIRBuilder = isGlobalScope ? mpInitModuleGlobalsIRBuilder : &mIRBuildersStack.top();
 
+		// \note a pointer to a local function belongs to the enclosing one
+		llvm::BasicBlock* pFuncAllocasBlock = mpCurrAllocasBlock;
+
+		mpCurrAllocasBlock = pPrevAllocasBlock;
+
+		TSymbolHandle funcHandle = mpSymTable->GetSymbolHandleByName(pFuncIdentifierNode->GetName());
+
+		_setFunctionAttributes(mpCurrActiveFunction, pNode, mpSymTable->LookUp(funcHandle)->mpType, pInternalLambdaType);
+
+		// \note a function which is never reassigned is called directly, its pointer is kept only for other modules that import it.
+		// The semantic analyser doesn't allow importers to reassign the function, so its value is the same for all modules
+		bool isImmutable = !mpSymTable->LookUp(funcHandle)->mIsReassigned;
+
+		if (isImmutable)
+		{
+			mDirectCalleesTable[funcHandle] = mpCurrActiveFunction;
+		}
+
 		// assign address of the lambda to the function pointer
-		llvm::Value* pLValueFuncPointer = nullptr;
+		llvm::Value* pLValueFuncPointer       = nullptr;
+		llvm::Value* pLValueAssignInstruction = mpCurrActiveFunction;
 		
 		if (isGlobalScope)
 		{
 			pLValueFuncPointer = mpModule->getOrInsertGlobal(lValueIdentifier, pLValueFnType);
 
-			mpModule->getGlobalVariable(lValueIdentifier)->setInitializer(mpCurrActiveFunction);
+			llvm::GlobalVariable* pFuncPointerVariable = mpModule->getGlobalVariable(lValueIdentifier);
+
+			// \note importers can't reassign functions of a module, so the pointer is a constant if the module itself doesn't change it
+			pFuncPointerVariable->setInitializer(mpCurrActiveFunction);
+			pFuncPointerVariable->setConstant(isImmutable);
 		}
-		else
+		else if (!isImmutable)
 		{
-			pLValueFuncPointer = pCurrIRBuilder->CreateAlloca(pLValueFnType, nullptr, lValueIdentifier);
+			pLValueFuncPointer = _createEntryBlockAlloca(pLValueFnType, lValueIdentifier);
+
+			_startScopedLifetime(pLValueFuncPointer);
 		}
 
-		llvm::Value* pLValueAssignInstruction = pCurrIRBuilder->CreateStore(pCurrIRBuilder->CreateBitOrPointerCast(mpCurrActiveFunction, pLValueFnType), pLValueFuncPointer);
+		if (pLValueFuncPointer)
+		{
+			mVariablesTable[funcHandle] = pLValueFuncPointer;
+		}
 
-		mVariablesTable[mpSymTable->GetSymbolHandleByName(pFuncIdentifierNode->GetName())] = pLValueFuncPointer;
+		// \note the initializer of a global pointer is already set, so the store is needed only if it can be reassigned later
+		if (!isImmutable)
+		{
+			pLValueAssignInstruction = pCurrIRBuilder->CreateStore(pCurrIRBuilder->CreateBitOrPointerCast(mpCurrActiveFunction, pLValueFnType), pLValueFuncPointer);
+		}
 
 		mpLastVisitedEndBlock = nullptr; // \note if this pointer will be changed later, it means there are loops, conditional branches, etc
 
+		mpCurrAllocasBlock = pFuncAllocasBlock;
+
+		bool prevAreBoundsChecksEnabled = mAreBoundsChecksEnabled;
+
+		mAreBoundsChecksEnabled = mAreBoundsChecksEnabled && !(mpSymTable->LookUp(funcHandle)->mpType->GetAttributes() & AV_UNCHECKED_ACCESS);
+
+		// \note loops and deferred expressions of the enclosing function don't affect the body
+		TLoopsArray prevLoopsStack = std::move(mLoopsStack);
+
+		TDeferredExpressionStack prevDeferredExpressionsStack = std::move(mDefferedExpressionsStack);
+
+		mLoopsStack.clear();
+		mDefferedExpressionsStack.clear();
+
 		// generate its definition
 		llvm::BasicBlock* pBlock = llvm::dyn_cast<llvm::BasicBlock>(std::get<llvm::Value*>(pNode->GetValue()->Accept(this)));
 
+		llvm::BasicBlock* pBodyEndBlock = mpLastVisitedEndBlock ? mpLastVisitedEndBlock : pBlock;
+
+		mLoopsStack = std::move(prevLoopsStack);
+
+		mDefferedExpressionsStack = std::move(prevDeferredExpressionsStack);
+
+		mAreBoundsChecksEnabled = prevAreBoundsChecksEnabled;
+
+		// \note the body's block is the next one after the allocas' block
+		llvm::IRBuilder<>(pFuncAllocasBlock).CreateBr(pFuncAllocasBlock->getNextNode());
+
+		mpCurrAllocasBlock = pPrevAllocasBlock;
+
 		// \note skip this condition if there is return statement already
-		if (pInternalLambdaType->IsProcedure() && pBlock->getInstList().back().getOpcode() != llvm::Instruction::Ret)
+		if (pInternalLambdaType->IsProcedure() && !pBodyEndBlock->getTerminator())
 		{
-			llvm::IRBuilder<> funcBodyIRBuilder(mpLastVisitedEndBlock ? mpLastVisitedEndBlock : pBlock);
+			llvm::IRBuilder<> funcBodyIRBuilder(pBodyEndBlock);
 
 			funcBodyIRBuilder.CreateRetVoid();
 		}
@@ -835,8 +1071,11 @@ namespace gplc
 
 		llvm::Type* pStructType = std::get<llvm::Type*>(pStructSymbolDesc->mpType->Accept(mpTypeGenerator));
 
-		// define struct's constructor
-		_defineStructTypeConstructor(dynamic_cast<CStructType*>(pStructSymbolDesc->mpType));
+		// \note the constructor is needed only if some of default values aren't known in compile time
+		if (!_getStructDefaultInitializer(pStructSymbolDesc->mpType))
+		{
+			_defineStructTypeConstructor(dynamic_cast<CStructType*>(pStructSymbolDesc->mpType));
+		}
 
 		return pStructType;
 	}
@@ -855,14 +1094,18 @@ namespace gplc
 	{
 		auto& currIRBuilder = mIRBuildersStack.top();
 
-		return currIRBuilder.CreateBr(mpLoopEndBlock);
+		_emitDeferredExpressions(mLoopsStack.back().mDeferredScopesCount);
+
+		return currIRBuilder.CreateBr(mLoopsStack.back().mpExitBlock);
 	}
 
 	TLLVMIRData CLLVMCodeGenerator::VisitContinueOperator(CASTContinueOperatorNode* pNode)
 	{
 		auto& currIRBuilder = mIRBuildersStack.top();
 
-		return currIRBuilder.CreateBr(mpLoopConditionBlock ? mpLoopConditionBlock : currIRBuilder.GetInsertBlock());
+		_emitDeferredExpressions(mLoopsStack.back().mDeferredScopesCount);
+
+		return currIRBuilder.CreateBr(mLoopsStack.back().mpLatchBlock);
 	}
 
 	TLLVMIRData CLLVMCodeGenerator::VisitAccessOperator(CASTAccessOperatorNode* pNode)
@@ -906,12 +1149,7 @@ namespace gplc
 		// get type's description
 		auto pTypeDesc = mpSymTable->LookUpNamedScope(pExprType->GetName());
 
-		E_COMPILER_TYPES objectType = pExprType->GetType();
-
-		bool isCompoundType = objectType == CT_ENUM || objectType == CT_STRUCT || objectType == CT_MODULE;
-
-		TSymbolHandle firstFieldId = isCompoundType ? pTypeDesc->mVariables.begin()->second: 0x0;
-		TSymbolHandle currFieldId  = 0x0;
+		TSymbolHandle currFieldId = 0x0;
 
 		TSymbolDesc* pFieldValue = nullptr;
 
@@ -947,11 +1185,17 @@ namespace gplc
 
 				pFieldValue = mpSymTable->LookUp(currFieldId);
 
-				pCurrValue = currIRBuilder.CreateGEP(std::get<llvm::Value*>(pNode->GetExpression()->Accept(this)),
-												{
-													llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), 0),
-													llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), currFieldId - firstFieldId)
-												});
+				// \note arr[i].field of @soa array is lowered into arr.field[i] without touching other fields
+				pCurrValue = _getSoAElementFieldAddress(pNode->GetExpression(), dynamic_cast<CStructType*>(pTypeDesc->mpType)->GetFieldIndex(identifier));
+
+				if (!pCurrValue)
+				{
+					pCurrValue = currIRBuilder.CreateGEP(std::get<llvm::Value*>(pNode->GetExpression()->Accept(this)),
+													{
+														llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), 0),
+														llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), dynamic_cast<CStructType*>(pTypeDesc->mpType)->GetFieldIndex(identifier))
+													});
+				}
 
 				if (dynamic_cast<CASTUnaryExpressionNode*>(pMemberNode->GetData())->GetData()->GetAttributes() & AV_RVALUE)
 				{
@@ -980,6 +1224,9 @@ namespace gplc
 			case CT_ARRAY:
 				// \note for now there is only "length" field available for arrays
 				return currIRBuilder.CreateLoad(_getStructElementValue(currIRBuilder, std::get<llvm::Value*>(pNode->GetExpression()->Accept(this)), 1), "arr_get_length");
+			case CT_STRING:
+				// \note for now there is only "length" field available for strings
+				return _emitStringLength(pNode->GetExpression());
 		}
 
 		return {};
@@ -997,6 +1244,11 @@ namespace gplc
 		llvm::Value* pPrimaryExprCode = _getStructElementValue(currIRBuilder, std::get<llvm::Value*>(pNode->GetExpression()->Accept(this)), 0);
 		llvm::Value* pIndexExprCode   = std::get<llvm::Value*>(pNode->GetIndexExpression()->Accept(this));
 
+		if (auto pArrayType = dynamic_cast<CArrayType*>(pNode->GetExpression()->Resolve(mpTypeResolver)))
+		{
+			_emitBoundsCheck(pArrayType, pNode->GetIndexExpression(), pIndexExprCode);
+		}
+
 		U32 attributes = pNode->GetAttributes();
 
 		auto pAccessInstruction = currIRBuilder.CreateGEP(pPrimaryExprCode, { llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), 0), pIndexExprCode }, "arr_access");
@@ -1030,9 +1282,7 @@ namespace gplc
 
 	TLLVMIRData CLLVMCodeGenerator::VisitDeferOperatorNode(CASTDeferOperatorNode* pNode)
 	{
-		auto& currBlockDefferedStmts = mDefferedExpressionsStack.top();
-
-		currBlockDefferedStmts.push(pNode->GetExpr());
+		mDefferedExpressionsStack.back().push_back({ pNode->GetExpr(), mpSymTable->GetCurrentScopeHandle() });
 
 		return {};
 	}
@@ -1131,73 +1381,968 @@ namespace gplc
 		// resolve type into LLVM IR
 		llvm::Type* pIdentifierType = std::get<llvm::Type*>(symbolDesc->mpType->Accept(mpTypeGenerator));
 
-		auto pAllocateInstruction = mIRBuildersStack.top().CreateAlloca(pIdentifierType, nullptr, identifier);
+		auto pAllocateInstruction = _createEntryBlockAlloca(pIdentifierType, identifier);
 
 		 mVariablesTable[symbolHandle] = pAllocateInstruction;
 
 		return pAllocateInstruction;
 	}
 
-	void CLLVMCodeGenerator::_defineEntryPoint()
+	llvm::Constant* CLLVMCodeGenerator::_createStaticInitializer(CASTNode* pValue, CType* pType, llvm::Type* pInternalType)
 	{
-		auto pMainFuncType = llvm::FunctionType::get(llvm::Type::getInt32Ty(mContext), 
-													{
-														llvm::Type::getInt32Ty(mContext),
-														llvm::PointerType::get(llvm::Type::getInt8PtrTy(mContext), 0)
-													}, false);
+		auto pValueExpr = dynamic_cast<CASTExpressionNode*>(pValue);
 
-		auto pMainFunctionDef = llvm::Function::Create(pMainFuncType, llvm::Function::ExternalLinkage, "main", mpModule);
+		if (!pValueExpr || !_isStaticallyEvaluable(pValueExpr))
+		{
+			return nullptr;
+		}
 
-		llvm::BasicBlock* pMainFuncBody = llvm::BasicBlock::Create(mContext, "entry", pMainFunctionDef);
+		auto evalResult = mpConstExprInterpreter->EvalValue(pValueExpr, mpSymTable);
 
-		llvm::IRBuilder<> mainFuncIRBuidler(pMainFuncBody);
+		if (evalResult.HasError())
+		{
+			return nullptr;
+		}
 
-		// initialize all global variables of the module
-		mainFuncIRBuidler.CreateCall(mpInitModuleGlobalsFunction, {});
+		const TConstValue& value = evalResult.Get();
 
-		// call _lang_main_entry function
-		auto pLangEntryFuncType = mVariablesTable[mpSymTable->GetSymbolHandleByName("_lang_main_entry")];
+		switch (pType->GetType())
+		{
+			case CT_INT8:
+			case CT_INT16:
+			case CT_INT32:
+			case CT_INT64:
+			case CT_UINT8:
+			case CT_UINT16:
+			case CT_UINT32:
+			case CT_UINT64:
+			case CT_ENUM:
+				if (const I64* pIntValue = std::get_if<I64>(&value.mValue))
+				{
+					return llvm::ConstantInt::get(pInternalType, static_cast<U64>(*pIntValue), true);
+				}
 
-		auto pDerreferencedFnPtr = mainFuncIRBuidler.CreateLoad(pLangEntryFuncType, "_lang_main_entry");
+				if (const U64* pUIntValue = std::get_if<U64>(&value.mValue))
+				{
+					return llvm::ConstantInt::get(pInternalType, *pUIntValue, false);
+				}
 
-		mainFuncIRBuidler.CreateRet(mainFuncIRBuidler.CreateCall(pDerreferencedFnPtr, {}));
-	}
+				break;
+			case CT_FLOAT:
+			case CT_DOUBLE:
+				if (const F64* pFloatValue = std::get_if<F64>(&value.mValue))
+				{
+					return llvm::ConstantFP::get(pInternalType, *pFloatValue);
+				}
 
-	void CLLVMCodeGenerator::_defineInitModuleGlobalsFunction()
-	{
-		auto pInitModuleGlobalsFuncType = llvm::FunctionType::get(llvm::Type::getVoidTy(mContext), false);
-		
-		std::string moduleName = mpModule->getName();
-		moduleName = moduleName.substr(0, moduleName.find_first_of('.'));
+				break;
+			case CT_BOOL:
+				if (const bool* pBoolValue = std::get_if<bool>(&value.mValue))
+				{
+					return llvm::ConstantInt::get(pInternalType, *pBoolValue);
+				}
 
-		// \note create flag that tells was the module initialized or not
-		auto boolType = llvm::Type::getInt1Ty(mContext);
+				break;
+		}
 
-		auto isModuleInitialized = mpModule->getOrInsertGlobal(std::string("is_").append(moduleName).append("_initialized"), boolType);
+		return nullptr;
+	}
 
-		llvm::dyn_cast<llvm::GlobalVariable>(isModuleInitialized)->setInitializer(llvm::ConstantInt::get(boolType, 0));
+	llvm::Constant* CLLVMCodeGenerator::_createDefaultStaticInitializer(CType* pType, CASTNode* pValue, llvm::Type* pInternalType)
+	{
+		switch (pType->GetType())
+		{
+			case CT_STRUCT:
+				return _getStructDefaultInitializer(pType);
+			case CT_ARRAY:
+				{
+					auto pArrayFatType = llvm::dyn_cast<llvm::StructType>(pInternalType);
 
-		mpInitModuleGlobalsFunction = llvm::Function::Create(pInitModuleGlobalsFuncType, llvm::Function::ExternalLinkage, _getInitModuleFuncName(moduleName), mpModule);
-		
-		llvm::BasicBlock* pInitModuleGlobalsFuncBody = llvm::BasicBlock::Create(mContext, "entry", mpInitModuleGlobalsFunction);
+					return llvm::ConstantStruct::get(pArrayFatType, 
+													 { 
+														 llvm::Constant::getNullValue(pArrayFatType->getElementType(0)),
+														 llvm::ConstantInt::get(llvm::Type::getInt64Ty(mContext), dynamic_cast<CArrayType*>(pType)->GetElementsCount())
+													 });
+				}
+			case CT_POINTER:
+			case CT_VARIANT:
+				{
+					// \note a pointer's default is either null or 0, a variant's one is zero tag
+					auto pLiteral = dynamic_cast<CASTLiteralNode*>(pValue);
 
-		mpInitModuleGlobalsIRBuilder = new llvm::IRBuilder<>(pInitModuleGlobalsFuncBody);
+					for (auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pValue); pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT; )
+					{
+						pLiteral   = dynamic_cast<CASTLiteralNode*>(pUnaryExpr->GetData());
+						pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pUnaryExpr->GetData());
+					}
 
-		// \note assign true to is_<module-name>_initialized variable
-		mpInitModuleGlobalsIRBuilder->CreateStore(llvm::ConstantInt::getTrue(mContext), isModuleInitialized);
+					if (!pLiteral)
+					{
+						return nullptr;
+					}
 
-		// \note add check up whether the module's globals were initialized or not to prevent doubled initialization
-		llvm::IRBuilder<> preConditionIRBuilder(llvm::BasicBlock::Create(mContext, "pre_cond_entry", mpInitModuleGlobalsFunction, pInitModuleGlobalsFuncBody));
-		
-		llvm::BasicBlock* pTruePreConditionBlock = llvm::BasicBlock::Create(mContext, "already_initialized", mpInitModuleGlobalsFunction);
+					CBaseValue* pLiteralValue = pLiteral->GetValue();
 
-		preConditionIRBuilder.CreateCondBr(preConditionIRBuilder.CreateLoad(isModuleInitialized), pTruePreConditionBlock, pInitModuleGlobalsFuncBody);
+					bool isZero = (pLiteralValue->GetType() == LT_POINTER) || 
+								  (pLiteralValue->GetType() == LT_INT && dynamic_cast<CIntValue*>(pLiteralValue)->GetValue() == 0);
 
-		llvm::IRBuilder<> trueConditionIRBuilder(pTruePreConditionBlock);
-		trueConditionIRBuilder.CreateRetVoid();
+					return isZero ? llvm::Constant::getNullValue(pInternalType) : nullptr;
+				}
+		}
+
+		return _createStaticInitializer(pValue, pType, pInternalType);
 	}
 
-	llvm::Value* CLLVMCodeGenerator::_declareNativeFunction(const TSymbolDesc* pFuncDesc)
+	llvm::Constant* CLLVMCodeGenerator::_getStructDefaultInitializer(CType* pType)
+	{
+		if (auto pNamedType = dynamic_cast<CDependentNamedType*>(pType))
+		{
+			pType = pNamedType->GetDependentType();
+		}
+
+		auto pStructType = dynamic_cast<CStructType*>(pType);
+
+		assert(pStructType);
+
+		const std::string& structName = pStructType->GetMangledName();
+
+		auto iter = mStructDefaultsTable.find(structName);
+
+		if (iter != mStructDefaultsTable.cend())
+		{
+			return iter->second;
+		}
+
+		auto pInternalStructType = llvm::dyn_cast<llvm::StructType>(std::get<llvm::Type*>(pStructType->Accept(mpTypeGenerator)));
+
+		std::vector<llvm::Constant*> fieldsValues(pInternalStructType->getNumElements(), nullptr);
+
+		bool isConstant = true;
+
+		auto evalFieldsDefaults = [&, this](ISymTable* pSymTable)
+		{
+			auto pTypeDesc = pSymTable->LookUpNamedScope(pStructType->GetName());
+
+			for (auto currFieldTypeInfo : pStructType->GetFieldsTypes())
+			{
+				I32 fieldIndex = pStructType->GetFieldIndex(currFieldTypeInfo.first);
+
+				const TSymbolDesc* pFieldDesc = pSymTable->LookUp(pTypeDesc->mVariables[currFieldTypeInfo.first]);
+
+				fieldsValues[fieldIndex] = _createDefaultStaticInitializer(currFieldTypeInfo.second, pFieldDesc->mpValue, pInternalStructType->getElementType(fieldIndex));
+
+				if (!fieldsValues[fieldIndex])
+				{
+					isConstant = false;
+
+					return;
+				}
+			}
+		};
+
+		const CType* pModuleType = pStructType->GetParent();
+
+		// \note a structure of an imported module isn't visible by its name, so its scope is visited through the module's one
+		if (pModuleType && pModuleType->GetType() == CT_MODULE)
+		{
+			mpSymTable->VisitNamedScopeWithRestore(pModuleType->GetName(), [&](ISymTable* pSymTable)
+			{
+				pSymTable->VisitNamedScopeWithRestore(pStructType->GetName(), evalFieldsDefaults);
+			});
+		}
+		else
+		{
+			mpSymTable->VisitNamedScopeWithRestore(pStructType->GetName(), evalFieldsDefaults);
+		}
+
+		llvm::Constant* pDefaultValue = isConstant ? llvm::ConstantStruct::get(pInternalStructType, fieldsValues) : nullptr;
+
+		mStructDefaultsTable[structName] = pDefaultValue;
+
+		return pDefaultValue;
+	}
+
+	llvm::Constant* CLLVMCodeGenerator::_getStructDefaultTemplate(CType* pType, llvm::Constant* pDefaultValue)
+	{
+		const std::string templateName = pType->GetMangledName() + "$default";
+
+		if (auto pTemplate = mpModule->getNamedGlobal(templateName))
+		{
+			return pTemplate;
+		}
+
+		auto pTemplate = new llvm::GlobalVariable(*mpModule, pDefaultValue->getType(), true, llvm::GlobalValue::PrivateLinkage, pDefaultValue, templateName);
+
+		pTemplate->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+
+		return pTemplate;
+	}
+
+	bool CLLVMCodeGenerator::_isStaticallyEvaluable(CASTNode* pNode) const
+	{
+		if (!pNode)
+		{
+			return false;
+		}
+
+		switch (pNode->GetType())
+		{
+			// \note values of global variables aren't known in compile time, because CSymTable stores their defaults only
+			case NT_IDENTIFIER:
+			case NT_FUNC_CALL:
+				return false;
+			// \note the interpreter accepts only enumerators here
+			case NT_ACCESS_OPERATOR:
+			case NT_SIZEOF_OPERATOR:
+			case NT_TYPEID_OPERATOR:
+				return true;
+			case NT_CAST_INTRINSIC:
+				return _isStaticallyEvaluable(dynamic_cast<CASTIntrinsicCallNode*>(pNode)->GetArgs()->GetChildren()[1]);
+		}
+
+		for (auto pCurrChild : pNode->GetChildren())
+		{
+			if (pCurrChild && !_isStaticallyEvaluable(pCurrChild))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void CLLVMCodeGenerator::_emitBoundsCheck(CArrayType* pArrayType, CASTExpressionNode* pIndexExpr, llvm::Value* pIndexValue)
+	{
+		if (!mAreBoundsChecksEnabled || (pArrayType->GetAttributes() & AV_UNCHECKED_ACCESS))
+		{
+			return;
+		}
+
+		const U64 length = pArrayType->GetElementsCount();
+
+		CType* pIndexType = mpTypeResolver->Resolve(pIndexExpr);
+
+		const bool isSigned = !pIndexType || !pIndexType->IsUnsignedInteger();
+
+		if (_isIndexInRange(pIndexExpr, pIndexValue, isSigned, length))
+		{
+			return;
+		}
+
+		auto& irBuilder = mIRBuildersStack.top();
+
+		llvm::Type* pIndexInternalType = llvm::Type::getInt64Ty(mContext);
+
+		// \note a negative index becomes a huge unsigned one, so a single comparison is enough
+		llvm::Value* pIndex = isSigned ? irBuilder.CreateSExtOrTrunc(pIndexValue, pIndexInternalType) : irBuilder.CreateZExtOrTrunc(pIndexValue, pIndexInternalType);
+
+		llvm::CallInst* pCheck = irBuilder.CreateCall(_getBoundsCheckFunction(), { pIndex, llvm::ConstantInt::get(pIndexInternalType, length) });
+
+		// \note the check can be replaced with the check up of the initial value when the loop's body is generated
+		TInductionVariableInfo* pInductionVariable = _getInductionVariableOfIndex(pIndexExpr, length);
+
+		if (pInductionVariable && pInductionVariable->mIsMonotonic)
+		{
+			pInductionVariable->mHoistableChecks.push_back(pCheck);
+		}
+	}
+
+	bool CLLVMCodeGenerator::_isIndexInRange(CASTExpressionNode* pIndexExpr, llvm::Value* pIndexValue, bool isSigned, U64 length)
+	{
+		if (auto pConstantIndex = llvm::dyn_cast<llvm::ConstantInt>(pIndexValue))
+		{
+			return isSigned ? (pConstantIndex->getSExtValue() >= 0 && static_cast<U64>(pConstantIndex->getSExtValue()) < length) : 
+							  (pConstantIndex->getZExtValue() < length);
+		}
+
+		TInductionVariableInfo* pInductionVariable = _getInductionVariableOfIndex(pIndexExpr, length);
+
+		return pInductionVariable && pInductionVariable->mIsLowerBoundProven;
+	}
+
+	CLLVMCodeGenerator::TInductionVariableInfo* CLLVMCodeGenerator::_getInductionVariableOfIndex(CASTExpressionNode* pIndexExpr, U64 length)
+	{
+		// \note facts of outer loops aren't used, because an inner loop can change their variables before the access on its next iteration
+		if (mLoopsStack.empty())
+		{
+			return nullptr;
+		}
+
+		TInductionVariableInfo& inductionVariable = mLoopsStack.back().mInductionVariable;
+
+		const std::string& indexName = _getPlainIdentifierName(pIndexExpr);
+
+		if (!inductionVariable.mIsValid || inductionVariable.mUpperBound > length || indexName.empty() || 
+			inductionVariable.mVariableHandle != mpSymTable->GetSymbolHandleByName(indexName))
+		{
+			return nullptr;
+		}
+
+		return &inductionVariable;
+	}
+
+	void CLLVMCodeGenerator::_hoistBoundsChecks(TLoopInfo& loopInfo, llvm::BasicBlock* pBodyBlock)
+	{
+		TInductionVariableInfo& inductionVariable = loopInfo.mInductionVariable;
+
+		auto& checks = inductionVariable.mHoistableChecks;
+
+		const bool isHoistable = std::any_of(checks.cbegin(), checks.cend(), [this, &loopInfo, pBodyBlock](llvm::CallInst* pCheck)
+		{
+			return _isExecutedOnEachIteration(loopInfo, pBodyBlock, pCheck->getParent());
+		});
+
+		if (!isHoistable)
+		{
+			return;
+		}
+
+		/*!
+			\note The variable is only incremented, so only its initial value can be negative. The check up is hoisted 
+			into the loop's preheader, a negative initial value aborts the program before the first iteration. The upper
+			bound is proven by the loop's condition
+		*/
+
+		llvm::IRBuilder<> preheaderIRBuilder { inductionVariable.mpPreheaderTerminator };
+
+		llvm::Type* pIndexInternalType = llvm::Type::getInt64Ty(mContext);
+
+		llvm::Value* pInitialValue = preheaderIRBuilder.CreateLoad(mVariablesTable[inductionVariable.mVariableHandle], "induction_var_init");
+
+		preheaderIRBuilder.CreateCall(_getBoundsCheckFunction(), 
+									  { 
+										  preheaderIRBuilder.CreateSExtOrTrunc(pInitialValue, pIndexInternalType), 
+										  llvm::ConstantInt::get(pIndexInternalType, 1ULL << 63) // \note fails only for negative values
+									  });
+
+		for (llvm::CallInst* pCheck : checks)
+		{
+			auto pIndexCast = llvm::dyn_cast<llvm::CastInst>(pCheck->getArgOperand(0));
+
+			pCheck->eraseFromParent();
+
+			if (pIndexCast && pIndexCast->use_empty())
+			{
+				pIndexCast->eraseFromParent();
+			}
+		}
+
+		checks.clear();
+	}
+
+	bool CLLVMCodeGenerator::_isExecutedOnEachIteration(const TLoopInfo& loopInfo, llvm::BasicBlock* pBodyBlock, llvm::BasicBlock* pBlock) const
+	{
+		std::vector<llvm::BasicBlock*> blocksToVisit { pBodyBlock };
+		std::unordered_set<llvm::BasicBlock*> visitedBlocks;
+
+		// \note the search doesn't pass through pBlock, so any path which leaves the body bypasses it
+		while (!blocksToVisit.empty())
+		{
+			llvm::BasicBlock* pCurrBlock = blocksToVisit.back();
+			blocksToVisit.pop_back();
+
+			if (pCurrBlock == pBlock || !visitedBlocks.insert(pCurrBlock).second)
+			{
+				continue;
+			}
+
+			if (pCurrBlock == loopInfo.mpLatchBlock || pCurrBlock == loopInfo.mpHeaderBlock || pCurrBlock == loopInfo.mpExitBlock)
+			{
+				return false;
+			}
+
+			llvm::Instruction* pTerminator = pCurrBlock->getTerminator();
+
+			if (!pTerminator || llvm::isa<llvm::ReturnInst>(pTerminator))
+			{
+				return false;
+			}
+
+			for (llvm::BasicBlock* pSuccessor : llvm::successors(pCurrBlock))
+			{
+				blocksToVisit.push_back(pSuccessor);
+			}
+		}
+
+		return true;
+	}
+
+	llvm::Function* CLLVMCodeGenerator::_getBoundsCheckFunction()
+	{
+		if (mpBoundsCheckFunction)
+		{
+			return mpBoundsCheckFunction;
+		}
+
+		llvm::Type* pIndexType = llvm::Type::getInt64Ty(mContext);
+
+		llvm::FunctionType* pFunctionType = llvm::FunctionType::get(llvm::Type::getVoidTy(mContext), { pIndexType, pIndexType }, false);
+
+		mpBoundsCheckFunction = llvm::Function::Create(pFunctionType, llvm::Function::InternalLinkage, "$bounds_check", *mpModule);
+		mpBoundsCheckFunction->addFnAttr(llvm::Attribute::AlwaysInline);
+		mpBoundsCheckFunction->addFnAttr(llvm::Attribute::NoUnwind);
+
+		auto pArg = mpBoundsCheckFunction->arg_begin();
+
+		llvm::Value* pIndex  = pArg++;
+		llvm::Value* pLength = pArg;
+
+		pIndex->setName("index");
+		pLength->setName("length");
+
+		auto pEntryBlock       = llvm::BasicBlock::Create(mContext, "entry", mpBoundsCheckFunction);
+		auto pInBoundsBlock    = llvm::BasicBlock::Create(mContext, "in_bounds", mpBoundsCheckFunction);
+		auto pOutOfBoundsBlock = llvm::BasicBlock::Create(mContext, "out_of_bounds", mpBoundsCheckFunction);
+
+		llvm::IRBuilder<> irBuilder { pEntryBlock };
+
+		// \note the failure is unlikely, so the branch is marked as cold
+		irBuilder.CreateCondBr(irBuilder.CreateICmpULT(pIndex, pLength, "is_in_bounds"), pInBoundsBlock, pOutOfBoundsBlock, 
+							   llvm::MDBuilder(mContext).createBranchWeights(1 << 20, 1));
+
+		irBuilder.SetInsertPoint(pInBoundsBlock);
+		irBuilder.CreateRetVoid();
+
+		// \note the same lowering as __abort has
+		irBuilder.SetInsertPoint(pOutOfBoundsBlock);
+		irBuilder.CreateIntrinsic(llvm::Intrinsic::trap, {}, {});
+		irBuilder.CreateUnreachable();
+
+		return mpBoundsCheckFunction;
+	}
+
+	llvm::Value* CLLVMCodeGenerator::_emitStringLength(CASTExpressionNode* pStringExpr)
+	{
+		auto& currIRBuilder = mIRBuildersStack.top();
+
+		llvm::Type* pLengthType = llvm::Type::getInt64Ty(mContext);
+
+		CASTNode* pData = pStringExpr;
+
+		for (auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pData); pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT; )
+		{
+			pData      = pUnaryExpr->GetData();
+			pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pData);
+		}
+
+		if (auto pLiteral = dynamic_cast<CASTLiteralNode*>(pData))
+		{
+			if (auto pStringValue = dynamic_cast<CStringValue*>(pLiteral->GetValue()))
+			{
+				return llvm::ConstantInt::get(pLengthType, pStringValue->GetValue().length());
+			}
+		}
+
+		llvm::Value* pString = std::get<llvm::Value*>(pStringExpr->Accept(this));
+
+		// \note a length prefix can't be read here, because strings of foreign functions or ones built in runtime don't have it
+		if (llvm::Constant* pLiteralLength = dynamic_cast<CLLVMLiteralVisitor*>(mpLiteralIRGenerator)->GetStringLiteralLength(pString))
+		{
+			return pLiteralLength;
+		}
+
+		auto pStrlenType = llvm::FunctionType::get(pLengthType, { llvm::Type::getInt8PtrTy(mContext) }, false);
+
+		return currIRBuilder.CreateCall(mpModule->getOrInsertFunction("strlen", pStrlenType), { pString }, "str_get_length");
+	}
+
+	CLLVMCodeGenerator::TInductionVariableInfo CLLVMCodeGenerator::_getInductionVariableInfo(CASTWhileLoopStatementNode* pNode) const
+	{
+		TInductionVariableInfo info;
+
+		CASTNode* pCondition = pNode->GetCondition();
+
+		for (auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pCondition); pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT; )
+		{
+			pCondition = pUnaryExpr->GetData();
+			pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pCondition);
+		}
+
+		// \note only conditions like i < N and i <= N are recognized, where N is a literal (possibly folded)
+		auto pBinaryExpr = dynamic_cast<CASTBinaryExpressionNode*>(pCondition);
+
+		if (!pBinaryExpr || (pBinaryExpr->GetOpType() != TT_LT && pBinaryExpr->GetOpType() != TT_LE))
+		{
+			return info;
+		}
+
+		const std::string& variableName = _getPlainIdentifierName(pBinaryExpr->GetLeft());
+
+		CASTNode* pBoundExpr = pBinaryExpr->GetRight();
+
+		for (auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pBoundExpr); pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT; )
+		{
+			pBoundExpr = pUnaryExpr->GetData();
+			pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pBoundExpr);
+		}
+
+		auto pBoundLiteral = dynamic_cast<CASTLiteralNode*>(pBoundExpr);
+
+		if (variableName.empty() || !pBoundLiteral)
+		{
+			return info;
+		}
+
+		CBaseValue* pBoundValue = pBoundLiteral->GetValue();
+
+		switch (pBoundValue->GetType())
+		{
+			case LT_INT:
+				if (dynamic_cast<CIntValue*>(pBoundValue)->GetValue() < 0)
+				{
+					return info;
+				}
+
+				info.mUpperBound = static_cast<U64>(dynamic_cast<CIntValue*>(pBoundValue)->GetValue());
+				break;
+			case LT_UINT:
+				info.mUpperBound = dynamic_cast<CUIntValue*>(pBoundValue)->GetValue();
+				break;
+			default:
+				return info;
+		}
+
+		if (pBinaryExpr->GetOpType() == TT_LE)
+		{
+			// \note i <= U64_MAX holds for any value, so the variable isn't bounded
+			if (info.mUpperBound == (std::numeric_limits<U64>::max)())
+			{
+				return info;
+			}
+
+			++info.mUpperBound;
+		}
+
+		const TSymbolDesc* pVariableDesc = mpSymTable->LookUp(variableName);
+
+		if (!pVariableDesc || !pVariableDesc->mpType)
+		{
+			return info;
+		}
+
+		TSymbolHandle variableHandle = mpSymTable->GetSymbolHandleByName(variableName);
+
+		auto variableIter = mVariablesTable.find(variableHandle);
+
+		// \note a monotonic variable's initial value is loaded in the preheader, so it should be placed in memory
+		const bool isInMemory = (variableIter != mVariablesTable.cend()) && 
+								(llvm::isa<llvm::AllocaInst>(variableIter->second) || llvm::isa<llvm::GlobalVariable>(variableIter->second));
+
+		info.mVariableHandle     = variableHandle;
+		info.mIsValid            = true;
+		info.mIsLowerBoundProven = pVariableDesc->mpType->IsUnsignedInteger();
+		info.mIsMonotonic        = !info.mIsLowerBoundProven && isInMemory && _isIncrementedOnly(pNode->GetBody(), variableName);
+
+		return info;
+	}
+
+	void CLLVMCodeGenerator::_invalidateInductionVariables(TSymbolHandle variableHandle)
+	{
+		for (auto& currLoop : mLoopsStack)
+		{
+			if ((variableHandle == InvalidSymbolHandle) || (currLoop.mInductionVariable.mVariableHandle == variableHandle))
+			{
+				currLoop.mInductionVariable.mIsValid = false;
+			}
+		}
+	}
+
+	void CLLVMCodeGenerator::_setFunctionAttributes(llvm::Function* pFunction, CASTFuncDefinitionNode* pNode, const CType* pFuncType, const CFunctionType* pLambdaType)
+	{
+		// \note the language has no exceptions
+		pFunction->addFnAttr(llvm::Attribute::NoUnwind);
+
+		U32 definitionAttributes = pNode->GetAttributes();
+
+		if (definitionAttributes & AV_READNONE)
+		{
+			pFunction->addFnAttr(llvm::Attribute::ReadNone);
+		}
+		else if (definitionAttributes & AV_READONLY)
+		{
+			pFunction->addFnAttr(llvm::Attribute::ReadOnly);
+		}
+
+		U32 funcAttributes = pFuncType->GetAttributes();
+
+		if (funcAttributes & AV_INLINE)
+		{
+			pFunction->addFnAttr(llvm::Attribute::AlwaysInline);
+		}
+		else if (funcAttributes & AV_NO_INLINE)
+		{
+			pFunction->addFnAttr(llvm::Attribute::NoInline);
+		}
+
+		const auto& argsTypes = pLambdaType->GetArgsTypes();
+
+		for (U32 i = 0; i < static_cast<U32>(argsTypes.size()); ++i)
+		{
+			if ((argsTypes[i].second->GetAttributes() & AV_RESTRICT) && pFunction->getFunctionType()->getParamType(i)->isPointerTy())
+			{
+				pFunction->addParamAttr(i, llvm::Attribute::NoAlias);
+			}
+		}
+	}
+
+	void CLLVMCodeGenerator::_removeMemoryAttributesOfCheckedFunctions()
+	{
+		if (!mpBoundsCheckFunction)
+		{
+			return;
+		}
+
+		auto hasMemoryAttributes = [](const llvm::Function& function)
+		{
+			return function.hasFnAttribute(llvm::Attribute::ReadNone) || function.hasFnAttribute(llvm::Attribute::ReadOnly);
+		};
+
+		bool isChanged = true;
+
+		// \note a function loses the attributes if it can terminate the program, so do its callers on next iterations
+		while (isChanged)
+		{
+			isChanged = false;
+
+			for (llvm::Function& currFunction : *mpModule)
+			{
+				if (!hasMemoryAttributes(currFunction))
+				{
+					continue;
+				}
+
+				for (llvm::Instruction& currInstruction : llvm::instructions(currFunction))
+				{
+					auto pCall = llvm::dyn_cast<llvm::CallInst>(&currInstruction);
+
+					if (!pCall)
+					{
+						continue;
+					}
+
+					llvm::Function* pCallee = _getCalledFunction(pCall);
+
+					if (!pCallee || pCallee == mpBoundsCheckFunction || (!pCallee->isDeclaration() && !hasMemoryAttributes(*pCallee)))
+					{
+						currFunction.removeFnAttr(llvm::Attribute::ReadNone);
+						currFunction.removeFnAttr(llvm::Attribute::ReadOnly);
+
+						isChanged = true;
+
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	llvm::Function* CLLVMCodeGenerator::_getCalledFunction(llvm::CallInst* pCall) const
+	{
+		if (llvm::Function* pCallee = pCall->getCalledFunction())
+		{
+			return pCallee;
+		}
+
+		auto pFuncPointer = llvm::dyn_cast<llvm::LoadInst>(pCall->getCalledOperand());
+
+		auto pFuncPointerVariable = pFuncPointer ? llvm::dyn_cast<llvm::GlobalVariable>(pFuncPointer->getPointerOperand()) : nullptr;
+
+		if (!pFuncPointerVariable || !pFuncPointerVariable->isConstant() || !pFuncPointerVariable->hasInitializer())
+		{
+			return nullptr;
+		}
+
+		return llvm::dyn_cast<llvm::Function>(pFuncPointerVariable->getInitializer()->stripPointerCasts());
+	}
+
+	void CLLVMCodeGenerator::_emitLoopLatch(const TLoopInfo& loopInfo, llvm::BasicBlock* pBodyEndBlock, U32 attributes, const TLoopHints& hints)
+	{
+		llvm::BasicBlock* pLatchBlock = loopInfo.mpLatchBlock;
+
+		// \note the body can already end with break, continue or return
+		if (!pBodyEndBlock->getTerminator())
+		{
+			llvm::IRBuilder<>(pBodyEndBlock).CreateBr(pLatchBlock);
+		}
+
+		// \note the latch isn't reachable if each path of the body ends with break or return
+		if (pLatchBlock->use_empty())
+		{
+			delete pLatchBlock;
+			return;
+		}
+
+		pLatchBlock->insertInto(mpCurrActiveFunction, loopInfo.mpExitBlock);
+
+		llvm::BranchInst* pBackEdge = llvm::IRBuilder<>(pLatchBlock).CreateBr(loopInfo.mpHeaderBlock);
+
+		if (llvm::MDNode* pLoopMetadata = _createLoopMetadata(attributes, hints))
+		{
+			pBackEdge->setMetadata(llvm::LLVMContext::MD_loop, pLoopMetadata);
+		}
+	}
+
+	llvm::MDNode* CLLVMCodeGenerator::_createLoopMetadata(U32 attributes, const TLoopHints& hints)
+	{
+		auto createHint = [this](const std::string& name, llvm::Constant* pValue) -> llvm::Metadata*
+		{
+			if (!pValue)
+			{
+				return llvm::MDNode::get(mContext, { llvm::MDString::get(mContext, name) });
+			}
+
+			return llvm::MDNode::get(mContext, { llvm::MDString::get(mContext, name), llvm::ConstantAsMetadata::get(pValue) });
+		};
+
+		std::vector<llvm::Metadata*> operands { nullptr }; // \note the first operand is replaced with the node itself
+
+		if (attributes & AV_NO_VECTORIZE)
+		{
+			operands.push_back(createHint("llvm.loop.vectorize.enable", llvm::ConstantInt::getFalse(mContext)));
+		}
+		else if (attributes & AV_VECTORIZE)
+		{
+			operands.push_back(createHint("llvm.loop.vectorize.enable", llvm::ConstantInt::getTrue(mContext)));
+
+			if (hints.mVectorizeWidth)
+			{
+				operands.push_back(createHint("llvm.loop.vectorize.width", llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), hints.mVectorizeWidth)));
+			}
+		}
+
+		if (attributes & AV_UNROLL)
+		{
+			operands.push_back(hints.mUnrollCount ? createHint("llvm.loop.unroll.count", llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), hints.mUnrollCount)) :
+													createHint("llvm.loop.unroll.enable", nullptr));
+		}
+
+		if (operands.size() < 2)
+		{
+			return nullptr;
+		}
+
+		llvm::MDNode* pLoopID = llvm::MDNode::getDistinct(mContext, operands);
+		pLoopID->replaceOperandWith(0, pLoopID);
+
+		return pLoopID;
+	}
+
+	bool CLLVMCodeGenerator::_isIncrementedOnly(CASTNode* pNode, const std::string& name) const
+	{
+		if (!pNode)
+		{
+			return true;
+		}
+
+		switch (pNode->GetType())
+		{
+			// \note calls and stores via pointers can decrement the variable, the same is true if an address of any variable is taken
+			case NT_FUNC_CALL:
+			case NT_MEMCPY32_INTRINSIC:
+			case NT_MEMCPY64_INTRINSIC:
+			case NT_MEMSET32_INTRINSIC:
+			case NT_MEMSET64_INTRINSIC:
+				return false;
+			case NT_UNARY_EXPR:
+				if (dynamic_cast<CASTUnaryExpressionNode*>(pNode)->GetOpType() == TT_AMPERSAND)
+				{
+					return false;
+				}
+				break;
+			case NT_ASSIGNMENT:
+				{
+					auto pAssignment = dynamic_cast<CASTAssignmentNode*>(pNode);
+
+					CASTExpressionNode* pLeft = pAssignment->GetLeft();
+
+					if (_getPlainIdentifierName(pLeft) == name)
+					{
+						// \note i = i + C, where C is a positive literal
+						CASTNode* pRight = pAssignment->GetRight();
+
+						for (auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pRight); pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT; )
+						{
+							pRight     = pUnaryExpr->GetData();
+							pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pRight);
+						}
+
+						auto pIncrement = dynamic_cast<CASTBinaryExpressionNode*>(pRight);
+
+						if (!pIncrement || pIncrement->GetOpType() != TT_PLUS)
+						{
+							return false;
+						}
+
+						CASTExpressionNode* pStep = (_getPlainIdentifierName(pIncrement->GetLeft()) == name) ? pIncrement->GetRight() : 
+													(_getPlainIdentifierName(pIncrement->GetRight()) == name) ? pIncrement->GetLeft() : nullptr;
+
+						CASTNode* pStepData = pStep;
+
+						for (auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pStep); pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT; )
+						{
+							pStepData  = pUnaryExpr->GetData();
+							pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pStepData);
+						}
+
+						auto pStepLiteral = dynamic_cast<CASTLiteralNode*>(pStepData);
+
+						auto pStepValue = pStepLiteral ? dynamic_cast<CIntValue*>(pStepLiteral->GetValue()) : nullptr;
+
+						if (!pStepValue || pStepValue->GetValue() <= 0)
+						{
+							return false;
+						}
+
+						return _isIncrementedOnly(pRight, name);
+					}
+
+					if (_getPlainIdentifierName(pLeft).empty() && pLeft->GetType() != NT_INDEXED_ACCESS_OPERATOR && pLeft->GetType() != NT_ACCESS_OPERATOR)
+					{
+						return false;
+					}
+				}
+				break;
+		}
+
+		for (auto pCurrChild : pNode->GetChildren())
+		{
+			if (!_isIncrementedOnly(pCurrChild, name))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	std::string CLLVMCodeGenerator::_getPlainIdentifierName(CASTNode* pNode) const
+	{
+		for (auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode); pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT; )
+		{
+			pNode      = pUnaryExpr->GetData();
+			pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode);
+		}
+
+		auto pIdentifier = dynamic_cast<CASTIdentifierNode*>(pNode);
+
+		return pIdentifier ? pIdentifier->GetName() : "";
+	}
+
+	llvm::Value* CLLVMCodeGenerator::_createEntryBlockAlloca(llvm::Type* pType, const std::string& identifier)
+	{
+		assert(mpCurrAllocasBlock);
+
+		llvm::IRBuilder<> allocasIRBuilder(mpCurrAllocasBlock);
+
+		return allocasIRBuilder.CreateAlloca(pType, nullptr, identifier);
+	}
+
+	void CLLVMCodeGenerator::_startScopedLifetime(llvm::Value* pAllocation)
+	{
+		if (mScopedAllocasStack.empty())
+		{
+			return;
+		}
+
+		mIRBuildersStack.top().CreateLifetimeStart(pAllocation);
+
+		mScopedAllocasStack.top().push_back(pAllocation);
+	}
+
+	void CLLVMCodeGenerator::_endScopedLifetimes()
+	{
+		auto& irBuilder = mIRBuildersStack.top();
+
+		llvm::BasicBlock* pCurrBlock = irBuilder.GetInsertBlock();
+
+		// \note the block is already left with either return, break or continue
+		if (!pCurrBlock || pCurrBlock->getTerminator())
+		{
+			return;
+		}
+
+		for (auto pCurrAllocation : mScopedAllocasStack.top())
+		{
+			irBuilder.CreateLifetimeEnd(pCurrAllocation);
+		}
+	}
+
+	void CLLVMCodeGenerator::_defineEntryPoint()
+	{
+		auto pMainFuncType = llvm::FunctionType::get(llvm::Type::getInt32Ty(mContext), 
+													{
+														llvm::Type::getInt32Ty(mContext),
+														llvm::PointerType::get(llvm::Type::getInt8PtrTy(mContext), 0)
+													}, false);
+
+		auto pMainFunctionDef = llvm::Function::Create(pMainFuncType, llvm::Function::ExternalLinkage, "main", mpModule);
+		pMainFunctionDef->addFnAttr(llvm::Attribute::NoUnwind);
+
+		llvm::BasicBlock* pMainFuncBody = llvm::BasicBlock::Create(mContext, "entry", pMainFunctionDef);
+
+		llvm::IRBuilder<> mainFuncIRBuidler(pMainFuncBody);
+
+		// initialize all global variables of the module
+		mainFuncIRBuidler.CreateCall(mpInitModuleGlobalsFunction, {});
+
+		// call _lang_entry_main function, which is the renamed main function of the module
+		TSymbolHandle langEntryFuncHandle = mpSymTable->GetSymbolHandleByName("_lang_entry_main");
+
+		auto directCalleeIter = mDirectCalleesTable.find(langEntryFuncHandle);
+
+		if (directCalleeIter != mDirectCalleesTable.cend())
+		{
+			mainFuncIRBuidler.CreateRet(mainFuncIRBuidler.CreateCall(directCalleeIter->second, {}));
+
+			return;
+		}
+
+		auto pLangEntryFuncType = mVariablesTable[langEntryFuncHandle];
+
+		auto pDerreferencedFnPtr = mainFuncIRBuidler.CreateLoad(pLangEntryFuncType, "_lang_main_entry");
+
+		mainFuncIRBuidler.CreateRet(mainFuncIRBuidler.CreateCall(pDerreferencedFnPtr, {}));
+	}
+
+	void CLLVMCodeGenerator::_defineInitModuleGlobalsFunction()
+	{
+		auto pInitModuleGlobalsFuncType = llvm::FunctionType::get(llvm::Type::getVoidTy(mContext), false);
+		
+		std::string moduleName = mpModule->getName();
+		moduleName = moduleName.substr(0, moduleName.find_first_of('.'));
+
+		// \note create flag that tells was the module initialized or not
+		auto boolType = llvm::Type::getInt1Ty(mContext);
+
+		auto isModuleInitialized = mpModule->getOrInsertGlobal(std::string("is_").append(moduleName).append("_initialized"), boolType);
+
+		llvm::dyn_cast<llvm::GlobalVariable>(isModuleInitialized)->setInitializer(llvm::ConstantInt::get(boolType, 0));
+
+		mpInitModuleGlobalsFunction = llvm::Function::Create(pInitModuleGlobalsFuncType, llvm::Function::ExternalLinkage, _getInitModuleFuncName(moduleName), mpModule);
+		mpInitModuleGlobalsFunction->addFnAttr(llvm::Attribute::NoUnwind);
+		
+		llvm::BasicBlock* pInitModuleGlobalsFuncBody = llvm::BasicBlock::Create(mContext, "entry", mpInitModuleGlobalsFunction);
+
+		mpInitModuleGlobalsIRBuilder = new llvm::IRBuilder<>(pInitModuleGlobalsFuncBody);
+
+		// \note values of globals which are computed in runtime are evaluated within the init function
+		mpGlobalIRBuilder->SetInsertPoint(pInitModuleGlobalsFuncBody);
+
+		// \note assign true to is_<module-name>_initialized variable
+		mpInitModuleGlobalsIRBuilder->CreateStore(llvm::ConstantInt::getTrue(mContext), isModuleInitialized);
+
+		// \note add check up whether the module's globals were initialized or not to prevent doubled initialization
+		llvm::IRBuilder<> preConditionIRBuilder(llvm::BasicBlock::Create(mContext, "pre_cond_entry", mpInitModuleGlobalsFunction, pInitModuleGlobalsFuncBody));
+		
+		llvm::BasicBlock* pTruePreConditionBlock = llvm::BasicBlock::Create(mContext, "already_initialized", mpInitModuleGlobalsFunction);
+
+		preConditionIRBuilder.CreateCondBr(preConditionIRBuilder.CreateLoad(isModuleInitialized), pTruePreConditionBlock, pInitModuleGlobalsFuncBody);
+
+		llvm::IRBuilder<> trueConditionIRBuilder(pTruePreConditionBlock);
+		trueConditionIRBuilder.CreateRetVoid();
+	}
+
+	llvm::Value* CLLVMCodeGenerator::_declareNativeFunction(const TSymbolDesc* pFuncDesc)
 	{
 		TSymbolHandle funcHandle = mpSymTable->GetSymbolHandleByName(pFuncDesc->mName);
 
@@ -1208,7 +2353,12 @@ namespace gplc
 
 		auto pFunctionType = llvm::dyn_cast<llvm::FunctionType>(std::get<llvm::Type*>(pFuncDesc->mpType->Accept(mpTypeGenerator)));
 
-		mVariablesTable[funcHandle] = llvm::Function::Create(pFunctionType, llvm::Function::ExternalLinkage, pFuncDesc->mName, *mpModule);
+		auto pNativeFunction = llvm::Function::Create(pFunctionType, llvm::Function::ExternalLinkage, pFuncDesc->mName, *mpModule);
+
+		// \note native functions are called as C ones, so they can't throw exceptions through the code of the module
+		pNativeFunction->addFnAttr(llvm::Attribute::NoUnwind);
+
+		mVariablesTable[funcHandle] = pNativeFunction;
 		
 		return mVariablesTable[funcHandle];
 	}
@@ -1224,50 +2374,67 @@ namespace gplc
 
 		auto pTypeDesc = mpSymTable->LookUpNamedScope(structName);
 
-		mpSymTable->VisitNamedScope(structName);
-
-		TSymbolHandle constructorHandle = mpSymTable->AddVariable({ constructorName, nullptr, nullptr });
-
 		auto pConstructorFunction = llvm::Function::Create(pConstructorType, llvm::Function::ExternalLinkage, constructorName, *mpModule);
+		pConstructorFunction->addFnAttr(llvm::Attribute::NoUnwind);
 	
 		auto pArg = pConstructorFunction->args().begin();
 
-		mVariablesTable[constructorHandle] = pConstructorFunction;
-		
-		llvm::IRBuilder<> currIRBuilder{ llvm::BasicBlock::Create(mContext, "entry", pConstructorFunction) };
+		// \note default values can refer to globals and call functions, so they're generated as a body of an ordinary function
+		llvm::Function* pPrevActiveFunction = mpCurrActiveFunction;
 
-		U32 firstFieldHandle = pTypeDesc->mVariables.begin()->second;
-		U32 currFieldHandle  = InvalidSymbolHandle;
+		llvm::BasicBlock* pPrevAllocasBlock = mpCurrAllocasBlock;
 
-		llvm::Value* pCurrValue = nullptr;
+		mpCurrActiveFunction = pConstructorFunction;
+		mpCurrAllocasBlock   = llvm::BasicBlock::Create(mContext, "allocas", pConstructorFunction);
+
+		mIRBuildersStack.push(llvm::IRBuilder<>(llvm::BasicBlock::Create(mContext, "entry", pConstructorFunction)));
+
+		auto& currIRBuilder = mIRBuildersStack.top();
 
 		auto zeroIndex = llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), 0);
 
-		for (auto currFieldTypeInfo : pType->GetFieldsTypes())
+		// \note the traversal of the module's unnamed scopes should be kept, the next function's body is visited after this
+		mpSymTable->VisitNamedScopeWithRestore(structName, [&, this](ISymTable* pSymTable)
 		{
-			currFieldHandle = pTypeDesc->mVariables[currFieldTypeInfo.first];
+			TSymbolHandle constructorHandle = pSymTable->AddVariable({ constructorName, nullptr, nullptr });
 
-			pCurrValue = currIRBuilder.CreateGEP(pArg,
-				{
-					zeroIndex,
-					llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), currFieldHandle - firstFieldHandle)
-				});
-			
-			auto pAssignedValue = std::get<llvm::Value*>(mpSymTable->LookUp(currFieldHandle)->mpValue->Accept(this));
+			mVariablesTable[constructorHandle] = pConstructorFunction;
 
-			if (currFieldTypeInfo.second->GetType() == CT_POINTER && pAssignedValue->getType()->isIntegerTy())
-			{
-				currIRBuilder.CreateStore(pAssignedValue, currIRBuilder.CreateBitOrPointerCast(pCurrValue, llvm::Type::getInt32PtrTy(mContext), "ptr_reinterp_cast"));
-			}
-			else
+			U32 currFieldHandle = InvalidSymbolHandle;
+
+			llvm::Value* pCurrValue = nullptr;
+
+			for (auto currFieldTypeInfo : pType->GetFieldsTypes())
 			{
-				currIRBuilder.CreateStore(pAssignedValue, pCurrValue);
-			}
-		}
+				currFieldHandle = pTypeDesc->mVariables[currFieldTypeInfo.first];
 
-		mpSymTable->LeaveScope();
+				pCurrValue = currIRBuilder.CreateGEP(pArg,
+					{
+						zeroIndex,
+						llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), pType->GetFieldIndex(currFieldTypeInfo.first))
+					});
+			
+				auto pAssignedValue = std::get<llvm::Value*>(pSymTable->LookUp(currFieldHandle)->mpValue->Accept(this));
+
+				if (currFieldTypeInfo.second->GetType() == CT_POINTER && pAssignedValue->getType()->isIntegerTy())
+				{
+					currIRBuilder.CreateStore(pAssignedValue, currIRBuilder.CreateBitOrPointerCast(pCurrValue, llvm::Type::getInt32PtrTy(mContext), "ptr_reinterp_cast"));
+				}
+				else
+				{
+					currIRBuilder.CreateStore(pAssignedValue, pCurrValue);
+				}
+			}
+		});
 
 		currIRBuilder.CreateRet(pArg);
+
+		llvm::IRBuilder<>(mpCurrAllocasBlock).CreateBr(mpCurrAllocasBlock->getNextNode());
+
+		mIRBuildersStack.pop();
+
+		mpCurrAllocasBlock   = pPrevAllocasBlock;
+		mpCurrActiveFunction = pPrevActiveFunction;
 	}
 
 	inline bool CLLVMCodeGenerator::_isGlobalScope() const
@@ -1288,40 +2455,30 @@ namespace gplc
 		return (pParentType ? pParentType->GetMangledName() : "") + identifier;
 	}
 
-	llvm::BasicBlock* CLLVMCodeGenerator::_constructDeferBlock(TExpressionsStack& expressionsStack)
+	void CLLVMCodeGenerator::_emitDeferredExpressions(size_t firstScopeIndex)
 	{
-		if (expressionsStack.empty())
+		llvm::BasicBlock* pCurrBlock = mIRBuildersStack.top().GetInsertBlock();
+
+		// \note the block is already left, so there is no edge to put the expressions on
+		if (!pCurrBlock || pCurrBlock->getTerminator())
 		{
-			return nullptr;
+			return;
 		}
-		
-		auto pDeferBlock    = llvm::BasicBlock::Create(mContext, "defer_block", mpCurrActiveFunction);
-		auto pDeferEndBlock = llvm::BasicBlock::Create(mContext, "end_defer_block", mpCurrActiveFunction, pDeferBlock);
-
-		auto& predcessingIRBuilder = mIRBuildersStack.top();
-		predcessingIRBuilder.CreateBr(pDeferBlock);
-		
-		llvm::IRBuilder<> currIRBuilder { pDeferBlock };
 
-		mIRBuildersStack.push(currIRBuilder);
-
-		CASTExpressionNode* pCurrExpression = nullptr;
-
-		while (!expressionsStack.empty())
+		for (size_t i = mDefferedExpressionsStack.size(); i > firstScopeIndex; --i)
 		{
-			pCurrExpression = expressionsStack.top();
+			const TExpressionsArray& currScopeExpressions = mDefferedExpressionsStack[i - 1];
 
-			pCurrExpression->Accept(this);
-
-			expressionsStack.pop();
+			// \note deferred expressions are executed in reverse order of their declaration
+			for (auto iter = currScopeExpressions.crbegin(); iter != currScopeExpressions.crend(); ++iter)
+			{
+				// \note names of the expression could be shadowed within the nested blocks which are left
+				mpSymTable->VisitScopeWithRestore(iter->second, [this, iter](ISymTable*)
+				{
+					iter->first->Accept(this);
+				});
+			}
 		}
-		
-		// \note jump to "end_defer_block"
-		currIRBuilder.CreateBr(pDeferEndBlock);
-		
-		mIRBuildersStack.pop();
-
-		return pDeferEndBlock;
 	}
 
 	std::string CLLVMCodeGenerator::_extractIdentifier(CASTUnaryExpressionNode* pNode) const
@@ -1445,11 +2602,58 @@ namespace gplc
 
 	llvm::Value* CLLVMCodeGenerator::_getStructElementValue(llvm::IRBuilder<>& irBuilder, llvm::Value* pStructValue, I32 index)
 	{
-		static auto zeroIndex { llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), 0) };
+		// \note constants belong to the generator's context, so they can't be cached between instances
+		auto zeroIndex { llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), 0) };
 
 		return irBuilder.CreateGEP(pStructValue,
 			{
 				zeroIndex, llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), index)
 			});
 	}
+
+	llvm::Value* CLLVMCodeGenerator::_getSoAElementFieldAddress(CASTExpressionNode* pElementExpr, I32 fieldIndex)
+	{
+		auto pIndexedAccessNode = dynamic_cast<CASTIndexedAccessOperatorNode*>(pElementExpr);
+
+		if (!pIndexedAccessNode)
+		{
+			return nullptr;
+		}
+
+		auto pArrayType = dynamic_cast<CArrayType*>(pIndexedAccessNode->GetExpression()->Resolve(mpTypeResolver));
+
+		if (!pArrayType || !pArrayType->GetSoAElementType())
+		{
+			return nullptr;
+		}
+
+		auto& irBuilder = mIRBuildersStack.top();
+
+		llvm::Value* pFieldsArrays  = _getStructElementValue(irBuilder, std::get<llvm::Value*>(pIndexedAccessNode->GetExpression()->Accept(this)), 0);
+		llvm::Value* pIndexExprCode = std::get<llvm::Value*>(pIndexedAccessNode->GetIndexExpression()->Accept(this));
+
+		_emitBoundsCheck(pArrayType, pIndexedAccessNode->GetIndexExpression(), pIndexExprCode);
+
+		return irBuilder.CreateGEP(pFieldsArrays,
+			{
+				llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), 0),
+				llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), fieldIndex),
+				pIndexExprCode
+			}, "soa_field_access");
+	}
+
+	void CLLVMCodeGenerator::_initTargetDataLayout()
+	{
+		// \note the data layout of a host is used to compute sizes of aggregate types, if there is no registered target the default one is used.
+		// The types factory gets the same alignments from GetHostTargetAlignments, so layouts of structures match the data layout
+		auto pTargetMachine = GetHostTargetMachine();
+
+		if (!pTargetMachine)
+		{
+			return;
+		}
+
+		mpModule->setDataLayout(pTargetMachine->createDataLayout());
+		mpModule->setTargetTriple(pTargetMachine->getTargetTriple().str());
+	}
 }
\ No newline at end of file
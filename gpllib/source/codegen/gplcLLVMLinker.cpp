@@ -1,4 +1,6 @@
 #include "codegen/gplcLLVMLinker.h"
+#include "codegen/gplcLLVMTargetMachine.h"
+#include "common/gplcStatistics.h"
 #include "llvm/Linker/Linker.h"
 #include "llvm/IR/Module.h"
 #include "llvm/Transforms/Utils/Cloning.h"
@@ -18,6 +20,11 @@
 
 namespace gplc
 {
+	CLLVMLinker::CLLVMLinker(ITimeReport* pTimeReport):
+		ILinker(), mpTimeReport(pTimeReport)
+	{
+	}
+
 	Result CLLVMLinker::Link(const std::string& outputFilename, TModulesArray& modulesRegistry, TModuleEntry* pMainModuleDependencies, bool isMainModule,
 							 bool skipFinalLinking)
 	{
@@ -34,6 +41,8 @@ namespace gplc
 		{
 			if (currDependency.mDependencies.empty())
 			{
+				GPLC_STATISTIC_ADD("linker", "cloned modules", 1);
+
 				// \note we make a copy of original leaf module, but override its parent one
 				if (llvm::Linker::linkModules(*pMainModule, std::move(llvm::CloneModule(*_getModule(modulesRegistry, currDependency.mModuleName))), llvm::Linker::OverrideFromSrc))
 				{
@@ -52,11 +61,17 @@ namespace gplc
 		// call system linker
 		if (isMainModule && !skipFinalLinking)
 		{
-			if (!SUCCESS(result = _generateObjectFile(pMainModule, pMainModuleDependencies->mModuleName)))
 			{
-				return result;
+				CTimeReportScope objectFileEmissionPhase(mpTimeReport, "Object file emission");
+
+				if (!SUCCESS(result = _generateObjectFile(pMainModule, pMainModuleDependencies->mModuleName)))
+				{
+					return result;
+				}
 			}
 
+			CTimeReportScope systemLinkerPhase(mpTimeReport, "System linker");
+
 			// \todo For now we use clang to call system linker
 			system(std::string("clang ")
 						.append(pMainModuleDependencies->mModuleName)
@@ -84,30 +99,16 @@ namespace gplc
 
 		llvm::raw_fd_ostream out(std::filesystem::path(filename).replace_extension("obj").string(), EC, llvm::sys::fs::F_None);
 
-		// \todo Refactor this part later, define some class that will return assembly code for specific target machine
-		auto targetTriple = llvm::sys::getDefaultTargetTriple();
-
-		std::string errorMsg;
+		auto targetMachine = GetHostTargetMachine();
 
-		auto pTarget = llvm::TargetRegistry::lookupTarget(targetTriple, errorMsg);
-
-		if (!pTarget)
+		if (!targetMachine)
 		{
 			return RV_FAIL;
 		}
 
-		const C8* CPU      = "generic";
-		const C8* features = "";
-
-		llvm::TargetOptions targetOptions;
-
-		auto RM = llvm::Optional<llvm::Reloc::Model>();
-
-		auto targetMachine = pTarget->createTargetMachine(targetTriple, CPU, features, targetOptions, RM);
-
 		// \todo move it from here to some proper place
 		pModule->setDataLayout(targetMachine->createDataLayout());
-		pModule->setTargetTriple(targetTriple);
+		pModule->setTargetTriple(targetMachine->getTargetTriple().str());
 
 		llvm::legacy::PassManager passManager;
 
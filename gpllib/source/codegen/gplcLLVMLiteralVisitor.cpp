@@ -11,8 +11,8 @@
 
 namespace gplc
 {
-	CLLVMLiteralVisitor::CLLVMLiteralVisitor(llvm::LLVMContext& context, CLLVMCodeGenerator* pCodeGenerator):
-		mpCodeGenerator(pCodeGenerator)
+	CLLVMLiteralVisitor::CLLVMLiteralVisitor(llvm::LLVMContext& context, llvm::Module* pModule, CLLVMCodeGenerator* pCodeGenerator):
+		mpCodeGenerator(pCodeGenerator), mpModule(pModule)
 	{
 		mContext = &context;
 	}
@@ -60,31 +60,12 @@ namespace gplc
 			runeValue |= static_cast<U8>(value[size - i - 1]) << 8 * i;
 		}
 
-		static llvm::Type* pInt32Type = llvm::Type::getInt32Ty(*mContext);
-
-		return llvm::ConstantInt::get(pInt32Type, runeValue);
+		return llvm::ConstantInt::get(llvm::Type::getInt32Ty(*mContext), runeValue);
 	}
 
 	TLLVMIRData CLLVMLiteralVisitor::VisitStringLiteral(const CStringValue* pLiteral)
 	{
-		llvm::IRBuilder<>* pCurrIRBuilder = mpCodeGenerator->GetCurrIRBuilder();
-
-		auto pStringLiteral = pCurrIRBuilder->CreateGlobalString(pLiteral->GetValue());
-
-		return llvm::ConstantExpr::getBitCast(pStringLiteral, llvm::Type::getInt8PtrTy(*mContext));
-/*
-		llvm::ConstantInt* pInitialIndex = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*mpContext), 0);
-		auto  t = llvm::cast<llvm::PointerType>(pStringLiteral->getType()->getScalarType())->getElementType();
-		t->dump();
-		std::vector<llvm::Constant*> args
-		{
-			 pInitialIndex, 
-			 pInitialIndex
-		};
-
-		auto pExpr = llvm::ConstantExpr::getGetElementPtr(pStringLiteral->getInitializer()->getType(), pStringLiteral->getInitializer(), args);
-		pExpr->dump();
-		return {};*/
+		return GetStringLiteral(pLiteral->GetValue());
 	}
 
 	TLLVMIRData CLLVMLiteralVisitor::VisitBoolLiteral(const CBoolValue* pLiteral)
@@ -97,4 +78,49 @@ namespace gplc
 		return llvm::ConstantInt::get(llvm::Type::getInt32Ty(*mContext), 0);
 		//return llvm::ConstantPointerNull::get(llvm::Type::getInt8PtrTy(*mpContext));
 	}
+
+	llvm::Constant* CLLVMLiteralVisitor::GetStringLiteral(const std::string& value)
+	{
+		auto it = mStringLiteralsPool.find(value);
+
+		if (it != mStringLiteralsPool.cend())
+		{
+			return it->second;
+		}
+
+		llvm::GlobalVariable* pStorage = _createStringLiteralStorage(value);
+
+		llvm::Constant* pZeroIndex = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*mContext), 0);
+
+		std::vector<llvm::Constant*> indices { pZeroIndex, pZeroIndex };
+
+		llvm::Constant* pFirstChar = llvm::ConstantExpr::getInBoundsGetElementPtr(pStorage->getValueType(), pStorage, indices);
+
+		mStringLiteralsPool[value] = pFirstChar;
+
+		// \note the storage is the key, because stripPointerCasts also strips the zero indices of the pointer to the first character
+		mStringLiteralsLengths[pStorage] = value.length();
+
+		return pFirstChar;
+	}
+
+	llvm::Constant* CLLVMLiteralVisitor::GetStringLiteralLength(const llvm::Value* pString) const
+	{
+		auto it = mStringLiteralsLengths.find(pString->stripPointerCasts());
+
+		return (it != mStringLiteralsLengths.cend()) ? llvm::ConstantInt::get(llvm::Type::getInt64Ty(*mContext), it->second) : nullptr;
+	}
+
+	llvm::GlobalVariable* CLLVMLiteralVisitor::_createStringLiteralStorage(const std::string& value)
+	{
+		llvm::Constant* pInitializer = llvm::ConstantDataArray::getString(*mContext, value, true);
+
+		auto pStorage = new llvm::GlobalVariable(*mpModule, pInitializer->getType(), true, llvm::GlobalValue::PrivateLinkage, pInitializer, ".str");
+
+		// \note the address isn't significant, so the linker is allowed to merge equal literals of different modules
+		pStorage->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+		pStorage->setAlignment(llvm::Align(1));
+
+		return pStorage;
+	}
 }
\ No newline at end of file
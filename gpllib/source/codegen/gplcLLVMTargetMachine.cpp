@@ -0,0 +1,64 @@
+#include "codegen/gplcLLVMTargetMachine.h"
+#include "common/gplcTypeSystem.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Type.h"
+#include "llvm/Support/Host.h"
+#include "llvm/Support/TargetRegistry.h"
+#include "llvm/Target/TargetMachine.h"
+#include "llvm/Target/TargetOptions.h"
+#include "llvm/ADT/Optional.h"
+#include <memory>
+#include <mutex>
+
+
+namespace gplc
+{
+	llvm::TargetMachine* GetHostTargetMachine()
+	{
+		static std::unique_ptr<llvm::TargetMachine> pTargetMachine;
+		static std::once_flag                       isTargetMachineCreated;
+
+		std::call_once(isTargetMachineCreated, []()
+		{
+			auto targetTriple = llvm::sys::getDefaultTargetTriple();
+
+			std::string errorMsg;
+
+			auto pTarget = llvm::TargetRegistry::lookupTarget(targetTriple, errorMsg);
+
+			if (!pTarget)
+			{
+				return;
+			}
+
+			pTargetMachine.reset(pTarget->createTargetMachine(targetTriple, "generic", "", llvm::TargetOptions(), llvm::Optional<llvm::Reloc::Model>()));
+		});
+
+		return pTargetMachine.get();
+	}
+
+	TTargetAlignmentsInfo GetHostTargetAlignments()
+	{
+		TTargetAlignmentsInfo alignments;
+
+		auto pTargetMachine = GetHostTargetMachine();
+
+		// \note a module keeps the default data layout if there is no registered target, so the same one is used here
+		const llvm::DataLayout dataLayout = pTargetMachine ? pTargetMachine->createDataLayout() : llvm::DataLayout("");
+
+		llvm::LLVMContext context;
+
+		for (U32 currSize : { BTS_INT8, BTS_INT16, BTS_INT32, BTS_INT64 })
+		{
+			alignments.mIntegersAlignments[currSize] = static_cast<U32>(dataLayout.getABITypeAlign(llvm::Type::getIntNTy(context, currSize * 8)).value());
+		}
+
+		alignments.mFloatsAlignments[BTS_FLOAT]  = static_cast<U32>(dataLayout.getABITypeAlign(llvm::Type::getFloatTy(context)).value());
+		alignments.mFloatsAlignments[BTS_DOUBLE] = static_cast<U32>(dataLayout.getABITypeAlign(llvm::Type::getDoubleTy(context)).value());
+
+		alignments.mPointerAlignment = static_cast<U32>(dataLayout.getPointerABIAlignment(0).value());
+
+		return alignments;
+	}
+}
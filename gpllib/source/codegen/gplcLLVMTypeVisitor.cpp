@@ -92,15 +92,16 @@ namespace gplc
 			pInferredType = llvm::dyn_cast<llvm::StructType>(mTypesTable[structName]);
 		}
 
-		for (auto currField : fields)
+		// \note fields are emitted in memory order which can differ from declaration one if @reorder is used
+		for (U32 currFieldIndex : pStructType->GetLayoutInfo().mFieldsOrder)
 		{
-			structFields.push_back(std::get<llvm::Type*>(currField.second->Accept(this)));
+			structFields.push_back(std::get<llvm::Type*>(fields[currFieldIndex].second->Accept(this)));
 		}
 
 		// if the structure was forwardly declared then define its body
 		if (pInferredType->isOpaque())
 		{
-			pInferredType->setBody(structFields);
+			pInferredType->setBody(structFields, pStructType->IsPacked());
 		}
 
 		return pInferredType ? pInferredType : mTypesTable[structName];
@@ -141,6 +142,11 @@ namespace gplc
 
 	TLLVMIRData CLLVMTypeVisitor::VisitStaticSizedArray(const CArrayType* pArrayType)
 	{
+		if (const CStructType* pSoAElementType = pArrayType->GetSoAElementType())
+		{
+			return _getSoAArrayType(pArrayType, pSoAElementType);
+		}
+
 		std::string arrayTypeName = "StaticArray$" + pArrayType->GetBaseType()->ToShortAliasString();
 
 		if (mTypesTable.find(arrayTypeName) != mTypesTable.cend())
@@ -160,6 +166,39 @@ namespace gplc
 		return pArrayFatType;
 	}
 
+	llvm::Type* CLLVMTypeVisitor::_getSoAArrayType(const CArrayType* pArrayType, const CStructType* pElementType)
+	{
+		const U32 elementsCount = pArrayType->GetElementsCount();
+
+		std::string arrayTypeName = "SoAArray$" + pElementType->GetMangledName() + "$" + std::to_string(elementsCount);
+
+		if (mTypesTable.find(arrayTypeName) != mTypesTable.cend())
+		{
+			return mTypesTable[arrayTypeName];
+		}
+
+		auto fields = pElementType->GetFieldsTypes();
+
+		std::vector<llvm::Type*> fieldsArrays;
+
+		// \note the order of fields' arrays is the same as in the structure's layout, so GetFieldIndex can be used for both of them
+		for (U32 currFieldIndex : pElementType->GetLayoutInfo().mFieldsOrder)
+		{
+			fieldsArrays.push_back(llvm::ArrayType::get(std::get<llvm::Type*>(fields[currFieldIndex].second->Accept(this)), elementsCount));
+		}
+
+		// \note the data of @soa array is { [N x F0], [N x F1], ... } instead of [N x { F0, F1, ... }], the length field is kept as is
+		auto pArrayFatType = llvm::StructType::create(*mContext,
+								{
+									llvm::StructType::get(*mContext, fieldsArrays),
+									llvm::Type::getInt64Ty(*mContext)
+								}, arrayTypeName);
+
+		mTypesTable[arrayTypeName] = pArrayFatType;
+
+		return pArrayFatType;
+	}
+
 	TLLVMIRData CLLVMTypeVisitor::VisitPointerType(const CPointerType* pPointerType)
 	{
 		return llvm::PointerType::get(std::get<llvm::Type*>(pPointerType->GetBaseType()->Accept(this)), 0);
@@ -174,17 +213,17 @@ namespace gplc
 			return mTypesTable[variantName];
 		}
 
-		std::vector<llvm::Type*> altTypes;
+		// \note the payload is a union of alternatives, it's represented with an array of integers to keep the largest alignment.
+		// Its size is computed by the types system, so sizeof of the variant is the same for the interpreter and the code generator
+		const U32 payloadAlignment = pVariantType->GetPayloadAlignment();
+		const U32 payloadSize      = pVariantType->GetPayloadSize();
 
-		for (auto pCurrAltType : pVariantType->GetFieldsTypes())
-		{
-			altTypes.push_back(std::get<llvm::Type*>(pCurrAltType->Accept(this)));
-		}
+		llvm::Type* pPayloadElementType = llvm::Type::getIntNTy(*mContext, payloadAlignment * 8);
 
 		auto pTaggedUnionType = llvm::StructType::create(*mContext, 
 														{
-															llvm::Type::getInt16Ty(*mContext), ///< tag
-															llvm::StructType::create(*mContext, altTypes, "", true) ///< actual data
+															llvm::Type::getIntNTy(*mContext, pVariantType->GetTagSize() * 8), ///< tag
+															llvm::ArrayType::get(pPayloadElementType, (payloadSize + payloadAlignment - 1) / payloadAlignment) ///< actual data
 														}, variantName);
 
 		mTypesTable[variantName] = pTaggedUnionType;
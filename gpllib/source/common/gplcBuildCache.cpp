@@ -0,0 +1,269 @@
+#include "common/gplcBuildCache.h"
+#include "utils/Utils.h"
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <random>
+#include <cstring>
+
+
+namespace gplc
+{
+	const C8* CBuildCache::mEntryFileExtension = ".gplcache";
+
+	const U32 CBuildCache::mEntrySignature = 0x48435047; // "GPCH"
+
+	const U32 CBuildCache::mEntryFormatVersion = 1;
+
+
+	/*!
+		\brief The header precedes the module's code and the interface within an entry's file
+	*/
+
+	struct TEntryHeader
+	{
+		U32 mSignature;
+
+		U32 mFormatVersion;
+
+		U64 mModuleCodeSize;
+
+		U64 mInterfaceSize;
+	};
+
+
+	static I64 GetFileAccessTime(const std::filesystem::path& path)
+	{
+		std::error_code errorCode;
+
+		auto time = std::filesystem::last_write_time(path, errorCode);
+
+		return errorCode ? 0 : static_cast<I64>(time.time_since_epoch().count());
+	}
+
+
+	Result CBuildCache::Init(const std::string& cacheDirectory, U64 maxSize)
+	{
+		if (cacheDirectory.empty())
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		std::error_code errorCode;
+
+		std::filesystem::create_directories(cacheDirectory, errorCode);
+
+		if (!std::filesystem::is_directory(cacheDirectory, errorCode))
+		{
+			return RV_FILE_NOT_FOUND;
+		}
+
+		mCacheDirectory = cacheDirectory;
+		mMaxSize        = maxSize;
+		mCurrSize       = 0;
+
+		mEntries.clear();
+
+		// \note collect entries which were left by previous runs
+		for (auto& currFile : std::filesystem::directory_iterator(mCacheDirectory, errorCode))
+		{
+			const std::filesystem::path& currPath = currFile.path();
+
+			if (!currFile.is_regular_file(errorCode) || currPath.extension() != mEntryFileExtension)
+			{
+				continue;
+			}
+
+			const U64 size = static_cast<U64>(currFile.file_size(errorCode));
+
+			mEntries[currPath.stem().string()] = { size, GetFileAccessTime(currPath) };
+
+			mCurrSize += size;
+		}
+
+		_evictEntries();
+
+		return RV_SUCCESS;
+	}
+
+	std::string CBuildCache::ComputeKey(const TCacheKeyDesc& keyDesc) const
+	{
+		CDigestBuilder digestBuilder;
+
+		digestBuilder.Append(keyDesc.mCompilerVersion).Append(keyDesc.mOptions).Append(keyDesc.mSourceCode);
+
+		for (const std::string& currImportHash : keyDesc.mImportsInterfacesHashes)
+		{
+			digestBuilder.Append(currImportHash);
+		}
+
+		return digestBuilder.GetDigest();
+	}
+
+	Result CBuildCache::Load(const std::string& key, TCacheEntry& entry)
+	{
+		const std::string entryPath = _getEntryPath(key);
+
+		auto iter = mEntries.find(key);
+
+		if (iter == mEntries.cend())
+		{
+			// \note the entry could be stored by another compiler's process after the cache was opened
+			std::error_code errorCode;
+
+			const U64 size = static_cast<U64>(std::filesystem::file_size(entryPath, errorCode));
+
+			if (errorCode)
+			{
+				return RV_FILE_NOT_FOUND;
+			}
+
+			iter = mEntries.insert({ key, { size, GetFileAccessTime(entryPath) } }).first;
+
+			mCurrSize += size;
+		}
+
+		std::ifstream file(entryPath, std::ios::binary);
+
+		TEntryHeader header;
+
+		if (!file.read(reinterpret_cast<C8*>(&header), sizeof(header)) ||
+			header.mSignature != mEntrySignature || header.mFormatVersion != mEntryFormatVersion ||
+			sizeof(header) + header.mModuleCodeSize + header.mInterfaceSize != iter->second.mSize)
+		{
+			return RV_FILE_NOT_FOUND;
+		}
+
+		entry.mModuleCode.resize(static_cast<size_t>(header.mModuleCodeSize));
+		entry.mInterface.resize(static_cast<size_t>(header.mInterfaceSize));
+
+		if (!file.read(reinterpret_cast<C8*>(entry.mModuleCode.data()), entry.mModuleCode.size()) ||
+			!file.read(reinterpret_cast<C8*>(entry.mInterface.data()), entry.mInterface.size()))
+		{
+			return RV_FILE_NOT_FOUND;
+		}
+
+		file.close();
+
+		_touchEntry(key);
+
+		return RV_SUCCESS;
+	}
+
+	Result CBuildCache::Store(const std::string& key, const TCacheEntry& entry)
+	{
+		if (mCacheDirectory.empty())
+		{
+			return RV_FAIL;
+		}
+
+		const TEntryHeader header { mEntrySignature, mEntryFormatVersion, entry.mModuleCode.size(), entry.mInterface.size() };
+
+		const U64 size = sizeof(header) + header.mModuleCodeSize + header.mInterfaceSize;
+
+		// \note an entry that doesn't fit into the cache at all would evict everything else
+		if (size > mMaxSize)
+		{
+			return RV_FAIL;
+		}
+
+		const std::string entryPath = _getEntryPath(key);
+
+		// \note write into a temporary file first, so other compiler's processes never see partially written entries
+		const std::string tempEntryPath = std::string(entryPath).append(".").append(std::to_string(std::random_device{}())).append(".tmp");
+
+		{
+			std::ofstream file(tempEntryPath, std::ios::binary | std::ios::trunc);
+
+			if (!file.write(reinterpret_cast<const C8*>(&header), sizeof(header)) ||
+				!file.write(reinterpret_cast<const C8*>(entry.mModuleCode.data()), entry.mModuleCode.size()) ||
+				!file.write(reinterpret_cast<const C8*>(entry.mInterface.data()), entry.mInterface.size()))
+			{
+				file.close();
+
+				std::error_code errorCode;
+				std::filesystem::remove(tempEntryPath, errorCode);
+
+				return RV_FAIL;
+			}
+		}
+
+		std::error_code errorCode;
+
+		std::filesystem::rename(tempEntryPath, entryPath, errorCode);
+
+		if (errorCode)
+		{
+			std::filesystem::remove(tempEntryPath, errorCode);
+
+			return RV_FAIL;
+		}
+
+		auto iter = mEntries.find(key);
+
+		if (iter != mEntries.cend())
+		{
+			mCurrSize -= iter->second.mSize;
+		}
+
+		mEntries[key] = { size, GetFileAccessTime(entryPath) };
+
+		mCurrSize += size;
+
+		_evictEntries();
+
+		return RV_SUCCESS;
+	}
+
+	U64 CBuildCache::GetSize() const
+	{
+		return mCurrSize;
+	}
+
+	std::string CBuildCache::_getEntryPath(const std::string& key) const
+	{
+		return std::filesystem::path(mCacheDirectory).append(std::string(key).append(mEntryFileExtension)).string();
+	}
+
+	void CBuildCache::_touchEntry(const std::string& key)
+	{
+		const std::string entryPath = _getEntryPath(key);
+
+		std::error_code errorCode;
+
+		std::filesystem::last_write_time(entryPath, std::filesystem::file_time_type::clock::now(), errorCode);
+
+		mEntries[key].mLastAccessTime = GetFileAccessTime(entryPath);
+	}
+
+	void CBuildCache::_evictEntries()
+	{
+		if (mCurrSize <= mMaxSize)
+		{
+			return;
+		}
+
+		std::vector<std::pair<std::string, TEntryInfo>> entries(mEntries.cbegin(), mEntries.cend());
+
+		std::sort(entries.begin(), entries.end(), [](const auto& left, const auto& right)
+		{
+			return left.second.mLastAccessTime < right.second.mLastAccessTime;
+		});
+
+		std::error_code errorCode;
+
+		for (const auto& currEntry : entries)
+		{
+			if (mCurrSize <= mMaxSize)
+			{
+				break;
+			}
+
+			std::filesystem::remove(_getEntryPath(currEntry.first), errorCode);
+
+			mCurrSize -= currEntry.second.mSize;
+
+			mEntries.erase(currEntry.first);
+		}
+	}
+}
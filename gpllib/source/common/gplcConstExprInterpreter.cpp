@@ -1,11 +1,158 @@
 #include "common/gplcConstExprInterpreter.h"
 #include "common/gplcSymTable.h"
+#include "common/gplcTypeSystem.h"
 #include "parser/gplcASTNodes.h"
 #include "common/gplcValues.h"
+#include <limits>
+#include <cmath>
+#include <type_traits>
 
 
 namespace gplc
 {
+	constexpr U32 MaxCallDepth       = 128;
+	constexpr U32 MaxEvaluationSteps = 1 << 20; ///< Loops' iterations and calls, the limit prevents hanging up on infinite loops
+
+
+	static bool IsSignedIntegerType(E_COMPILER_TYPES type)
+	{
+		return type >= CT_INT8 && type <= CT_INT64;
+	}
+
+	static bool IsUnsignedIntegerType(E_COMPILER_TYPES type)
+	{
+		return type >= CT_UINT8 && type <= CT_UINT64;
+	}
+
+	static bool IsFloatingPointType(E_COMPILER_TYPES type)
+	{
+		return type == CT_FLOAT || type == CT_DOUBLE;
+	}
+
+	static U32 GetIntegerTypeBits(E_COMPILER_TYPES type)
+	{
+		switch (type)
+		{
+			case CT_INT8:
+			case CT_UINT8:
+				return 8;
+			case CT_INT16:
+			case CT_UINT16:
+				return 16;
+			case CT_INT32:
+			case CT_UINT32:
+				return 32;
+		}
+
+		return 64;
+	}
+
+	static bool IsInRange(I64 value, E_COMPILER_TYPES type)
+	{
+		const U32 bits = GetIntegerTypeBits(type);
+
+		if (IsUnsignedIntegerType(type))
+		{
+			return value >= 0 && (bits == 64 || static_cast<U64>(value) < (1ull << bits));
+		}
+
+		return bits == 64 || (value >= -(1ll << (bits - 1)) && value < (1ll << (bits - 1)));
+	}
+
+	static bool IsInRange(U64 value, E_COMPILER_TYPES type)
+	{
+		const U32 bits = GetIntegerTypeBits(type);
+
+		return IsUnsignedIntegerType(type) ? (bits == 64 || value < (1ull << bits)) : value < (1ull << (bits - 1));
+	}
+
+	/*!
+		\brief The functions below return false if an operation overflows T
+	*/
+
+	template <typename T>
+	static bool CheckedAdd(T left, T right, T& result)
+	{
+		constexpr T minValue = (std::numeric_limits<T>::min)();
+		constexpr T maxValue = (std::numeric_limits<T>::max)();
+
+		if ((right > 0 && left > maxValue - right) || (std::is_signed<T>::value && right < 0 && left < minValue - right))
+		{
+			return false;
+		}
+
+		result = left + right;
+
+		return true;
+	}
+
+	template <typename T>
+	static bool CheckedSub(T left, T right, T& result)
+	{
+		constexpr T minValue = (std::numeric_limits<T>::min)();
+		constexpr T maxValue = (std::numeric_limits<T>::max)();
+
+		if (std::is_signed<T>::value ? ((right < 0 && left > maxValue + right) || (right > 0 && left < minValue + right)) : left < right)
+		{
+			return false;
+		}
+
+		result = left - right;
+
+		return true;
+	}
+
+	template <typename T>
+	static bool CheckedMul(T left, T right, T& result)
+	{
+		constexpr T minValue = (std::numeric_limits<T>::min)();
+		constexpr T maxValue = (std::numeric_limits<T>::max)();
+
+		result = 0;
+
+		if (!left || !right)
+		{
+			return true;
+		}
+
+		bool isOverflowed = false;
+
+		if (!std::is_signed<T>::value)
+		{
+			isOverflowed = left > maxValue / right;
+		}
+		else if (left > 0)
+		{
+			isOverflowed = (right > 0) ? (left > maxValue / right) : (right < minValue / left);
+		}
+		else
+		{
+			isOverflowed = (right > 0) ? (left < minValue / right) : (right < maxValue / left);
+		}
+
+		if (isOverflowed)
+		{
+			return false;
+		}
+
+		result = left * right;
+
+		return true;
+	}
+
+
+	Result CConstExprInterpreter::Init(ITypeResolver* pTypeResolver)
+	{
+		if (!pTypeResolver)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		mpTypeResolver = pTypeResolver;
+
+		return RV_SUCCESS;
+	}
+
 	TResult<U32> CConstExprInterpreter::Eval(CASTExpressionNode* pExpr, ISymTable* pSymTable)
 	{
 		if (!pExpr)
@@ -13,199 +160,1020 @@ namespace gplc
 			return TOkValue(std::numeric_limits<U32>::max());
 		}
 
-		mpSymTable = pSymTable;
-
-		U32 result = std::get<U32>(pExpr->Accept(this));
+		auto evaluatedValue = EvalValue(pExpr, pSymTable);
 
-		if (result == std::numeric_limits<U32>::max())
+		if (evaluatedValue.HasError())
 		{
 			return TErrorValue(RV_FAIL);
 		}
 
-		return TOkValue(result);
+		const TConstValue& value = evaluatedValue.Get();
+
+		// \note negative values are kept in two's complement form as it was before
+		if (const I64* pIntValue = std::get_if<I64>(&value.mValue))
+		{
+			return TOkValue(static_cast<U32>(*pIntValue));
+		}
+
+		if (const U64* pUIntValue = std::get_if<U64>(&value.mValue))
+		{
+			return TOkValue(static_cast<U32>(*pUIntValue));
+		}
+
+		return TErrorValue(RV_FAIL);
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitProgramUnit(CASTSourceUnitNode* pProgramNode) 
+	TResult<TConstValue> CConstExprInterpreter::EvalValue(CASTExpressionNode* pExpr, ISymTable* pSymTable)
 	{
-		return std::numeric_limits<U32>::max();
+		if (!pExpr || !pSymTable)
+		{
+			return TErrorValue(RV_INVALID_ARGUMENTS);
+		}
+
+		mpSymTable = pSymTable;
+
+		// \note the interpreter can be reentered through the type resolver, e.g. sizeof(int32[N]), so the state is saved
+		TCallFramesArray prevCallFrames;
+
+		std::swap(prevCallFrames, mCallFrames);
+
+		const U32 prevStepsCount = mStepsCount;
+
+		mStepsCount = 0;
+
+		E_EVAL_STATUS status = _evalNode(pExpr);
+
+		std::swap(prevCallFrames, mCallFrames);
+
+		mStepsCount = prevStepsCount;
+
+		if (status != ES_SUCCESS)
+		{
+			return TErrorValue(RV_FAIL);
+		}
+
+		return TOkValue(mCurrValue);
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitDeclaration(CASTDeclarationNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitProgramUnit(CASTSourceUnitNode* pProgramNode)
 	{
-		return std::numeric_limits<U32>::max();
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitIdentifier(CASTIdentifierNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitDeclaration(CASTDeclarationNode* pNode)
 	{
-		auto pSymbolDesc = mpSymTable->LookUp(pNode->GetName());
-		
-		return pSymbolDesc->mpValue->Accept(this);
+		TCallFrame* pCallFrame = _getCurrCallFrame();
+
+		CType* pType = nullptr;
+
+		// \note only local variables of functions that are evaluated in compile time are supported
+		if (!pCallFrame || !mpTypeResolver || !(pType = mpTypeResolver->Resolve(pNode->GetTypeInfo())))
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		const E_COMPILER_TYPES type = pType->GetType();
+
+		if (IsSignedIntegerType(type))
+		{
+			mCurrValue = { type, I64(0) };
+		}
+		else if (IsUnsignedIntegerType(type))
+		{
+			mCurrValue = { type, U64(0) };
+		}
+		else if (IsFloatingPointType(type))
+		{
+			mCurrValue = { type, F64(0.0) };
+		}
+		else if (type == CT_BOOL)
+		{
+			mCurrValue = { type, false };
+		}
+		else
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		for (auto pCurrIdentifier : pNode->GetIdentifiers()->GetChildren())
+		{
+			(*pCallFrame)[dynamic_cast<CASTIdentifierNode*>(pCurrIdentifier)->GetName()] = mCurrValue;
+		}
+
+		return ES_SUCCESS;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitLiteral(CASTLiteralNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitIdentifier(CASTIdentifierNode* pNode)
 	{
-		CBaseValue* pValue = pNode->GetValue();
+		const std::string& identifier = pNode->GetName();
 
-		if (pValue->GetType() == LT_INT)
+		// \note local variables and arguments of a function which is evaluated now
+		if (TCallFrame* pCallFrame = _getCurrCallFrame())
 		{
-			return dynamic_cast<CIntValue*>(pValue)->GetValue();
+			auto iter = pCallFrame->find(identifier);
+
+			if (iter != pCallFrame->cend())
+			{
+				mCurrValue = iter->second;
+
+				return ES_SUCCESS;
+			}
 		}
 
-		if (pValue->GetType() == LT_UINT)
+		auto pSymbolDesc = mpSymTable->LookUp(identifier);
+
+		// \note a value of a variable is known only in runtime, mpValue of it is just a default one
+		if (!pSymbolDesc || !pSymbolDesc->mpValue || !pSymbolDesc->mIsConstant || pSymbolDesc->mIsReassigned || (mCallFrames.size() >= MaxCallDepth))
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		// \note evaluate the value in a new frame, so locals of the current function aren't visible there
+		mCallFrames.push_back({});
+
+		E_EVAL_STATUS status = _evalNode(pSymbolDesc->mpValue);
+
+		mCallFrames.pop_back();
+
+		if (status != ES_SUCCESS)
 		{
-			return dynamic_cast<CUIntValue*>(pValue)->GetValue();
+			return status;
 		}
 
-		return std::numeric_limits<U32>::max();
+		return pSymbolDesc->mpType ? _convertCurrValue(pSymbolDesc->mpType->GetType()) : ES_SUCCESS;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitUnaryExpression(CASTUnaryExpressionNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitLiteral(CASTLiteralNode* pNode)
 	{
-		U32 result = std::get<U32>(pNode->GetData()->Accept(this));
+		CBaseValue* pValue = pNode->GetValue();
+
+		switch (pValue->GetType())
+		{
+			case LT_INT:
+				{
+					auto pIntValue = dynamic_cast<CIntValue*>(pValue);
+
+					mCurrValue = { pIntValue->IsLong() ? CT_INT64 : CT_INT32, pIntValue->GetValue() };
+				}
+				return ES_SUCCESS;
+			case LT_UINT:
+				{
+					auto pUIntValue = dynamic_cast<CUIntValue*>(pValue);
+
+					mCurrValue = { pUIntValue->IsLong() ? CT_UINT64 : CT_UINT32, pUIntValue->GetValue() };
+				}
+				return ES_SUCCESS;
+			case LT_FLOAT:
+				mCurrValue = { CT_FLOAT, static_cast<F64>(dynamic_cast<CFloatValue*>(pValue)->GetValue()) };
+				return ES_SUCCESS;
+			case LT_DOUBLE:
+				mCurrValue = { CT_DOUBLE, dynamic_cast<CDoubleValue*>(pValue)->GetValue() };
+				return ES_SUCCESS;
+			case LT_BOOLEAN:
+				mCurrValue = { CT_BOOL, dynamic_cast<CBoolValue*>(pValue)->GetValue() };
+				return ES_SUCCESS;
+		}
 
-		return (pNode->GetOpType() == TT_MINUS) ? -result : result;
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitBinaryExpression(CASTBinaryExpressionNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitUnaryExpression(CASTUnaryExpressionNode* pNode)
 	{
-		U32 leftExpr  = std::get<U32>(pNode->GetLeft()->Accept(this));
-		U32 rightExpr = std::get<U32>(pNode->GetRight()->Accept(this));
+		E_EVAL_STATUS status = _evalNode(pNode->GetData());
 
-		switch (pNode->GetOpType())
+		if (status != ES_SUCCESS)
 		{
-			case TT_PLUS:
-				return leftExpr + rightExpr;
+			return status;
+		}
 
+		switch (pNode->GetOpType())
+		{
+			case TT_DEFAULT:
+				return ES_SUCCESS;
 			case TT_MINUS:
-				return leftExpr - rightExpr;
+				if (I64* pIntValue = std::get_if<I64>(&mCurrValue.mValue))
+				{
+					if (*pIntValue == (std::numeric_limits<I64>::min)() || !IsInRange(-*pIntValue, mCurrValue.mType))
+					{
+						return _notifyError(SAE_INTEGER_OVERFLOW_IN_CONST_EXPR);
+					}
 
-			case TT_STAR:
-				return leftExpr * rightExpr;
+					*pIntValue = -*pIntValue;
+
+					return ES_SUCCESS;
+				}
+
+				if (U64* pUIntValue = std::get_if<U64>(&mCurrValue.mValue))
+				{
+					return *pUIntValue ? _notifyError(SAE_INTEGER_OVERFLOW_IN_CONST_EXPR) : ES_SUCCESS;
+				}
+
+				if (F64* pFloatValue = std::get_if<F64>(&mCurrValue.mValue))
+				{
+					*pFloatValue = -*pFloatValue;
+
+					return ES_SUCCESS;
+				}
+
+				return ES_NOT_CONSTANT;
+			case TT_NOT:
+				if (bool* pBoolValue = std::get_if<bool>(&mCurrValue.mValue))
+				{
+					*pBoolValue = !*pBoolValue;
+
+					return ES_SUCCESS;
+				}
+
+				return ES_NOT_CONSTANT;
+		}
+
+		// \note pointers can't be dereferenced or taken in compile time
+		return ES_NOT_CONSTANT;
+	}
+
+	TLLVMIRData CConstExprInterpreter::VisitBinaryExpression(CASTBinaryExpressionNode* pNode)
+	{
+		const E_TOKEN_TYPE opType = pNode->GetOpType();
+
+		E_EVAL_STATUS status = _evalNode(pNode->GetLeft());
+
+		if (status != ES_SUCCESS)
+		{
+			return status;
+		}
+
+		// \note logical operators are short-circuit ones
+		if (opType == TT_AND || opType == TT_OR)
+		{
+			bool* pLeftValue = std::get_if<bool>(&mCurrValue.mValue);
+
+			if (!pLeftValue)
+			{
+				return ES_NOT_CONSTANT;
+			}
+
+			if (*pLeftValue == (opType == TT_OR))
+			{
+				return ES_SUCCESS;
+			}
+
+			if ((status = _evalNode(pNode->GetRight())) != ES_SUCCESS)
+			{
+				return status;
+			}
 
+			return (mCurrValue.mType == CT_BOOL) ? ES_SUCCESS : ES_NOT_CONSTANT;
+		}
+
+		const TConstValue leftValue = mCurrValue;
+
+		if ((status = _evalNode(pNode->GetRight())) != ES_SUCCESS)
+		{
+			return status;
+		}
+
+		const TConstValue rightValue = mCurrValue;
+
+		switch (opType)
+		{
+			case TT_PLUS:
+			case TT_MINUS:
+			case TT_STAR:
 			case TT_SLASH:
-				return leftExpr / rightExpr;
+			case TT_PERCENT_SIGN:
+				return _evalArithmeticOp(opType, leftValue, rightValue);
+			case TT_LT:
+			case TT_LE:
+			case TT_GT:
+			case TT_GE:
+			case TT_NE:
+			case TT_EQ:
+				return _evalComparisonOp(opType, leftValue, rightValue);
 		}
 
-		return std::numeric_limits<U32>::max();
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitAssignment(CASTAssignmentNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitAssignment(CASTAssignmentNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		TCallFrame* pCallFrame = _getCurrCallFrame();
+
+		auto pLeftExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode->GetLeft());
+
+		CASTIdentifierNode* pIdentifier = pLeftExpr ? dynamic_cast<CASTIdentifierNode*>(pLeftExpr->GetData()) : nullptr;
+
+		if (!pCallFrame || !pIdentifier || pLeftExpr->GetOpType() != TT_DEFAULT)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		// \note a function that changes global state isn't a pure one
+		auto iter = pCallFrame->find(pIdentifier->GetName());
+
+		if (iter == pCallFrame->cend())
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		E_EVAL_STATUS status = _evalNode(pNode->GetRight());
+
+		if (status != ES_SUCCESS || (status = _convertCurrValue(iter->second.mType)) != ES_SUCCESS)
+		{
+			return status;
+		}
+
+		iter->second = mCurrValue;
+
+		return ES_SUCCESS;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitStatementsBlock(CASTBlockNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitStatementsBlock(CASTBlockNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		E_EVAL_STATUS status = ES_SUCCESS;
+
+		for (auto pCurrStatement : pNode->GetStatements())
+		{
+			if ((status = _evalNode(pCurrStatement)) != ES_SUCCESS)
+			{
+				return status;
+			}
+		}
+
+		return ES_SUCCESS;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitIfStatement(CASTIfStatementNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitIfStatement(CASTIfStatementNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		E_EVAL_STATUS status = _evalNode(pNode->GetCondition());
+
+		if (status != ES_SUCCESS)
+		{
+			return status;
+		}
+
+		bool* pCondition = std::get_if<bool>(&mCurrValue.mValue);
+
+		if (!pCondition)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		CASTBlockNode* pBranch = *pCondition ? pNode->GetThenBlock() : pNode->GetElseBlock();
+
+		return pBranch ? _evalNode(pBranch) : ES_SUCCESS;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitLoopStatement(CASTLoopStatementNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitLoopStatement(CASTLoopStatementNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		E_EVAL_STATUS status = ES_SUCCESS;
+
+		while (++mStepsCount < MaxEvaluationSteps)
+		{
+			status = _evalNode(pNode->GetBody());
+
+			if (status == ES_BREAK)
+			{
+				return ES_SUCCESS;
+			}
+
+			if (status != ES_SUCCESS && status != ES_CONTINUE)
+			{
+				return status;
+			}
+		}
+
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitWhileLoopStatement(CASTWhileLoopStatementNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitWhileLoopStatement(CASTWhileLoopStatementNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		E_EVAL_STATUS status = ES_SUCCESS;
+
+		while (++mStepsCount < MaxEvaluationSteps)
+		{
+			if ((status = _evalNode(pNode->GetCondition())) != ES_SUCCESS)
+			{
+				return status;
+			}
+
+			bool* pCondition = std::get_if<bool>(&mCurrValue.mValue);
+
+			if (!pCondition)
+			{
+				return ES_NOT_CONSTANT;
+			}
+
+			if (!*pCondition)
+			{
+				return ES_SUCCESS;
+			}
+
+			status = _evalNode(pNode->GetBody());
+
+			if (status == ES_BREAK)
+			{
+				return ES_SUCCESS;
+			}
+
+			if (status != ES_SUCCESS && status != ES_CONTINUE)
+			{
+				return status;
+			}
+		}
+
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitFunctionDeclaration(CASTFunctionDeclNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitFunctionDeclaration(CASTFunctionDeclNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitFunctionClosure(CASTFunctionClosureNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitFunctionClosure(CASTFunctionClosureNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitFunctionArgs(CASTFunctionArgsNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitFunctionArgs(CASTFunctionArgsNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitFunctionCall(CASTFunctionCallNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitFunctionCall(CASTFunctionCallNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		auto pIdentifier = dynamic_cast<CASTIdentifierNode*>(pNode->GetIdentifier()->GetData());
+
+		if (!pIdentifier || mCallFrames.size() >= MaxCallDepth || ++mStepsCount >= MaxEvaluationSteps)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		// \note only functions which are defined within the source code can be evaluated, native ones aren't pure by definition
+		auto pSymbolDesc = mpSymTable->LookUp(pIdentifier->GetName());
+
+		CFunctionType* pFuncType = pSymbolDesc ? dynamic_cast<CFunctionType*>(pSymbolDesc->mpType) : nullptr;
+
+		if (!pFuncType || !pSymbolDesc->mpFuncDefinition || pFuncType->IsProcedure())
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		const auto& argsTypes = pFuncType->GetArgsTypes();
+
+		auto pArgs = pNode->GetArgs();
+
+		const U32 argsCount = pArgs ? pArgs->GetChildrenCount() : 0;
+
+		if (argsCount != argsTypes.size())
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		TCallFrame callFrame;
+
+		E_EVAL_STATUS status = ES_SUCCESS;
+
+		for (U32 i = 0; i < argsCount; ++i)
+		{
+			if ((status = _evalNode(pArgs->GetChildren()[i])) != ES_SUCCESS ||
+				(status = _convertCurrValue(argsTypes[i].second->GetType())) != ES_SUCCESS)
+			{
+				return status;
+			}
+
+			callFrame[argsTypes[i].first] = mCurrValue;
+		}
+
+		// \note names of the callee's body are resolved within the scope where the callee is defined, not within the caller's one
+		ISymTable::TScopeHandle calleeScopeHandle = mpSymTable->GetSymbolScopeHandle(pIdentifier->GetName());
+
+		mCallFrames.emplace_back(std::move(callFrame));
+
+		status = ES_NOT_CONSTANT;
+
+		mpSymTable->VisitScopeWithRestore(calleeScopeHandle, [this, &status, pSymbolDesc](ISymTable* pSymTable)
+		{
+			status = _evalNode(pSymbolDesc->mpFuncDefinition->GetValue());
+		});
+
+		mCallFrames.pop_back();
+
+		// \note a function without return statement can't produce a value
+		if (status != ES_RETURN)
+		{
+			return (status == ES_ERROR) ? ES_ERROR : ES_NOT_CONSTANT;
+		}
+
+		return _convertCurrValue(pFuncType->GetReturnValueType()->GetType());
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitReturnStatement(CASTReturnStatementNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitReturnStatement(CASTReturnStatementNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		auto pExpr = pNode->GetExpr();
+
+		if (!pExpr)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		E_EVAL_STATUS status = _evalNode(pExpr);
+
+		return (status == ES_SUCCESS) ? ES_RETURN : status;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitDefinitionNode(CASTDefinitionNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitDefinitionNode(CASTDefinitionNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		auto pDeclaration = pNode->GetDeclaration();
+
+		E_EVAL_STATUS status = ES_SUCCESS;
+
+		// \note a declaration is visited first to register variables and to get their type
+		if ((status = static_cast<E_EVAL_STATUS>(std::get<U32>(VisitDeclaration(pDeclaration)))) != ES_SUCCESS)
+		{
+			return status;
+		}
+
+		const E_COMPILER_TYPES type = mCurrValue.mType;
+
+		if ((status = _evalNode(pNode->GetValue())) != ES_SUCCESS || (status = _convertCurrValue(type)) != ES_SUCCESS)
+		{
+			return status;
+		}
+
+		TCallFrame* pCallFrame = _getCurrCallFrame();
+
+		for (auto pCurrIdentifier : pDeclaration->GetIdentifiers()->GetChildren())
+		{
+			(*pCallFrame)[dynamic_cast<CASTIdentifierNode*>(pCurrIdentifier)->GetName()] = mCurrValue;
+		}
+
+		return ES_SUCCESS;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitFunctionDefNode(CASTFuncDefinitionNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitFunctionDefNode(CASTFuncDefinitionNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitEnumDeclaration(CASTEnumDeclNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitEnumDeclaration(CASTEnumDeclNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitStructDeclaration(CASTStructDeclNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitStructDeclaration(CASTStructDeclNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		return ES_NOT_CONSTANT;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitBreakOperator(CASTBreakOperatorNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitBreakOperator(CASTBreakOperatorNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		return ES_BREAK;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitContinueOperator(CASTContinueOperatorNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitContinueOperator(CASTContinueOperatorNode* pNode)
 	{
-		return std::numeric_limits<U32>::max();
+		return ES_CONTINUE;
 	}
 
-	TLLVMIRData CConstExprInterpreter::VisitAccessOperator(CASTAccessOperatorNode* pNode) 
+	TLLVMIRData CConstExprInterpreter::VisitAccessOperator(CASTAccessOperatorNode* pNode)
 	{
-		return {};
+		auto extractIdentifier = [](CASTNode* pNode) -> CASTIdentifierNode*
+		{
+			CASTUnaryExpressionNode* pUnaryExpr = nullptr;
+
+			while ((pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode)) && pUnaryExpr->GetOpType() == TT_DEFAULT)
+			{
+				pNode = pUnaryExpr->GetData();
+			}
+
+			return dynamic_cast<CASTIdentifierNode*>(pNode);
+		};
+
+		CASTIdentifierNode* pScopeIdentifier  = extractIdentifier(pNode->GetExpression());
+		CASTIdentifierNode* pMemberIdentifier = extractIdentifier(pNode->GetMemberName());
+
+		if (!pScopeIdentifier || !pMemberIdentifier)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		// \note only enumerators are compile time constants
+		auto pScopeDesc = mpSymTable->LookUpNamedScope(pScopeIdentifier->GetName());
+
+		if (!pScopeDesc || !pScopeDesc->mpType || pScopeDesc->mpType->GetType() != CT_ENUM)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		auto iter = pScopeDesc->mVariables.find(pMemberIdentifier->GetName());
+
+		if (iter == pScopeDesc->mVariables.cend())
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		auto pEnumeratorDesc = mpSymTable->LookUp(iter->second);
+
+		if (!pEnumeratorDesc || !pEnumeratorDesc->mpValue)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		E_EVAL_STATUS status = ES_NOT_CONSTANT;
+
+		// \note enumerators' values can refer to each other, so they're evaluated within the enumeration's scope
+		mpSymTable->VisitNamedScopeWithRestore(pScopeIdentifier->GetName(), [this, &status, pEnumeratorDesc](ISymTable* pSymTable)
+		{
+			status = _evalNode(pEnumeratorDesc->mpValue);
+		});
+
+		return status;
 	}
 
 	TLLVMIRData CConstExprInterpreter::VisitArrayTypeNode(CASTArrayTypeNode* pNode)
 	{
-		return {};
+		return ES_NOT_CONSTANT;
 	}
 
 	TLLVMIRData CConstExprInterpreter::VisitIndexedAccessOperator(CASTIndexedAccessOperatorNode* pNode)
 	{
-		return {};
+		return ES_NOT_CONSTANT;
 	}
 
 	TLLVMIRData CConstExprInterpreter::VisitPointerTypeNode(CASTPointerTypeNode* pNode)
 	{
-		return {};
+		return ES_NOT_CONSTANT;
 	}
 
 	TLLVMIRData CConstExprInterpreter::VisitImportDirectiveNode(CASTImportDirectiveNode* pNode)
 	{
-		return {};
+		return ES_NOT_CONSTANT;
 	}
 
 	TLLVMIRData CConstExprInterpreter::VisitDeferOperatorNode(CASTDeferOperatorNode* pNode)
 	{
-		return {};
+		return ES_NOT_CONSTANT;
 	}
 
 	TLLVMIRData CConstExprInterpreter::VisitIntrinsicCall(CASTIntrinsicCallNode* pNode)
 	{
-		return {};
+		auto pArgs = pNode->GetArgs();
+
+		if (!mpTypeResolver || !pArgs || !pArgs->GetChildrenCount())
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		CType* pType = mpTypeResolver->Resolve(dynamic_cast<CASTTypeNode*>(pArgs->GetChildren()[0]));
+
+		if (!pType)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		E_EVAL_STATUS status = ES_SUCCESS;
+
+		switch (pNode->GetType())
+		{
+			case NT_SIZEOF_OPERATOR:
+				mCurrValue = { CT_UINT64, static_cast<U64>(pType->GetSize()) };
+				return ES_SUCCESS;
+			case NT_TYPEID_OPERATOR:
+				mCurrValue = { CT_UINT64, pType->GetTypeId() };
+				return ES_SUCCESS;
+			case NT_CAST_INTRINSIC:
+				if (pArgs->GetChildrenCount() < 2 || (status = _evalNode(pArgs->GetChildren()[1])) != ES_SUCCESS)
+				{
+					return (status == ES_SUCCESS) ? ES_NOT_CONSTANT : status;
+				}
+
+				return _convertCurrValue(pType->GetType(), true);
+		}
+
+		return ES_NOT_CONSTANT;
 	}
 
 	TLLVMIRData CConstExprInterpreter::VisitVariantDeclaration(CASTVariantDeclNode* pNode)
 	{
-		return {};
+		return ES_NOT_CONSTANT;
+	}
+
+	CConstExprInterpreter::E_EVAL_STATUS CConstExprInterpreter::_evalNode(CASTNode* pNode)
+	{
+		if (!pNode)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		TLLVMIRData result = pNode->Accept(this);
+
+		const U32* pStatus = std::get_if<U32>(&result);
+
+		return pStatus ? static_cast<E_EVAL_STATUS>(*pStatus) : ES_NOT_CONSTANT;
+	}
+
+	CConstExprInterpreter::E_EVAL_STATUS CConstExprInterpreter::_evalArithmeticOp(E_TOKEN_TYPE opType, const TConstValue& left, const TConstValue& right)
+	{
+		const E_COMPILER_TYPES commonType = GetCommonArithmeticType(left.mType, right.mType);
+
+		if (commonType == CT_LAST)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		// \note both operands are converted into the common type, their values fit into it, so there is no need to check for errors
+		mCurrValue = right;
+		_convertCurrValue(commonType);
+
+		const TConstValue rightValue = mCurrValue;
+
+		mCurrValue = left;
+		_convertCurrValue(commonType);
+
+		if (IsFloatingPointType(commonType))
+		{
+			F64 leftOp  = std::get<F64>(mCurrValue.mValue);
+			F64 rightOp = std::get<F64>(rightValue.mValue);
+
+			F64 result = 0.0;
+
+			switch (opType)
+			{
+				case TT_PLUS:
+					result = leftOp + rightOp;
+					break;
+				case TT_MINUS:
+					result = leftOp - rightOp;
+					break;
+				case TT_STAR:
+					result = leftOp * rightOp;
+					break;
+				case TT_SLASH:
+					result = leftOp / rightOp;
+					break;
+				default:
+					return ES_NOT_CONSTANT;
+			}
+
+			mCurrValue.mValue = (commonType == CT_FLOAT) ? static_cast<F64>(static_cast<F32>(result)) : result;
+
+			return ES_SUCCESS;
+		}
+
+		auto evalIntegerOp = [this, opType](auto leftOp, auto rightOp, auto& result) -> E_EVAL_STATUS
+		{
+			bool isSucceeded = true;
+
+			switch (opType)
+			{
+				case TT_PLUS:
+					isSucceeded = CheckedAdd(leftOp, rightOp, result);
+					break;
+				case TT_MINUS:
+					isSucceeded = CheckedSub(leftOp, rightOp, result);
+					break;
+				case TT_STAR:
+					isSucceeded = CheckedMul(leftOp, rightOp, result);
+					break;
+				case TT_SLASH:
+				case TT_PERCENT_SIGN:
+					if (!rightOp)
+					{
+						return _notifyError(SAE_DIVISION_BY_ZERO_IN_CONST_EXPR);
+					}
+
+					// \note the only case of overflow is INT64_MIN / -1
+					if (std::is_signed<decltype(leftOp)>::value && leftOp == (std::numeric_limits<decltype(leftOp)>::min)() && rightOp == static_cast<decltype(rightOp)>(-1))
+					{
+						return _notifyError(SAE_INTEGER_OVERFLOW_IN_CONST_EXPR);
+					}
+
+					result = (opType == TT_SLASH) ? (leftOp / rightOp) : (leftOp % rightOp);
+					break;
+				default:
+					return ES_NOT_CONSTANT;
+			}
+
+			return isSucceeded ? ES_SUCCESS : _notifyError(SAE_INTEGER_OVERFLOW_IN_CONST_EXPR);
+		};
+
+		E_EVAL_STATUS status = ES_SUCCESS;
+
+		if (IsUnsignedIntegerType(commonType))
+		{
+			U64 result = 0;
+
+			if ((status = evalIntegerOp(std::get<U64>(mCurrValue.mValue), std::get<U64>(rightValue.mValue), result)) != ES_SUCCESS)
+			{
+				return status;
+			}
+
+			mCurrValue.mValue = result;
+
+			return IsInRange(result, commonType) ? ES_SUCCESS : _notifyError(SAE_INTEGER_OVERFLOW_IN_CONST_EXPR);
+		}
+
+		I64 result = 0;
+
+		if ((status = evalIntegerOp(std::get<I64>(mCurrValue.mValue), std::get<I64>(rightValue.mValue), result)) != ES_SUCCESS)
+		{
+			return status;
+		}
+
+		mCurrValue.mValue = result;
+
+		return IsInRange(result, commonType) ? ES_SUCCESS : _notifyError(SAE_INTEGER_OVERFLOW_IN_CONST_EXPR);
+	}
+
+	CConstExprInterpreter::E_EVAL_STATUS CConstExprInterpreter::_evalComparisonOp(E_TOKEN_TYPE opType, const TConstValue& left, const TConstValue& right)
+	{
+		auto compare = [opType](auto leftOp, auto rightOp)
+		{
+			switch (opType)
+			{
+				case TT_LT:
+					return leftOp < rightOp;
+				case TT_LE:
+					return leftOp <= rightOp;
+				case TT_GT:
+					return leftOp > rightOp;
+				case TT_GE:
+					return leftOp >= rightOp;
+				case TT_NE:
+					return leftOp != rightOp;
+			}
+
+			return leftOp == rightOp;
+		};
+
+		// \note booleans can be only checked for equality
+		if (left.mType == CT_BOOL || right.mType == CT_BOOL)
+		{
+			if (left.mType != right.mType || (opType != TT_EQ && opType != TT_NE))
+			{
+				return ES_NOT_CONSTANT;
+			}
+
+			mCurrValue = { CT_BOOL, compare(std::get<bool>(left.mValue), std::get<bool>(right.mValue)) };
+
+			return ES_SUCCESS;
+		}
+
+		const E_COMPILER_TYPES commonType = GetCommonArithmeticType(left.mType, right.mType);
+
+		if (commonType == CT_LAST)
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		E_EVAL_STATUS status = ES_SUCCESS;
+
+		mCurrValue = right;
+
+		// \note a negative value can't be converted into an unsigned one, but comparison of them is still valid
+		if ((status = _convertCurrValue(commonType, true)) != ES_SUCCESS)
+		{
+			return status;
+		}
+
+		const TConstValue rightValue = mCurrValue;
+
+		mCurrValue = left;
+
+		if ((status = _convertCurrValue(commonType, true)) != ES_SUCCESS)
+		{
+			return status;
+		}
+
+		bool result = false;
+
+		if (IsFloatingPointType(commonType))
+		{
+			result = compare(std::get<F64>(mCurrValue.mValue), std::get<F64>(rightValue.mValue));
+		}
+		else if (IsUnsignedIntegerType(commonType))
+		{
+			result = compare(std::get<U64>(mCurrValue.mValue), std::get<U64>(rightValue.mValue));
+		}
+		else
+		{
+			result = compare(std::get<I64>(mCurrValue.mValue), std::get<I64>(rightValue.mValue));
+		}
+
+		mCurrValue = { CT_BOOL, result };
+
+		return ES_SUCCESS;
+	}
+
+	CConstExprInterpreter::E_EVAL_STATUS CConstExprInterpreter::_convertCurrValue(E_COMPILER_TYPES type, bool isExplicit)
+	{
+		const E_COMPILER_TYPES srcType = mCurrValue.mType;
+
+		if (srcType == type && !isExplicit)
+		{
+			return ES_SUCCESS;
+		}
+
+		if (type == CT_BOOL || srcType == CT_BOOL)
+		{
+			return (type == srcType) ? ES_SUCCESS : ES_NOT_CONSTANT;
+		}
+
+		if (IsFloatingPointType(type))
+		{
+			F64 value = 0.0;
+
+			if (const I64* pIntValue = std::get_if<I64>(&mCurrValue.mValue))
+			{
+				value = static_cast<F64>(*pIntValue);
+			}
+			else if (const U64* pUIntValue = std::get_if<U64>(&mCurrValue.mValue))
+			{
+				value = static_cast<F64>(*pUIntValue);
+			}
+			else
+			{
+				value = std::get<F64>(mCurrValue.mValue);
+			}
+
+			mCurrValue = { type, (type == CT_FLOAT) ? static_cast<F64>(static_cast<F32>(value)) : value };
+
+			return ES_SUCCESS;
+		}
+
+		if (!IsSignedIntegerType(type) && !IsUnsignedIntegerType(type))
+		{
+			return ES_NOT_CONSTANT;
+		}
+
+		const U32 bits = GetIntegerTypeBits(type);
+
+		// \note explicit conversions keep lower bits of the value as it's done in runtime
+		auto truncate = [bits, type](U64 value) -> TConstValue
+		{
+			const U64 mask = (bits == 64) ? (std::numeric_limits<U64>::max)() : ((1ull << bits) - 1);
+
+			value &= mask;
+
+			if (IsUnsignedIntegerType(type))
+			{
+				return { type, value };
+			}
+
+			// \note sign extension
+			const U64 signBit = 1ull << (bits - 1);
+
+			return { type, static_cast<I64>((value ^ signBit) - signBit) };
+		};
+
+		if (const F64* pFloatValue = std::get_if<F64>(&mCurrValue.mValue))
+		{
+			const F64 value = std::trunc(*pFloatValue);
+
+			// \note the checks are inexact near the bounds of 64 bit types, but they reject values which can't be represented at all
+			if (std::isnan(value) || value <= -9223372036854775809.0 || value >= 18446744073709551616.0)
+			{
+				return _notifyError(SAE_INTEGER_OVERFLOW_IN_CONST_EXPR);
+			}
+
+			mCurrValue = (value < 0.0) ? TConstValue { CT_INT64, static_cast<I64>(value) } : TConstValue { CT_UINT64, static_cast<U64>(value) };
+
+			return _convertCurrValue(type, isExplicit);
+		}
+
+		if (const I64* pIntValue = std::get_if<I64>(&mCurrValue.mValue))
+		{
+			if (!isExplicit && !IsInRange(*pIntValue, type))
+			{
+				return _notifyError(SAE_INTEGER_OVERFLOW_IN_CONST_EXPR);
+			}
+
+			mCurrValue = truncate(static_cast<U64>(*pIntValue));
+
+			return ES_SUCCESS;
+		}
+
+		const U64 value = std::get<U64>(mCurrValue.mValue);
+
+		if (!isExplicit && !IsInRange(value, type))
+		{
+			return _notifyError(SAE_INTEGER_OVERFLOW_IN_CONST_EXPR);
+		}
+
+		mCurrValue = truncate(value);
+
+		return ES_SUCCESS;
+	}
+
+	CConstExprInterpreter::E_EVAL_STATUS CConstExprInterpreter::_notifyError(E_SEMANTIC_ANALYSER_MESSAGE message) const
+	{
+		OnErrorOutput.Invoke({ message, E_MESSAGE_TYPE::MT_ERROR });
+
+		return ES_ERROR;
+	}
+
+	CConstExprInterpreter::TCallFrame* CConstExprInterpreter::_getCurrCallFrame()
+	{
+		return mCallFrames.empty() ? nullptr : &mCallFrames.back();
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,1084 @@
+#include "common/gplcModuleInterface.h"
+#include "common/gplcSymTable.h"
+#include "common/gplcTypeSystem.h"
+#include "common/gplcTypesFactory.h"
+#include "common/gplcConstExprInterpreter.h"
+#include "common/gplcValues.h"
+#include "parser/gplcASTNodesFactory.h"
+#include "utils/Utils.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+
+namespace gplc
+{
+	/*!
+		\brief The file consists of the header and the body. The header contains TModuleInterfaceInfo, the body
+		contains an offset of the module's scope, offsets of types' records, the records and the scope itself.
+		A hash of the body is the interface's hash
+	*/
+
+	static const U32 InterfaceSignature     = 0x494c5047; // "GPLI"
+
+	static const U32 InterfaceFormatVersion = 3;
+
+	static const U32 InvalidTypeIndex       = (std::numeric_limits<U32>::max)();
+
+
+	enum E_SYMBOL_FLAGS : U8
+	{
+		SF_IS_REASSIGNED = 0x1,
+		SF_HAS_VALUE     = 0x2,
+		SF_IS_CONSTANT   = 0x4,
+	};
+
+
+	template <typename T>
+	static void WriteValue(std::vector<U8>& output, T value)
+	{
+		const U8* pValueBytes = reinterpret_cast<const U8*>(&value);
+
+		output.insert(output.end(), pValueBytes, pValueBytes + sizeof(T));
+	}
+
+	static void WriteString(std::vector<U8>& output, const std::string& value)
+	{
+		WriteValue<U32>(output, static_cast<U32>(value.size()));
+
+		output.insert(output.end(), value.cbegin(), value.cend());
+	}
+
+
+	/*!
+		\brief A value is written as its type, an index of an alternative of TConstValue::mValue and 8 bytes of the alternative
+	*/
+
+	static void WriteConstValue(std::vector<U8>& output, const TConstValue& value)
+	{
+		U64 data = 0;
+
+		std::visit([&data](auto currValue)
+		{
+			memcpy(&data, &currValue, sizeof(currValue));
+		}, value.mValue);
+
+		WriteValue<U32>(output, value.mType);
+		WriteValue<U8>(output, static_cast<U8>(value.mValue.index()));
+		WriteValue<U64>(output, data);
+	}
+
+	/*!
+		\brief The function checks up whether the expression is null literal, possibly wrapped into TT_DEFAULT unary expressions
+	*/
+
+	static bool IsNullPointerLiteral(CASTNode* pNode)
+	{
+		for (auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode); pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT; )
+		{
+			pNode      = pUnaryExpr->GetData();
+			pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode);
+		}
+
+		auto pLiteral = dynamic_cast<CASTLiteralNode*>(pNode);
+
+		return pLiteral && pLiteral->GetValue()->GetType() == LT_POINTER;
+	}
+
+
+	/*!
+		\brief The class reads values from a mapped file, all reads are checked up against the file's bounds
+	*/
+
+	class CBinaryReader
+	{
+		public:
+			CBinaryReader(const llvm::MemoryBuffer* pBuffer, U64 offset):
+				mpData(reinterpret_cast<const U8*>(pBuffer->getBufferStart())), mSize(pBuffer->getBufferSize()), mOffset(offset)
+			{
+			}
+
+			template <typename T>
+			bool Read(T& value)
+			{
+				if (mOffset + sizeof(T) > mSize)
+				{
+					return false;
+				}
+
+				memcpy(&value, mpData + mOffset, sizeof(T));
+
+				mOffset += sizeof(T);
+
+				return true;
+			}
+
+			bool Read(std::string& value)
+			{
+				U32 length = 0;
+
+				if (!Read(length) || mOffset + length > mSize)
+				{
+					return false;
+				}
+
+				value.assign(reinterpret_cast<const C8*>(mpData + mOffset), length);
+
+				mOffset += length;
+
+				return true;
+			}
+
+			bool Read(TConstValue& value)
+			{
+				U32 type  = 0;
+				U8  index = 0;
+				U64 data  = 0;
+
+				if (!Read(type) || !Read(index) || !Read(data) || type >= CT_LAST)
+				{
+					return false;
+				}
+
+				value.mType = static_cast<E_COMPILER_TYPES>(type);
+
+				switch (index)
+				{
+					case 0:
+						value.mValue = static_cast<I64>(data);
+						return true;
+					case 1:
+						value.mValue = data;
+						return true;
+					case 2:
+						{
+							F64 floatValue = 0.0;
+
+							memcpy(&floatValue, &data, sizeof(floatValue));
+
+							value.mValue = floatValue;
+						}
+						return true;
+					case 3:
+						value.mValue = (data != 0);
+						return true;
+				}
+
+				return false;
+			}
+
+			U64 GetOffset() const
+			{
+				return mOffset;
+			}
+
+			U64 GetSize() const
+			{
+				return mSize;
+			}
+		private:
+			const U8* mpData;
+
+			U64       mSize;
+
+			U64       mOffset;
+	};
+
+
+	/*!
+		\brief CModuleInterfaceWriter's definition
+	*/
+
+	Result CModuleInterfaceWriter::Write(ISymTable* pSymTable, IConstExprInterpreter* pInterpreter, const std::string& moduleName, TModuleInterfaceInfo& info,
+										 TBytesArray& output)
+	{
+		if (!pSymTable || !pInterpreter)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		auto pModuleScope = pSymTable->LookUpNamedScope(moduleName);
+
+		if (!pModuleScope)
+		{
+			return RV_FAIL;
+		}
+
+		mpSymTable    = pSymTable;
+		mpInterpreter = pInterpreter;
+		mModuleName   = moduleName;
+
+		mTypesIndices.clear();
+		mTypesRecords.clear();
+
+		Result result = RV_SUCCESS;
+
+		TBytesArray scopeData;
+
+		// \note enumerators are evaluated relative to the module's scope
+		if (!SUCCESS(pSymTable->VisitNamedScopeWithRestore(moduleName, [this, pModuleScope, &moduleName, &scopeData, &result](ISymTable* pSymTable)
+			{
+				result = _writeScope(pModuleScope, moduleName, scopeData);
+			})) || !SUCCESS(result))
+		{
+			return SUCCESS(result) ? RV_FAIL : result;
+		}
+
+		// \note the body is assembled when all types which are reachable from the module's symbols are collected
+		TBytesArray body;
+
+		U32 currOffset = static_cast<U32>(2 * sizeof(U32) + mTypesRecords.size() * sizeof(U32));
+
+		TBytesArray typesOffsets;
+
+		for (const TBytesArray& currRecord : mTypesRecords)
+		{
+			WriteValue<U32>(typesOffsets, currOffset);
+
+			currOffset += static_cast<U32>(currRecord.size());
+		}
+
+		WriteValue<U32>(body, currOffset); // offset of the module's scope
+		WriteValue<U32>(body, static_cast<U32>(mTypesRecords.size()));
+
+		body.insert(body.end(), typesOffsets.cbegin(), typesOffsets.cend());
+
+		for (const TBytesArray& currRecord : mTypesRecords)
+		{
+			body.insert(body.end(), currRecord.cbegin(), currRecord.cend());
+		}
+
+		body.insert(body.end(), scopeData.cbegin(), scopeData.cend());
+
+		info.mInterfaceHash = CDigestBuilder().Append(body.data(), body.size()).GetDigest();
+
+		output.clear();
+
+		WriteValue<U32>(output, InterfaceSignature);
+		WriteValue<U32>(output, InterfaceFormatVersion);
+		WriteValue<U64>(output, info.mSourceSize);
+		WriteValue<I64>(output, info.mSourceModificationTime);
+		WriteString(output, info.mCodeKey);
+		WriteString(output, info.mBuildOptions);
+		WriteString(output, info.mInterfaceHash);
+		WriteValue<U32>(output, static_cast<U32>(info.mImports.size()));
+
+		for (const TModuleInterfaceInfo::TImportInfo& currImport : info.mImports)
+		{
+			WriteString(output, currImport.mModulePath);
+			WriteString(output, currImport.mModuleName);
+			WriteString(output, currImport.mInterfaceHash);
+		}
+
+		output.insert(output.end(), body.cbegin(), body.cend());
+
+		return RV_SUCCESS;
+	}
+
+	template <typename TScopeEntry>
+	Result CModuleInterfaceWriter::_writeScope(const TScopeEntry* pScopeEntry, const std::string& scopeName, TBytesArray& output)
+	{
+		// \note names are sorted, so the same declarations always give the same bytes and the same hash
+		std::vector<std::pair<std::string, TSymbolHandle>> variables;
+
+		for (auto& currVariable : pScopeEntry->mVariables)
+		{
+			const TSymbolDesc* pSymbolDesc = mpSymTable->LookUp(currVariable.second);
+
+			// \note the code generator registers constructors of structures within their scopes without types, they aren't declarations
+			if (pSymbolDesc && !pSymbolDesc->mpType && !pSymbolDesc->mpValue)
+			{
+				continue;
+			}
+
+			variables.emplace_back(currVariable.first, currVariable.second);
+		}
+
+		std::sort(variables.begin(), variables.end());
+
+		std::unordered_map<TSymbolHandle, TConstValue> constantValues;
+
+		const E_COMPILER_TYPES scopeType = pScopeEntry->mpType ? pScopeEntry->mpType->GetType() : CT_LAST;
+
+		// \note enumerators can refer to each other, so they're evaluated within the enumeration's scope. Defaults of structures' fields
+		// are written too, because an importer initializes structures with constant defaults without their constructors
+		if (scopeType == CT_ENUM || scopeType == CT_STRUCT)
+		{
+			Result result = RV_SUCCESS;
+
+			mpSymTable->VisitNamedScopeWithRestore(scopeName, [this, scopeType, &variables, &constantValues, &result](ISymTable* pSymTable)
+			{
+				for (auto& currVariable : variables)
+				{
+					CASTExpressionNode* pValue = pSymTable->LookUp(currVariable.second)->mpValue;
+
+					if (scopeType == CT_STRUCT && IsNullPointerLiteral(pValue))
+					{
+						constantValues[currVariable.second] = { CT_POINTER, static_cast<U64>(0) };
+
+						continue;
+					}
+
+					auto evaluatedValue = mpInterpreter->EvalValue(pValue, pSymTable);
+
+					if (!evaluatedValue.HasError())
+					{
+						constantValues[currVariable.second] = evaluatedValue.Get();
+
+						continue;
+					}
+
+					// \note a field whose default is computed in runtime has no value within the interface, the module defines a constructor then
+					if (scopeType == CT_ENUM)
+					{
+						result = RV_FAIL;
+
+						return;
+					}
+				}
+			});
+
+			if (!SUCCESS(result))
+			{
+				return result;
+			}
+		}
+
+		WriteValue<U32>(output, static_cast<U32>(variables.size()));
+
+		for (auto& currVariable : variables)
+		{
+			const TSymbolDesc* pSymbolDesc = mpSymTable->LookUp(currVariable.second);
+
+			if (!pSymbolDesc || !pSymbolDesc->mpType)
+			{
+				return RV_FAIL;
+			}
+
+			auto valueIter = constantValues.find(currVariable.second);
+
+			const bool hasValue = (valueIter != constantValues.cend());
+
+			WriteString(output, currVariable.first);
+			WriteValue<U32>(output, _getTypeIndex(pSymbolDesc->mpType));
+			WriteValue<U8>(output, (pSymbolDesc->mIsReassigned ? SF_IS_REASSIGNED : 0x0) | (hasValue ? SF_HAS_VALUE : 0x0) | (pSymbolDesc->mIsConstant ? SF_IS_CONSTANT : 0x0));
+
+			if (hasValue)
+			{
+				WriteConstValue(output, valueIter->second);
+			}
+		}
+
+		// \note imported modules aren't a part of the interface, an importer resolves them by itself
+		std::vector<std::pair<std::string, decltype(pScopeEntry->mNamedScopes.cbegin()->second)>> namedScopes;
+
+		for (auto& currNamedScope : pScopeEntry->mNamedScopes)
+		{
+			if (!currNamedScope.second->mpType || currNamedScope.second->mpType->GetType() != CT_MODULE)
+			{
+				namedScopes.emplace_back(currNamedScope.first, currNamedScope.second);
+			}
+		}
+
+		std::sort(namedScopes.begin(), namedScopes.end(), [](const auto& left, const auto& right)
+		{
+			return left.first < right.first;
+		});
+
+		WriteValue<U32>(output, static_cast<U32>(namedScopes.size()));
+
+		Result result = RV_SUCCESS;
+
+		TBytesArray nestedScopeData;
+
+		for (auto& currNamedScope : namedScopes)
+		{
+			WriteString(output, currNamedScope.first);
+			WriteValue<U32>(output, _getTypeIndex(currNamedScope.second->mpType));
+
+			nestedScopeData.clear();
+
+			if (!SUCCESS(result = _writeScope(currNamedScope.second, currNamedScope.first, nestedScopeData)))
+			{
+				return result;
+			}
+
+			// \note the size allows a reader to skip the scope until it's requested
+			WriteValue<U32>(output, static_cast<U32>(nestedScopeData.size()));
+
+			output.insert(output.end(), nestedScopeData.cbegin(), nestedScopeData.cend());
+		}
+
+		return RV_SUCCESS;
+	}
+
+	U32 CModuleInterfaceWriter::_getTypeIndex(const CType* pType)
+	{
+		if (!pType)
+		{
+			return InvalidTypeIndex;
+		}
+
+		auto iter = mTypesIndices.find(pType);
+
+		if (iter != mTypesIndices.cend())
+		{
+			return iter->second;
+		}
+
+		// \note the index is assigned before nested types are visited, so references between types can't make the writer loop
+		const U32 typeIndex = static_cast<U32>(mTypesRecords.size());
+
+		mTypesIndices[pType] = typeIndex;
+		mTypesRecords.emplace_back();
+
+		TBytesArray record;
+
+		// \note named types are stored by their names, they're resolved within an importer's table
+		if (dynamic_cast<const CDependentNamedType*>(pType))
+		{
+			WriteValue<U32>(record, CT_ALIAS);
+			WriteString(record, pType->GetName());
+
+			mTypesRecords[typeIndex] = std::move(record);
+
+			return typeIndex;
+		}
+
+		const E_COMPILER_TYPES type = pType->GetType();
+
+		WriteValue<U32>(record, type);
+		WriteString(record, pType->GetName());
+
+		// \note a parent of a module is the module which has imported it first, it doesn't belong to the interface
+		if (type == CT_MODULE)
+		{
+			mTypesRecords[typeIndex] = std::move(record);
+
+			return typeIndex;
+		}
+
+		WriteValue<U32>(record, pType->GetSize());
+		WriteValue<U32>(record, pType->GetAttributes());
+		WriteValue<U32>(record, _getTypeIndex(pType->GetParent()));
+
+		switch (type)
+		{
+			case CT_POINTER:
+				WriteValue<U32>(record, _getTypeIndex(dynamic_cast<const CPointerType*>(pType)->GetBaseType()));
+				break;
+			case CT_ARRAY:
+				{
+					auto pArrayType = dynamic_cast<const CArrayType*>(pType);
+
+					WriteValue<U32>(record, _getTypeIndex(pArrayType->GetBaseType()));
+					WriteValue<U32>(record, pArrayType->GetElementsCount());
+				}
+				break;
+			case CT_STRUCT:
+				{
+					auto& fields = dynamic_cast<const CStructType*>(pType)->GetFieldsTypes();
+
+					WriteValue<U32>(record, static_cast<U32>(fields.size()));
+
+					for (auto& currField : fields)
+					{
+						WriteString(record, currField.first);
+						WriteValue<U32>(record, _getTypeIndex(currField.second));
+					}
+				}
+				break;
+			case CT_FUNCTION:
+				{
+					auto pFunctionType = dynamic_cast<const CFunctionType*>(pType);
+
+					auto& args = pFunctionType->GetArgsTypes();
+
+					WriteValue<U32>(record, static_cast<U32>(args.size()));
+
+					for (auto& currArg : args)
+					{
+						WriteString(record, currArg.first);
+						WriteValue<U32>(record, _getTypeIndex(currArg.second));
+					}
+
+					WriteValue<U32>(record, _getTypeIndex(pFunctionType->GetReturnValueType()));
+				}
+				break;
+			case CT_VARIANT:
+				{
+					auto& altTypes = dynamic_cast<const CVariantType*>(pType)->GetFieldsTypes();
+
+					WriteValue<U32>(record, static_cast<U32>(altTypes.size()));
+
+					for (auto pCurrAltType : altTypes)
+					{
+						WriteValue<U32>(record, _getTypeIndex(pCurrAltType));
+					}
+				}
+				break;
+			default:
+				// \note built-in types and enumerations are fully described by the common part of the record
+				break;
+		}
+
+		mTypesRecords[typeIndex] = std::move(record);
+
+		return typeIndex;
+	}
+
+
+	/*!
+		\brief CModuleInterfaceReader's definition
+	*/
+
+	CModuleInterfaceReader::CModuleInterfaceReader():
+		mBodyOffset(0), mpSymTable(nullptr), mpTypesFactory(nullptr), mpNodesFactory(nullptr)
+	{
+	}
+
+	CModuleInterfaceReader::~CModuleInterfaceReader()
+	{
+	}
+
+	Result CModuleInterfaceReader::Open(const std::string& filename)
+	{
+		// \note large files are memory mapped by LLVM, so only pages which are actually read are loaded
+		auto bufferOrError = llvm::MemoryBuffer::getFile(filename);
+
+		if (!bufferOrError)
+		{
+			return RV_FILE_NOT_FOUND;
+		}
+
+		mpBuffer = std::move(bufferOrError.get());
+
+		return _readHeader();
+	}
+
+	Result CModuleInterfaceReader::Open(const TBytesArray& data)
+	{
+		mpBuffer = llvm::MemoryBuffer::getMemBufferCopy(llvm::StringRef(reinterpret_cast<const C8*>(data.data()), data.size()));
+
+		return _readHeader();
+	}
+
+	const TModuleInterfaceInfo& CModuleInterfaceReader::GetInfo() const
+	{
+		return mInfo;
+	}
+
+	Result CModuleInterfaceReader::Load(ISymTable* pSymTable, ITypesFactory* pTypesFactory, IASTNodesFactory* pNodesFactory)
+	{
+		if (!pSymTable || !pTypesFactory || !pNodesFactory)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		if (!mpBuffer)
+		{
+			return RV_FAIL;
+		}
+
+		mpSymTable     = pSymTable;
+		mpTypesFactory = pTypesFactory;
+		mpNodesFactory = pNodesFactory;
+
+		mTypes.assign(mTypesOffsets.size(), nullptr);
+		mTypesStates.assign(mTypesOffsets.size(), TS_NOT_DECODED);
+
+		CBinaryReader reader(mpBuffer.get(), mBodyOffset);
+
+		U32 scopeOffset = 0;
+
+		if (!reader.Read(scopeOffset))
+		{
+			return RV_FAIL;
+		}
+
+		Result result = RV_SUCCESS;
+
+		if (!SUCCESS(result = _indexScope(mBodyOffset + scopeOffset)))
+		{
+			return result;
+		}
+
+		return mpSymTable->SetLazySymbolsLoader([this](ISymTable* pSymTable, const std::string& name)
+		{
+			return _loadSymbol(name);
+		});
+	}
+
+	Result CModuleInterfaceReader::_readHeader()
+	{
+		CBinaryReader reader(mpBuffer.get(), 0);
+
+		U32 signature     = 0;
+		U32 formatVersion = 0;
+		U32 importsCount  = 0;
+
+		mInfo = {};
+
+		if (!reader.Read(signature) || signature != InterfaceSignature ||
+			!reader.Read(formatVersion) || formatVersion != InterfaceFormatVersion ||
+			!reader.Read(mInfo.mSourceSize) || !reader.Read(mInfo.mSourceModificationTime) ||
+			!reader.Read(mInfo.mCodeKey) || !reader.Read(mInfo.mBuildOptions) || !reader.Read(mInfo.mInterfaceHash) || !reader.Read(importsCount))
+		{
+			return RV_FAIL;
+		}
+
+		TModuleInterfaceInfo::TImportInfo currImport;
+
+		for (U32 i = 0; i < importsCount; ++i)
+		{
+			if (!reader.Read(currImport.mModulePath) || !reader.Read(currImport.mModuleName) || !reader.Read(currImport.mInterfaceHash))
+			{
+				return RV_FAIL;
+			}
+
+			mInfo.mImports.push_back(currImport);
+		}
+
+		mBodyOffset = reader.GetOffset();
+
+		U32 scopeOffset = 0;
+		U32 typesCount  = 0;
+
+		if (!reader.Read(scopeOffset) || !reader.Read(typesCount) || mBodyOffset + scopeOffset > reader.GetSize())
+		{
+			return RV_FAIL;
+		}
+
+		mTypesOffsets.resize(typesCount);
+
+		for (U32& currTypeOffset : mTypesOffsets)
+		{
+			if (!reader.Read(currTypeOffset))
+			{
+				return RV_FAIL;
+			}
+		}
+
+		return RV_SUCCESS;
+	}
+
+	Result CModuleInterfaceReader::_indexScope(U64 offset)
+	{
+		CBinaryReader reader(mpBuffer.get(), offset);
+
+		mVariablesOffsets.clear();
+		mNamedScopesOffsets.clear();
+
+		U32 count = 0;
+
+		if (!reader.Read(count))
+		{
+			return RV_FAIL;
+		}
+
+		std::string currName;
+
+		U32 currTypeIndex  = 0;
+		U32 currScopeSize  = 0;
+
+		U8 currFlags = 0x0;
+
+		TConstValue currValue;
+
+		for (U32 i = 0; i < count; ++i)
+		{
+			const U64 currOffset = reader.GetOffset();
+
+			if (!reader.Read(currName) || !reader.Read(currTypeIndex) || !reader.Read(currFlags) ||
+				((currFlags & SF_HAS_VALUE) && !reader.Read(currValue)))
+			{
+				return RV_FAIL;
+			}
+
+			mVariablesOffsets[currName] = currOffset;
+		}
+
+		if (!reader.Read(count))
+		{
+			return RV_FAIL;
+		}
+
+		for (U32 i = 0; i < count; ++i)
+		{
+			const U64 currOffset = reader.GetOffset();
+
+			if (!reader.Read(currName) || !reader.Read(currTypeIndex) || !reader.Read(currScopeSize) ||
+				reader.GetOffset() + currScopeSize > reader.GetSize())
+			{
+				return RV_FAIL;
+			}
+
+			mNamedScopesOffsets[currName] = currOffset;
+
+			reader = CBinaryReader(mpBuffer.get(), reader.GetOffset() + currScopeSize);
+		}
+
+		return RV_SUCCESS;
+	}
+
+	Result CModuleInterfaceReader::_loadSymbol(const std::string& name)
+	{
+		U64 offset = 0;
+
+		auto variableIter = mVariablesOffsets.find(name);
+
+		if (variableIter != mVariablesOffsets.cend())
+		{
+			offset = variableIter->second;
+
+			// \note the entry is removed first, so a failed symbol isn't loaded again on every lookup
+			mVariablesOffsets.erase(variableIter);
+
+			return _loadVariable(offset);
+		}
+
+		auto namedScopeIter = mNamedScopesOffsets.find(name);
+
+		if (namedScopeIter != mNamedScopesOffsets.cend())
+		{
+			offset = namedScopeIter->second;
+
+			mNamedScopesOffsets.erase(namedScopeIter);
+
+			return _loadNamedScope(offset);
+		}
+
+		return RV_FAIL;
+	}
+
+	Result CModuleInterfaceReader::_loadScope(U64& offset)
+	{
+		CBinaryReader reader(mpBuffer.get(), offset);
+
+		U32 count = 0;
+
+		if (!reader.Read(count))
+		{
+			return RV_FAIL;
+		}
+
+		offset = reader.GetOffset();
+
+		Result result = RV_SUCCESS;
+
+		for (U32 i = 0; i < count; ++i)
+		{
+			if (!SUCCESS(result = _loadVariable(offset)))
+			{
+				return result;
+			}
+		}
+
+		reader = CBinaryReader(mpBuffer.get(), offset);
+
+		if (!reader.Read(count))
+		{
+			return RV_FAIL;
+		}
+
+		offset = reader.GetOffset();
+
+		for (U32 i = 0; i < count; ++i)
+		{
+			if (!SUCCESS(result = _loadNamedScope(offset)))
+			{
+				return result;
+			}
+		}
+
+		return RV_SUCCESS;
+	}
+
+	Result CModuleInterfaceReader::_loadVariable(U64& offset)
+	{
+		CBinaryReader reader(mpBuffer.get(), offset);
+
+		std::string name;
+
+		U32 typeIndex = 0;
+
+		U8 flags = 0x0;
+
+		TConstValue value;
+
+		if (!reader.Read(name) || !reader.Read(typeIndex) || !reader.Read(flags) || ((flags & SF_HAS_VALUE) && !reader.Read(value)))
+		{
+			return RV_FAIL;
+		}
+
+		offset = reader.GetOffset();
+
+		CType* pType = _getType(typeIndex);
+
+		if (!pType)
+		{
+			return RV_FAIL;
+		}
+
+		CASTExpressionNode* pValue = (flags & SF_HAS_VALUE) ? mpNodesFactory->CreateUnaryExpr(TT_DEFAULT, mpNodesFactory->CreateLiteralNode(_createLiteralValue(value))) : nullptr;
+
+		TSymbolHandle symbolHandle = mpSymTable->AddVariable({ name, pValue, pType });
+
+		if (symbolHandle == InvalidSymbolHandle)
+		{
+			return RV_FAIL;
+		}
+
+		TSymbolDesc* pSymbolDesc = mpSymTable->LookUp(symbolHandle);
+
+		pSymbolDesc->mIsReassigned = (flags & SF_IS_REASSIGNED);
+		pSymbolDesc->mIsConstant   = (flags & SF_IS_CONSTANT);
+
+		return RV_SUCCESS;
+	}
+
+	Result CModuleInterfaceReader::_loadNamedScope(U64& offset)
+	{
+		CBinaryReader reader(mpBuffer.get(), offset);
+
+		std::string name;
+
+		U32 typeIndex = 0;
+		U32 scopeSize = 0;
+
+		if (!reader.Read(name) || !reader.Read(typeIndex) || !reader.Read(scopeSize) || !SUCCESS(mpSymTable->CreateNamedScope(name)))
+		{
+			return RV_FAIL;
+		}
+
+		offset = reader.GetOffset();
+
+		Result result = _loadScope(offset);
+
+		mpSymTable->LeaveScope();
+
+		if (!SUCCESS(result))
+		{
+			return result;
+		}
+
+		// \note types of named scopes like enumerations refer to their scopes, so they're created after them
+		mpSymTable->LookUpNamedScope(name)->mpType = (typeIndex != InvalidTypeIndex) ? _getType(typeIndex) : nullptr;
+
+		return RV_SUCCESS;
+	}
+
+	CBaseValue* CModuleInterfaceReader::_createLiteralValue(const TConstValue& value) const
+	{
+		if (value.mType == CT_POINTER)
+		{
+			return new CPointerValue();
+		}
+
+		if (const I64* pIntValue = std::get_if<I64>(&value.mValue))
+		{
+			return new CIntValue(*pIntValue, value.mType == CT_INT64);
+		}
+
+		if (const U64* pUIntValue = std::get_if<U64>(&value.mValue))
+		{
+			return new CUIntValue(*pUIntValue, value.mType == CT_UINT64);
+		}
+
+		if (const F64* pFloatValue = std::get_if<F64>(&value.mValue))
+		{
+			return (value.mType == CT_FLOAT) ? static_cast<CBaseValue*>(new CFloatValue(static_cast<F32>(*pFloatValue))) : new CDoubleValue(*pFloatValue);
+		}
+
+		return new CBoolValue(std::get<bool>(value.mValue));
+	}
+
+	CType* CModuleInterfaceReader::_getType(U32 index)
+	{
+		if (index >= mTypesOffsets.size())
+		{
+			return nullptr;
+		}
+
+		switch (mTypesStates[index])
+		{
+			case TS_DECODED:
+				return mTypes[index];
+			case TS_DECODING:
+				return nullptr; // \note a malformed file, types can't contain themselves
+			default:
+				break;
+		}
+
+		mTypesStates[index] = TS_DECODING;
+
+		mTypes[index] = _decodeType(mBodyOffset + mTypesOffsets[index]);
+
+		mTypesStates[index] = TS_DECODED;
+
+		return mTypes[index];
+	}
+
+	CType* CModuleInterfaceReader::_decodeType(U64 offset)
+	{
+		CBinaryReader reader(mpBuffer.get(), offset);
+
+		U32 type = 0;
+
+		std::string name;
+
+		if (!reader.Read(type) || !reader.Read(name))
+		{
+			return nullptr;
+		}
+
+		if (type == CT_ALIAS)
+		{
+			return mpTypesFactory->CreateDependentNamedType(mpSymTable, name);
+		}
+
+		if (type == CT_MODULE)
+		{
+			CType* pCurrScopeType = mpSymTable->GetCurrentScopeType();
+
+			// \note types of the module refer to the module's type which already exists in the importer's table
+			while (pCurrScopeType && pCurrScopeType->GetType() != CT_MODULE)
+			{
+				pCurrScopeType = pCurrScopeType->GetParent();
+			}
+
+			return (pCurrScopeType && pCurrScopeType->GetName() == name) ? pCurrScopeType : mpTypesFactory->CreateModuleType(name);
+		}
+
+		U32 size        = 0;
+		U32 attributes  = 0x0;
+		U32 parentIndex = InvalidTypeIndex;
+
+		if (!reader.Read(size) || !reader.Read(attributes) || !reader.Read(parentIndex))
+		{
+			return nullptr;
+		}
+
+		CType* pParentType = (parentIndex != InvalidTypeIndex) ? _getType(parentIndex) : nullptr;
+
+		CType* pType = nullptr;
+
+		U32 currIndex = InvalidTypeIndex;
+
+		U32 count = 0;
+
+		std::string currName;
+
+		switch (type)
+		{
+			case CT_POINTER:
+				if (!reader.Read(currIndex))
+				{
+					return nullptr;
+				}
+
+				pType = mpTypesFactory->CreatePointerType((currIndex != InvalidTypeIndex) ? _getType(currIndex) : nullptr, pParentType);
+				break;
+			case CT_ARRAY:
+				{
+					if (!reader.Read(currIndex) || !reader.Read(count))
+					{
+						return nullptr;
+					}
+
+					CType* pBaseType = _getType(currIndex);
+
+					if (!pBaseType)
+					{
+						return nullptr;
+					}
+
+					pType = mpTypesFactory->CreateArrayType(pBaseType, count, attributes, pParentType);
+				}
+				break;
+			case CT_STRUCT:
+			case CT_FUNCTION:
+				{
+					ITypesFactory::TSubTypesArray subTypes;
+
+					if (!reader.Read(count))
+					{
+						return nullptr;
+					}
+
+					for (U32 i = 0; i < count; ++i)
+					{
+						if (!reader.Read(currName) || !reader.Read(currIndex))
+						{
+							return nullptr;
+						}
+
+						CType* pSubType = _getType(currIndex);
+
+						if (!pSubType)
+						{
+							return nullptr;
+						}
+
+						subTypes.push_back({ currName, pSubType });
+					}
+
+					if (type == CT_STRUCT)
+					{
+						pType = mpTypesFactory->CreateStructType(subTypes, attributes, pParentType);
+
+						break;
+					}
+
+					if (!reader.Read(currIndex))
+					{
+						return nullptr;
+					}
+
+					pType = mpTypesFactory->CreateFunctionType(subTypes, (currIndex != InvalidTypeIndex) ? _getType(currIndex) : nullptr, attributes, pParentType);
+				}
+				break;
+			case CT_VARIANT:
+				{
+					ITypesFactory::TTypesArray altTypes;
+
+					if (!reader.Read(count))
+					{
+						return nullptr;
+					}
+
+					for (U32 i = 0; i < count; ++i)
+					{
+						if (!reader.Read(currIndex) || !_getType(currIndex))
+						{
+							return nullptr;
+						}
+
+						altTypes.push_back(_getType(currIndex));
+					}
+
+					pType = mpTypesFactory->CreateVariantType(altTypes, name, attributes, pParentType);
+				}
+				break;
+			case CT_ENUM:
+				pType = mpTypesFactory->CreateEnumType(mpSymTable, name, pParentType);
+				break;
+			default:
+				if (type >= CT_LAST)
+				{
+					return nullptr;
+				}
+
+				pType = mpTypesFactory->CreateType(static_cast<E_COMPILER_TYPES>(type), size, attributes, name, pParentType);
+				break;
+		}
+
+		// \note attributes and names can be changed after a type is created, e.g. AddVariable names function types
+		pType->ResetAttribute((std::numeric_limits<U32>::max)());
+		pType->SetAttribute(attributes);
+		pType->SetName(name);
+
+		return pType;
+	}
+}
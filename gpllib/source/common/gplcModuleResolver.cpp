@@ -2,11 +2,15 @@
 #include "common/gplcSymTable.h"
 #include "common/gplcTypesFactory.h"
 #include "common/gplcTypeSystem.h"
+#include "common/gplcModuleInterface.h"
 #include "parser/gplcASTNodes.h"
 #include "codegen/gplcLinker.h"
 #include <filesystem>
+#include <fstream>
+#include <memory>
 #include <vector>
 #include <algorithm>
+#include <random>
 #include <iostream>
 #include <cassert>
 
@@ -15,15 +19,27 @@ namespace gplc
 {
 	std::string CModuleResolver::mFileExtension { ".gpls" };
 
+	std::string CModuleResolver::mInterfaceFileExtension { ".gpli" };
+
+
+	static I64 GetFileModificationTime(const std::string& filename)
+	{
+		std::error_code errorCode;
+
+		auto time = std::filesystem::last_write_time(filename, errorCode);
+
+		return errorCode ? 0 : static_cast<I64>(time.time_since_epoch().count());
+	}
+
 	CModuleResolver::CModuleResolver():
 		mpCurrVisitingModule(&mRootModuleDeps)
 	{
 	}
 
-	Result CModuleResolver::Resolve(CASTSourceUnitNode* pModuleAST, ISymTable* pSymTable, ITypesFactory* pTypesFactory, const std::string& currentWorkinDir,
-									const TOnCompileCallback& onCompileModule)
+	Result CModuleResolver::Resolve(CASTSourceUnitNode* pModuleAST, ISymTable* pSymTable, ITypesFactory* pTypesFactory, IASTNodesFactory* pNodesFactory,
+									const std::string& currentWorkinDir, const TOnCompileCallback& onCompileModule, const TOnLoadCallback& onLoadModule)
 	{
-		if (!pModuleAST || !pSymTable || !pTypesFactory)
+		if (!pModuleAST || !pSymTable || !pTypesFactory || !pNodesFactory)
 		{
 			return RV_INVALID_ARGUMENTS;
 		}
@@ -32,13 +48,17 @@ namespace gplc
 
 		mpTypesFactory = pTypesFactory;
 
+		mpNodesFactory = pNodesFactory;
+
 		mCurrentWorkingDir = currentWorkinDir;
 
 		mOnCompileModuleCallback = onCompileModule;
 
+		mOnLoadModuleCallback = onLoadModule;
+
 		const std::string& currModuleName = pModuleAST->GetModuleName();
 
-		// if modules registry already contains information about the module exit
+		// if modules registry already contains information about the module it isn't registered again
 		auto iter = std::find_if(mModulesRegistry.begin(), mModulesRegistry.end(), [&currModuleName](const TCompiledModuleData& m)
 		{
 			return m.mModuleName == currModuleName;
@@ -46,7 +66,8 @@ namespace gplc
 
 		if (iter != mModulesRegistry.cend())
 		{
-			return RV_SUCCESS;
+			// \note the module is imported once again within another scope, so scopes of its own imports should be created there too
+			return _visitNode(pModuleAST);
 		}
 
 		ResolveModuleType(mpSymTable, mpTypesFactory, currModuleName);
@@ -54,9 +75,69 @@ namespace gplc
 		mModulesRegistry.push_back({ currModuleName, pModuleAST });
 
 		// push back a top level module
-		*mpCurrVisitingModule = { currModuleName, {} };
+		auto pPrevVisitingModule = mpCurrVisitingModule;
+		mpCurrVisitingModule = _pushTopLevelModule(currModuleName);
+
+		Result result = _visitNode(pModuleAST);
+
+		mpCurrVisitingModule = pPrevVisitingModule;
+
+		return result;
+	}
+
+	Result CModuleResolver::ResolveFromInterface(ISymTable* pSymTable, ITypesFactory* pTypesFactory, IASTNodesFactory* pNodesFactory, const std::string& currentWorkinDir,
+												 const std::string& sourceFilename, const std::string& moduleName, const TOnCompileCallback& onCompileModule,
+												 const TOnLoadCallback& onLoadModule)
+	{
+		if (!pSymTable || !pTypesFactory || !pNodesFactory || !onLoadModule)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		mpSymTable = pSymTable;
+
+		mpTypesFactory = pTypesFactory;
+
+		mpNodesFactory = pNodesFactory;
+
+		mCurrentWorkingDir = currentWorkinDir;
+
+		mOnCompileModuleCallback = onCompileModule;
+
+		mOnLoadModuleCallback = onLoadModule;
+
+		ResolveModuleType(mpSymTable, mpTypesFactory, moduleName);
+
+		auto pPrevVisitingModule = mpCurrVisitingModule;
+		mpCurrVisitingModule = _pushTopLevelModule(moduleName);
+
+		TLLVMIRData compiledModuleData;
+
+		Result result = _loadModuleInterface(sourceFilename, moduleName, compiledModuleData);
+
+		// \note the graph's entry is removed, because the module is going to be compiled from its source
+		if (!SUCCESS(result))
+		{
+			if (mpCurrVisitingModule == &mRootModuleDeps)
+			{
+				mRootModuleDeps = {};
+			}
+			else
+			{
+				mRootModuleDeps.mDependencies.pop_back();
+			}
+		}
+
+		mpCurrVisitingModule = pPrevVisitingModule;
+
+		if (!SUCCESS(result))
+		{
+			return result;
+		}
 
-		return _visitNode(pModuleAST);
+		mModulesRegistry.push_back({ moduleName, nullptr, std::move(compiledModuleData) });
+
+		return RV_SUCCESS;
 	}
 
 	void CModuleResolver::ResolveModuleType(ISymTable* pSymTable, ITypesFactory* pTypesFactory, const std::string& moduleName)
@@ -69,6 +150,87 @@ namespace gplc
 		}
 	}
 
+	Result CModuleResolver::TakeSourceStamp(const std::string& sourceFilename, TModuleInterfaceInfo& info) const
+	{
+		std::error_code errorCode;
+
+		info.mSourceSize             = static_cast<U64>(std::filesystem::file_size(sourceFilename, errorCode));
+		info.mSourceModificationTime = GetFileModificationTime(sourceFilename);
+
+		return errorCode ? RV_FILE_NOT_FOUND : RV_SUCCESS;
+	}
+
+	Result CModuleResolver::SaveModuleInterface(ISymTable* pSymTable, IConstExprInterpreter* pInterpreter, CASTSourceUnitNode* pModuleAST,
+												const std::string& sourceFilename, TModuleInterfaceInfo info, std::vector<U8>& interfaceData)
+	{
+		if (!pSymTable || !pInterpreter || !pModuleAST)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		info.mImports.clear();
+
+		for (auto pCurrChild : pModuleAST->GetChildren())
+		{
+			if (!pCurrChild || pCurrChild->GetType() != NT_IMPORT)
+			{
+				continue;
+			}
+
+			auto pImportNode = dynamic_cast<CASTImportDirectiveNode*>(pCurrChild);
+
+			auto iter = mInterfacesHashes.find(pImportNode->GetImportedModuleName());
+
+			// \note an empty hash never matches, so the module is recompiled if its import had no interface
+			info.mImports.push_back({ pImportNode->GetModulePath(), pImportNode->GetImportedModuleName(), (iter != mInterfacesHashes.cend()) ? iter->second : "" });
+		}
+
+		const std::string& moduleName = pModuleAST->GetModuleName();
+
+		std::unique_ptr<IModuleInterfaceWriter> pWriter { new CModuleInterfaceWriter() };
+
+		Result result = RV_SUCCESS;
+
+		if (!SUCCESS(result = pWriter->Write(pSymTable, pInterpreter, moduleName, info, interfaceData)))
+		{
+			return result;
+		}
+
+		mInterfacesHashes[moduleName] = info.mInterfaceHash;
+
+		const std::string interfaceFilename = std::filesystem::path(sourceFilename).replace_extension(mInterfaceFileExtension).string();
+
+		// \note write into a temporary file first, so importers compiled by other processes never read a partially written interface
+		const std::string tempInterfaceFilename = std::string(interfaceFilename).append(".").append(std::to_string(std::random_device{}())).append(".tmp");
+
+		{
+			std::ofstream interfaceFile(tempInterfaceFilename, std::ios::binary | std::ios::trunc);
+
+			if (!interfaceFile.write(reinterpret_cast<const C8*>(interfaceData.data()), interfaceData.size()))
+			{
+				interfaceFile.close();
+
+				std::error_code errorCode;
+				std::filesystem::remove(tempInterfaceFilename, errorCode);
+
+				return RV_FAIL;
+			}
+		}
+
+		std::error_code errorCode;
+
+		std::filesystem::rename(tempInterfaceFilename, interfaceFilename, errorCode);
+
+		if (errorCode)
+		{
+			std::filesystem::remove(tempInterfaceFilename, errorCode);
+
+			return RV_FAIL;
+		}
+
+		return RV_SUCCESS;
+	}
+
 	Result CModuleResolver::Link(const std::string& outputFilename, ILinker* pLinker, bool skipFinalLinking)
 	{
 		return pLinker->Link(outputFilename, mModulesRegistry, &mRootModuleDeps, true, skipFinalLinking);
@@ -84,6 +246,18 @@ namespace gplc
 		return (*iter);
 	}
 
+	const CModuleResolver::TModuleEntry& CModuleResolver::GetDependencyGraph() const
+	{
+		return mRootModuleDeps;
+	}
+
+	std::string CModuleResolver::GetModuleInterfaceHash(const std::string& moduleName) const
+	{
+		auto iter = mInterfacesHashes.find(moduleName);
+
+		return (iter != mInterfacesHashes.cend()) ? iter->second : "";
+	}
+
 	void CModuleResolver::DumpDependencyGraph() const
 	{
 		_printDependencyGraphLevel(&mRootModuleDeps);
@@ -104,6 +278,21 @@ namespace gplc
 		}
 	}
 
+	CModuleResolver::TModuleEntry* CModuleResolver::_pushTopLevelModule(const std::string& moduleName)
+	{
+		// \note the first input file is the main module, the rest ones are linked into it as its dependencies
+		if (mpCurrVisitingModule != &mRootModuleDeps || mRootModuleDeps.mModuleName.empty())
+		{
+			*mpCurrVisitingModule = { moduleName, {}, mpCurrVisitingModule->mModulePath };
+
+			return mpCurrVisitingModule;
+		}
+
+		mRootModuleDeps.mDependencies.push_back({ moduleName, {} });
+
+		return &mRootModuleDeps.mDependencies.back();
+	}
+
 	Result CModuleResolver::_visitNode(CASTNode* pNode)
 	{
 		Result result = RV_SUCCESS;
@@ -115,7 +304,16 @@ namespace gplc
 				continue;
 			}
 
-			result = (pCurrChild->GetType() == NT_IMPORT) ? _resolveImport(dynamic_cast<CASTImportDirectiveNode*>(pCurrChild)) : _visitNode(pCurrChild);
+			if (pCurrChild->GetType() == NT_IMPORT)
+			{
+				auto pImportNode = dynamic_cast<CASTImportDirectiveNode*>(pCurrChild);
+
+				result = _resolveImport(pImportNode->GetModulePath(), pImportNode->GetImportedModuleName());
+			}
+			else
+			{
+				result = _visitNode(pCurrChild);
+			}
 
 			if (!SUCCESS(result))
 			{
@@ -126,23 +324,21 @@ namespace gplc
 		return RV_SUCCESS;
 	}
 
-	Result CModuleResolver::_resolveImport(CASTImportDirectiveNode* pNode)
-	{		
-		std::string moduleFullPath = std::filesystem::path(mCurrentWorkingDir).append(std::string(pNode->GetModulePath()).append(mFileExtension)).string();
+	Result CModuleResolver::_resolveImport(const std::string& modulePath, const std::string& moduleName)
+	{
+		const std::string moduleFullPath = _getModuleFullPath(modulePath);
 
 		if (!std::filesystem::exists(moduleFullPath))
 		{
 			return RV_FILE_NOT_FOUND;
 		}
 
-		const std::string& moduleName = pNode->GetImportedModuleName();
-		
 		mpSymTable->CreateNamedScope(moduleName);
 
 		ResolveModuleType(mpSymTable, mpTypesFactory, moduleName);
 
 		// build dependencies graph
-		TModuleEntry currModuleEntry { moduleName, {} };
+		TModuleEntry currModuleEntry { moduleName, {}, moduleFullPath };
 
 		mpCurrVisitingModule->mDependencies.push_back(currModuleEntry);
 
@@ -153,7 +349,10 @@ namespace gplc
 
 		TLLVMIRData compiledModuleData;
 
-		if (!SUCCESS(result = mOnCompileModuleCallback(moduleFullPath, moduleName, compiledModuleData)))
+		// \note the module's source is parsed and analysed only if there is no up to date interface of it
+		const bool isInterfaceLoaded = SUCCESS(_loadModuleInterface(moduleFullPath, moduleName, compiledModuleData));
+
+		if (!isInterfaceLoaded && !SUCCESS(result = mOnCompileModuleCallback(moduleFullPath, moduleName, compiledModuleData)))
 		{
 			return result;
 		}
@@ -168,10 +367,98 @@ namespace gplc
 			return m.mModuleName == moduleName;
 		});
 
+		if (isInterfaceLoaded && currModuleIter == mModulesRegistry.cend())
+		{
+			mModulesRegistry.push_back({ moduleName, nullptr });
+
+			currModuleIter = mModulesRegistry.end() - 1;
+		}
+
 		assert(currModuleIter != mModulesRegistry.cend());
 
 		currModuleIter->mCompiledIRCode = std::move(compiledModuleData);
 
 		return RV_SUCCESS;
 	}
+
+	Result CModuleResolver::_loadModuleInterface(const std::string& moduleFullPath, const std::string& moduleName, TLLVMIRData& compiledModuleData)
+	{
+		if (!mOnLoadModuleCallback)
+		{
+			return RV_FAIL;
+		}
+
+		std::unique_ptr<IModuleInterfaceReader> pReader { new CModuleInterfaceReader() };
+
+		if (!_isInterfaceUpToDate(moduleFullPath, pReader.get()))
+		{
+			return RV_FAIL;
+		}
+
+		const TModuleInterfaceInfo& info = pReader->GetInfo();
+
+		Result result = RV_SUCCESS;
+
+		if (!SUCCESS(result = mOnLoadModuleCallback(moduleName, info, compiledModuleData)))
+		{
+			return result;
+		}
+
+		// \note imports of the module are resolved within its scope in the same way as when it's compiled from the source
+		for (const TModuleInterfaceInfo::TImportInfo& currImport : info.mImports)
+		{
+			if (!SUCCESS(result = _resolveImport(currImport.mModulePath, currImport.mModuleName)))
+			{
+				return result;
+			}
+		}
+
+		if (!SUCCESS(result = pReader->Load(mpSymTable, mpTypesFactory, mpNodesFactory)))
+		{
+			return result;
+		}
+
+		mInterfacesHashes[moduleName] = info.mInterfaceHash;
+
+		mInterfacesReaders.push_back(std::move(pReader));
+
+		return RV_SUCCESS;
+	}
+
+	bool CModuleResolver::_isInterfaceUpToDate(const std::string& moduleFullPath, IModuleInterfaceReader* pReader) const
+	{
+		if (!SUCCESS(pReader->Open(std::filesystem::path(moduleFullPath).replace_extension(mInterfaceFileExtension).string())))
+		{
+			return false;
+		}
+
+		const TModuleInterfaceInfo& info = pReader->GetInfo();
+
+		std::error_code errorCode;
+
+		if (static_cast<U64>(std::filesystem::file_size(moduleFullPath, errorCode)) != info.mSourceSize || errorCode ||
+			GetFileModificationTime(moduleFullPath) != info.mSourceModificationTime)
+		{
+			return false;
+		}
+
+		// \note changes of bodies of imported modules don't change their interfaces, so the module's code stays valid
+		for (const TModuleInterfaceInfo::TImportInfo& currImport : info.mImports)
+		{
+			std::unique_ptr<IModuleInterfaceReader> pImportReader { new CModuleInterfaceReader() };
+
+			if (!_isInterfaceUpToDate(_getModuleFullPath(currImport.mModulePath), pImportReader.get()) ||
+				pImportReader->GetInfo().mInterfaceHash != currImport.mInterfaceHash)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	std::string CModuleResolver::_getModuleFullPath(const std::string& modulePath) const
+	{
+		return std::filesystem::path(mCurrentWorkingDir).append(std::string(modulePath).append(mFileExtension)).string();
+	}
 }
\ No newline at end of file
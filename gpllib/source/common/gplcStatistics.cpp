@@ -0,0 +1,74 @@
+#include "common/gplcStatistics.h"
+#include <algorithm>
+#include <cstdio>
+
+
+namespace gplc
+{
+	bool CStatistics::mIsEnabled = false;
+
+	CStatistics::TCountersGroupsMap CStatistics::mCounters;
+
+
+	void CStatistics::SetEnabled(bool isEnabled)
+	{
+		mIsEnabled = isEnabled;
+	}
+
+	void CStatistics::Add(const std::string& group, const std::string& name, U64 value)
+	{
+		mCounters[group][name] += value;
+	}
+
+	void CStatistics::UpdateMax(const std::string& group, const std::string& name, U64 value)
+	{
+		U64& counter = mCounters[group][name];
+
+		counter = std::max(counter, value);
+	}
+
+	U64 CStatistics::GetValue(const std::string& group, const std::string& name)
+	{
+		auto groupIter = mCounters.find(group);
+
+		if (groupIter == mCounters.cend())
+		{
+			return 0;
+		}
+
+		auto counterIter = groupIter->second.find(name);
+
+		return (counterIter == groupIter->second.cend()) ? 0 : counterIter->second;
+	}
+
+	const CStatistics::TCountersGroupsMap& CStatistics::GetCounters()
+	{
+		return mCounters;
+	}
+
+	void CStatistics::Reset()
+	{
+		mCounters.clear();
+	}
+
+	std::string CStatistics::ToString()
+	{
+		std::string output("Statistics:\n");
+
+		C8 buffer[32];
+
+		for (const auto& currGroup : mCounters)
+		{
+			output.append("  ").append(currGroup.first).append("\n");
+
+			for (const auto& currCounter : currGroup.second)
+			{
+				std::snprintf(buffer, sizeof(buffer), "%14llu  ", currCounter.second);
+
+				output.append(buffer).append(currCounter.first).append("\n");
+			}
+		}
+
+		return output;
+	}
+}
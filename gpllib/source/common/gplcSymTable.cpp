@@ -9,6 +9,7 @@
 */
 
 #include "common/gplcSymTable.h"
+#include "common/gplcStatistics.h"
 #include "common/gplcTypeSystem.h"
 #include "common/gplcValues.h"
 #include <cassert>
@@ -157,7 +158,7 @@ namespace gplc
 
 		auto pCurrScope = mpCurrScopeEntry;
 		
-		while (pCurrScope && (pCurrScope->mNamedScopes.find(scopeName) == pCurrScope->mNamedScopes.cend()) && pCurrScope->mParentScope)
+		while (pCurrScope && !_findNamedScope(pCurrScope, scopeName) && pCurrScope->mParentScope)
 		{
 			pCurrScope = pCurrScope->mParentScope;
 		}
@@ -181,6 +182,9 @@ namespace gplc
 		auto pCurrScopeEntry = mpCurrScopeEntry;
 
 		I32 prevScopeIndex = mLastVisitedScopeIndex;
+		I32 prevNamedScopeIndex = mPrevVisitedScopeIndex;
+
+		const bool isReadMode = mIsReadMode;
 
 		Result result = VisitNamedScope(scopeName);
 
@@ -196,6 +200,41 @@ namespace gplc
 
 		mLastVisitedScopeIndex = prevScopeIndex;
 
+		// \note VisitNamedScope remembers a position within an unnamed scope, a stale one would be restored by LeaveScope later
+		mPrevVisitedScopeIndex = prevNamedScopeIndex;
+
+		// \note a scope which is being created should be left without moving to its neighbour, so the mode is restored too
+		mIsReadMode = isReadMode;
+
+		return RV_SUCCESS;
+	}
+
+	Result CSymTable::VisitScopeWithRestore(TScopeHandle scopeHandle, const ISymTable::TSymTableTransactionCallback& transaction)
+	{
+		if (mIsLocked || !scopeHandle)
+		{
+			return RV_FAIL;
+		}
+
+		auto pCurrScopeEntry = mpCurrScopeEntry;
+		auto pPrevScopeEntry = mpPrevScopeEntry;
+
+		I32 prevScopeIndex = mLastVisitedScopeIndex;
+		I32 prevNamedScopeIndex = mPrevVisitedScopeIndex;
+
+		// \note names which aren't found within the given scope shouldn't fall back into the current local one
+		mpCurrScopeEntry = const_cast<TSymTableEntry*>(scopeHandle);
+		mpPrevScopeEntry = mpCurrScopeEntry;
+
+		transaction(this);
+
+		// restore previous state
+		mpCurrScopeEntry = pCurrScopeEntry;
+		mpPrevScopeEntry = pPrevScopeEntry;
+
+		mLastVisitedScopeIndex = prevScopeIndex;
+		mPrevVisitedScopeIndex = prevNamedScopeIndex;
+
 		return RV_SUCCESS;
 	}
 
@@ -217,6 +256,37 @@ namespace gplc
 		return RV_SUCCESS;
 	}
 
+	Result CSymTable::RemoveScope()
+	{
+		if (mIsLocked || !mpCurrScopeEntry)
+		{
+			return RV_FAIL;
+		}
+
+		auto& nestedScopes = mpCurrScopeEntry->mNestedScopes;
+
+		U32 scopeIndex = static_cast<U32>(mLastVisitedScopeIndex + 1);
+
+		if (scopeIndex >= nestedScopes.size())
+		{
+			return RV_FAIL;
+		}
+
+		TSymTableEntry* pRemovedScope = nestedScopes[scopeIndex];
+
+		nestedScopes.erase(nestedScopes.begin() + scopeIndex);
+
+		_removeScope(&pRemovedScope);
+
+		// \note update indices of the following neighbours
+		for (U32 i = scopeIndex; i < nestedScopes.size(); ++i)
+		{
+			nestedScopes[i]->mScopeIndex = i;
+		}
+
+		return RV_SUCCESS;
+	}
+
 	Result CSymTable::LeaveScope()
 	{
 		if (mIsLocked || !mpCurrScopeEntry->mParentScope) //we stay in a global scope
@@ -282,6 +352,18 @@ namespace gplc
 		return symbolHandle;
 	}
 
+	Result CSymTable::SetLazySymbolsLoader(const TLazySymbolsLoader& loader)
+	{
+		if (mIsLocked || !mpCurrScopeEntry)
+		{
+			return RV_FAIL;
+		}
+
+		mpCurrScopeEntry->mLazySymbolsLoader = loader;
+
+		return RV_SUCCESS;
+	}
+
 	const TSymbolDesc* CSymTable::LookUp(const std::string& variableName) const
 	{
 		TSymbolHandle handle = _lookUp(mpCurrScopeEntry, RenameReservedIdentifier(variableName));
@@ -324,23 +406,9 @@ namespace gplc
 
 	CSymTable::TSymTableEntry* CSymTable::LookUpNamedScope(const std::string& scopeName) const
 	{
-		const TSymTableEntry* pCurrEntry = mpCurrScopeEntry;
+		TSymTableEntry* pCurrEntry = mpCurrScopeEntry;
 
-		auto findScope = [](const TSymTableEntry* pCurrEntry, const std::string& scopeName) -> TSymTableEntry*
-		{
-			auto& currNamedScopes = pCurrEntry->mNamedScopes;
-
-			auto iter = currNamedScopes.cbegin();
-
-			if ((iter = currNamedScopes.find(scopeName)) != currNamedScopes.cend())
-			{
-				return iter->second;
-			}
-
-			return nullptr;
-		};
-		
-		TSymTableEntry* pFoundResult = findScope(pCurrEntry, scopeName);
+		TSymTableEntry* pFoundResult = _findNamedScope(pCurrEntry, scopeName);
 
 		if (pFoundResult)
 		{
@@ -351,7 +419,7 @@ namespace gplc
 		{
 			pCurrEntry = pCurrEntry->mParentScope;
 			
-			if (pFoundResult = findScope(pCurrEntry, scopeName))
+			if (pFoundResult = _findNamedScope(pCurrEntry, scopeName))
 			{
 				return pFoundResult;
 			}
@@ -367,7 +435,7 @@ namespace gplc
 
 	TSymbolHandle CSymTable::GetSymbolHandleByName(const std::string& variable) const
 	{
-		auto handle = _lookUp(mpCurrScopeEntry, variable);
+		auto handle = _lookUp(mpCurrScopeEntry, RenameReservedIdentifier(variable));
 
 		/*! \note when we work with aggregate types such as structures or modules we need to go into their scopes.
 			This situation makes current local variables invisible for us from that point,
@@ -375,7 +443,7 @@ namespace gplc
 		*/
 		if ((handle == InvalidSymbolHandle) && (mpCurrScopeEntry->mScopeIndex < 0))
 		{
-			handle = _lookUp(mpPrevScopeEntry, variable);
+			handle = _lookUp(mpPrevScopeEntry, RenameReservedIdentifier(variable));
 		}
 
 		return handle;
@@ -410,6 +478,24 @@ namespace gplc
 		return pCurrentScope ? pCurrentScope->mpType : nullptr;
 	}
 
+	ISymTable::TScopeHandle CSymTable::GetCurrentScopeHandle() const
+	{
+		return mpCurrScopeEntry;
+	}
+
+	ISymTable::TScopeHandle CSymTable::GetSymbolScopeHandle(const std::string& variableName) const
+	{
+		TSymTableEntry* pFoundEntry = nullptr;
+
+		// \note the same rules as LookUp uses, including a fallback into a local scope for named ones
+		if ((_lookUp(mpCurrScopeEntry, RenameReservedIdentifier(variableName), &pFoundEntry) == InvalidSymbolHandle) && (mpCurrScopeEntry->mScopeIndex < 0))
+		{
+			_lookUp(mpPrevScopeEntry, RenameReservedIdentifier(variableName), &pFoundEntry);
+		}
+
+		return pFoundEntry;
+	}
+
 	void CSymTable::DumpScopesStructure() const
 	{
 		std::function<void(const TSymTableEntry*, const TSymTableEntry*, U32)> _printScopeInfo = 
@@ -457,40 +543,90 @@ namespace gplc
 		_printScopeInfo(mpGlobalScopeEntry, mpCurrScopeEntry, 0);
 	}
 
-	TSymbolHandle CSymTable::_lookUp(TSymTableEntry* entry, const std::string& variableName) const
+	TSymbolHandle CSymTable::_lookUp(TSymTableEntry* entry, const std::string& variableName, TSymTableEntry** ppFoundEntry) const
 	{
-		const TSymbolsMap& table = entry->mVariables;
-				
 		TSymbolsMap::const_iterator iter;
 
-		if ((iter = table.find(variableName)) != table.cend())
-		{
-			return iter->second;
-		}
-
-		//search in outter scopes
-		TSymTableEntry* pCurrSymTable = entry->mParentScope;
+		GPLC_STATISTIC_ADD("symtable", "lookups", 1);
 
-		TSymbolHandle currSymbolHandle = InvalidSymbolHandle;
+		U64 walkedScopesCount = 0;
 
-		while (pCurrSymTable)
+		// search in the given scope and then in outter ones
+		for (TSymTableEntry* pCurrEntry = entry; pCurrEntry; pCurrEntry = pCurrEntry->mParentScope)
 		{
-			const TSymbolsMap& currTable = pCurrSymTable->mVariables;
+			const TSymbolsMap& table = pCurrEntry->mVariables;
+
+			GPLC_STATISTIC_ADD("symtable", "walked scopes", 1);
+			GPLC_STATISTIC_MAX("symtable", "max walked scopes per lookup", ++walkedScopesCount);
 
-			for (auto& currVariable : currTable)
+			if (((iter = table.find(variableName)) != table.cend()) ||
+				(_materializeSymbol(pCurrEntry, variableName) && ((iter = table.find(variableName)) != table.cend())))
 			{
-				if (currSymbolHandle = _lookUp(pCurrSymTable, variableName))
+				if (ppFoundEntry)
 				{
-					return currSymbolHandle;
+					*ppFoundEntry = pCurrEntry;
 				}
-			}
 
-			pCurrSymTable = pCurrSymTable->mParentScope;
+				return iter->second;
+			}
 		}
 
 		return InvalidSymbolHandle;
 	}
 
+	CSymTable::TSymTableEntry* CSymTable::_findNamedScope(TSymTableEntry* pEntry, const std::string& scopeName) const
+	{
+		const TNamedScopesMap& namedScopes = pEntry->mNamedScopes;
+
+		auto iter = namedScopes.find(scopeName);
+
+		if (iter != namedScopes.cend())
+		{
+			return iter->second;
+		}
+
+		if (_materializeSymbol(pEntry, scopeName) && ((iter = namedScopes.find(scopeName)) != namedScopes.cend()))
+		{
+			return iter->second;
+		}
+
+		return nullptr;
+	}
+
+	bool CSymTable::_materializeSymbol(TSymTableEntry* pEntry, const std::string& name) const
+	{
+		if (!pEntry->mLazySymbolsLoader)
+		{
+			return false;
+		}
+
+		// \note lookups don't change the visible state of the table, so a symbol is declared as if the scope was the current one
+		CSymTable* pThis = const_cast<CSymTable*>(this);
+
+		TSymTableEntry* pCurrScopeEntry = mpCurrScopeEntry;
+		TSymTableEntry* pPrevScopeEntry = mpPrevScopeEntry;
+
+		const bool isLocked   = mIsLocked;
+		const bool isReadMode = mIsReadMode;
+
+		const I32 lastVisitedScopeIndex = mLastVisitedScopeIndex;
+		const I32 prevVisitedScopeIndex = mPrevVisitedScopeIndex;
+
+		pThis->mpCurrScopeEntry = pEntry;
+		pThis->mIsLocked        = false;
+
+		const bool isDeclared = SUCCESS(pEntry->mLazySymbolsLoader(pThis, name));
+
+		pThis->mpCurrScopeEntry       = pCurrScopeEntry;
+		pThis->mpPrevScopeEntry       = pPrevScopeEntry;
+		pThis->mIsLocked              = isLocked;
+		pThis->mIsReadMode            = isReadMode;
+		pThis->mLastVisitedScopeIndex = lastVisitedScopeIndex;
+		pThis->mPrevVisitedScopeIndex = prevVisitedScopeIndex;
+
+		return isDeclared;
+	}
+
 	bool CSymTable::_internalLookUp(TSymTableEntry* entry, const std::string& variableName) const
 	{
 		TSymbolsMap& table = entry->mVariables;
@@ -0,0 +1,274 @@
+#include "common/gplcTimeReport.h"
+#include <cstdio>
+#include <algorithm>
+#if defined(_WIN32)
+	#include <windows.h>
+	#include <psapi.h>
+	#if defined(_MSC_VER)
+		#pragma comment(lib, "psapi.lib")
+	#endif
+#else
+	#include <sys/resource.h>
+#endif
+
+
+namespace gplc
+{
+	CTimeReport::CTimeReport(const std::string& rootPhaseName):
+		ITimeReport(), mStartTime(TClock::now()), mStartCPUTime(std::clock()), mStartPeakRSS(_getPeakRSS())
+	{
+		mRootPhase.mName = rootPhaseName;
+	}
+
+	void CTimeReport::BeginPhase(const std::string& name)
+	{
+		TPhaseInfo* pParentPhase = mActivePhases.empty() ? &mRootPhase : mActivePhases.back().mpPhase;
+
+		TPhaseInfo phase;
+
+		phase.mName      = name;
+		phase.mStartTime = _getElapsedTime(TClock::now());
+
+		// \note only the innermost active phase gets new children, so pointers to active phases stay valid
+		pParentPhase->mChildren.push_back(std::move(phase));
+
+		mActivePhases.push_back({ &pParentPhase->mChildren.back(), std::clock(), _getPeakRSS() });
+	}
+
+	void CTimeReport::EndPhase()
+	{
+		if (mActivePhases.empty())
+		{
+			return;
+		}
+
+		const TActivePhase& activePhase = mActivePhases.back();
+
+		TPhaseInfo* pPhase = activePhase.mpPhase;
+
+		pPhase->mWallTime = _getElapsedTime(TClock::now()) - pPhase->mStartTime;
+		pPhase->mCPUTime  = _getCPUTime(std::clock()) - _getCPUTime(activePhase.mStartCPUTime);
+		pPhase->mPeakRSS  = _getPeakRSS();
+
+		// \note the OS keeps only the high-water mark of the process, so a phase's own usage is seen only when it exceeds the mark
+		pPhase->mPeakRSSGrowth = pPhase->mPeakRSS > activePhase.mStartPeakRSS ? pPhase->mPeakRSS - activePhase.mStartPeakRSS : 0;
+
+		mActivePhases.pop_back();
+	}
+
+	const ITimeReport::TPhaseInfo& CTimeReport::GetRootPhase()
+	{
+		_updateRootPhase();
+
+		return mRootPhase;
+	}
+
+	std::string CTimeReport::ToString()
+	{
+		_updateRootPhase();
+
+		std::string output;
+
+		output.append("Time report:\n")
+			  .append("   Wall (ms)    CPU (ms)  Process peak RSS (KB)  Peak RSS growth (KB)  Phase\n");
+
+		_printPhase(output, mRootPhase, 0);
+
+		return output;
+	}
+
+	std::string CTimeReport::ToJSON()
+	{
+		_updateRootPhase();
+
+		std::string output;
+
+		_writePhaseJSON(output, mRootPhase);
+
+		return output.append("\n");
+	}
+
+	std::string CTimeReport::ToTraceEvents()
+	{
+		_updateRootPhase();
+
+		std::string output;
+
+		// \note all phases are measured on the driver's thread, so the metadata names a single process and thread
+		output.append("{\"traceEvents\":[")
+			  .append("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":");
+
+		_writeEscapedString(output, mRootPhase.mName);
+
+		output.append("}},{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"driver\"}}");
+
+		_writePhaseTraceEvents(output, mRootPhase);
+
+		return output.append("],\"displayTimeUnit\":\"ms\"}\n");
+	}
+
+	void CTimeReport::_updateRootPhase()
+	{
+		mRootPhase.mWallTime = _getElapsedTime(TClock::now());
+		mRootPhase.mCPUTime  = _getCPUTime(std::clock()) - _getCPUTime(mStartCPUTime);
+		mRootPhase.mPeakRSS  = _getPeakRSS();
+		mRootPhase.mPeakRSSGrowth = mRootPhase.mPeakRSS - std::min(mRootPhase.mPeakRSS, mStartPeakRSS);
+	}
+
+	F64 CTimeReport::_getElapsedTime(TClock::time_point time) const
+	{
+		return std::chrono::duration<F64, std::milli>(time - mStartTime).count();
+	}
+
+	F64 CTimeReport::_getCPUTime(std::clock_t time) const
+	{
+		return 1000.0 * static_cast<F64>(time) / CLOCKS_PER_SEC;
+	}
+
+	U64 CTimeReport::_getPeakRSS()
+	{
+#if defined(_WIN32)
+		PROCESS_MEMORY_COUNTERS memoryCounters;
+
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters)))
+		{
+			return 0;
+		}
+
+		return static_cast<U64>(memoryCounters.PeakWorkingSetSize) >> 10;
+#else
+		rusage usage;
+
+		if (getrusage(RUSAGE_SELF, &usage))
+		{
+			return 0;
+		}
+
+	#if defined(__APPLE__)
+		return static_cast<U64>(usage.ru_maxrss) >> 10; // \note macOS reports the value in bytes
+	#else
+		return static_cast<U64>(usage.ru_maxrss);
+	#endif
+#endif
+	}
+
+	void CTimeReport::_printPhase(std::string& output, const TPhaseInfo& phase, U32 level)
+	{
+		C8 buffer[96];
+
+		std::snprintf(buffer, sizeof(buffer), "%12.3f%12.3f%23llu%22llu  ", phase.mWallTime, phase.mCPUTime,
+					  static_cast<unsigned long long>(phase.mPeakRSS), static_cast<unsigned long long>(phase.mPeakRSSGrowth));
+
+		output.append(buffer).append(2 * level, ' ').append(phase.mName).append("\n");
+
+		for (const TPhaseInfo& currChild : phase.mChildren)
+		{
+			_printPhase(output, currChild, level + 1);
+		}
+	}
+
+	void CTimeReport::_writePhaseJSON(std::string& output, const TPhaseInfo& phase)
+	{
+		output.append("{\"name\":");
+
+		_writeEscapedString(output, phase.mName);
+
+		C8 buffer[192];
+
+		std::snprintf(buffer, sizeof(buffer), ",\"start_ms\":%.3f,\"wall_ms\":%.3f,\"cpu_ms\":%.3f,\"process_peak_rss_kb\":%llu,\"peak_rss_growth_kb\":%llu,\"children\":[",
+					  phase.mStartTime, phase.mWallTime, phase.mCPUTime,
+					  static_cast<unsigned long long>(phase.mPeakRSS), static_cast<unsigned long long>(phase.mPeakRSSGrowth));
+
+		output.append(buffer);
+
+		for (size_t i = 0; i < phase.mChildren.size(); ++i)
+		{
+			if (i)
+			{
+				output.push_back(',');
+			}
+
+			_writePhaseJSON(output, phase.mChildren[i]);
+		}
+
+		output.append("]}");
+	}
+
+	void CTimeReport::_writePhaseTraceEvents(std::string& output, const TPhaseInfo& phase)
+	{
+		output.append(",{\"name\":");
+
+		_writeEscapedString(output, phase.mName);
+
+		C8 buffer[256];
+
+		// \note timestamps of the format are specified in microseconds
+		std::snprintf(buffer, sizeof(buffer), ",\"cat\":\"gplc\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,"
+											  "\"args\":{\"cpu_ms\":%.3f,\"process_peak_rss_kb\":%llu,\"peak_rss_growth_kb\":%llu}}",
+					  1000.0 * phase.mStartTime, 1000.0 * phase.mWallTime, phase.mCPUTime,
+					  static_cast<unsigned long long>(phase.mPeakRSS), static_cast<unsigned long long>(phase.mPeakRSSGrowth));
+
+		output.append(buffer);
+
+		for (const TPhaseInfo& currChild : phase.mChildren)
+		{
+			_writePhaseTraceEvents(output, currChild);
+		}
+	}
+
+	void CTimeReport::_writeEscapedString(std::string& output, const std::string& value)
+	{
+		output.push_back('"');
+
+		for (C8 currCh : value)
+		{
+			// \note JSON doesn't allow raw control characters within strings
+			if (static_cast<U8>(currCh) < 0x20)
+			{
+				C8 buffer[8];
+
+				std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<U32>(static_cast<U8>(currCh)));
+
+				output.append(buffer);
+
+				continue;
+			}
+
+			if (currCh == '"' || currCh == '\\')
+			{
+				output.push_back('\\');
+			}
+
+			output.push_back(currCh);
+		}
+
+		output.push_back('"');
+	}
+
+
+	CTimeReportScope::CTimeReportScope(ITimeReport* pTimeReport, const std::string& phaseName):
+		mpTimeReport(pTimeReport)
+	{
+		if (mpTimeReport)
+		{
+			mpTimeReport->BeginPhase(phaseName);
+		}
+	}
+
+	CTimeReportScope::~CTimeReportScope()
+	{
+		if (mpTimeReport)
+		{
+			mpTimeReport->EndPhase();
+		}
+	}
+
+	void CTimeReportScope::NextPhase(const std::string& phaseName)
+	{
+		if (mpTimeReport)
+		{
+			mpTimeReport->EndPhase();
+			mpTimeReport->BeginPhase(phaseName);
+		}
+	}
+}
@@ -58,6 +58,119 @@ namespace gplc
 		return NT_VOID;
 	}
 
+
+	/*!
+		\brief The table of allowed implicit casts between compiler's types. It's built at compile-time
+		and is indexed directly with E_COMPILER_TYPES values, so a lookup neither allocates nor mutates
+		any shared state
+	*/
+
+	struct TCastTable
+	{
+		bool mCells[CT_LAST][CT_LAST];
+	};
+
+	static constexpr TCastTable BuildCastTable()
+	{
+		TCastTable table {};
+
+		// \note all integral types are convertible between each other
+		for (U32 from = CT_INT8; from <= CT_UINT64; ++from)
+		{
+			for (U32 to = CT_INT8; to <= CT_UINT64; ++to)
+			{
+				table.mCells[from][to] = (from != to);
+			}
+		}
+
+		table.mCells[CT_FLOAT][CT_DOUBLE] = true;
+		table.mCells[CT_DOUBLE][CT_FLOAT] = true;
+		table.mCells[CT_CHAR][CT_STRING]  = true;
+
+		return table;
+	}
+
+	static constexpr TCastTable CastTable = BuildCastTable();
+
+
+	/*!
+		\brief The table contains results of usual arithmetic conversions for a pair of operands' types.
+		Types are ordered by their ranks (int8 < int16 < int32 < int64 < float < double), if ranks of both
+		integral operands are equal the unsigned one wins. A pair of same types always produces the type itself.
+		CT_LAST means that there is no common type for given operands
+	*/
+
+	struct TArithmeticConversionTable
+	{
+		E_COMPILER_TYPES mCells[CT_LAST][CT_LAST];
+	};
+
+	static constexpr U8 GetArithmeticRank(E_COMPILER_TYPES type)
+	{
+		constexpr U8 ranks[CT_LAST]
+		{
+			1, 2, 3, 4,	/// CT_INT8 .. CT_INT64
+			1, 2, 3, 4,	/// CT_UINT8 .. CT_UINT64
+			5, 6,		/// CT_FLOAT, CT_DOUBLE
+		};
+
+		return ranks[type];
+	}
+
+	static constexpr TArithmeticConversionTable BuildArithmeticConversionTable()
+	{
+		TArithmeticConversionTable table {};
+
+		for (U32 i = 0; i < CT_LAST; ++i)
+		{
+			for (U32 j = 0; j < CT_LAST; ++j)
+			{
+				const E_COMPILER_TYPES leftType  = static_cast<E_COMPILER_TYPES>(i);
+				const E_COMPILER_TYPES rightType = static_cast<E_COMPILER_TYPES>(j);
+
+				const U8 leftRank  = GetArithmeticRank(leftType);
+				const U8 rightRank = GetArithmeticRank(rightType);
+
+				if (i == j)
+				{
+					table.mCells[i][j] = leftType;
+				}
+				else if (!leftRank || !rightRank)
+				{
+					table.mCells[i][j] = CT_LAST;
+				}
+				else if (leftRank != rightRank)
+				{
+					table.mCells[i][j] = (leftRank > rightRank) ? leftType : rightType;
+				}
+				else
+				{
+					table.mCells[i][j] = (leftType >= CT_UINT8) ? leftType : rightType;
+				}
+			}
+		}
+
+		return table;
+	}
+
+	static constexpr TArithmeticConversionTable ArithmeticConversionTable = BuildArithmeticConversionTable();
+
+	static_assert(ArithmeticConversionTable.mCells[CT_INT8][CT_INT32] == CT_INT32, "int8 and int32 should be promoted to int32");
+	static_assert(ArithmeticConversionTable.mCells[CT_INT32][CT_UINT32] == CT_UINT32, "int32 and uint32 should be promoted to uint32");
+	static_assert(ArithmeticConversionTable.mCells[CT_INT64][CT_FLOAT] == CT_FLOAT, "int64 and float should be promoted to float");
+	static_assert(ArithmeticConversionTable.mCells[CT_BOOL][CT_INT32] == CT_LAST, "bool doesn't participate in arithmetic conversions");
+
+
+	E_COMPILER_TYPES GetCommonArithmeticType(E_COMPILER_TYPES leftType, E_COMPILER_TYPES rightType)
+	{
+		if (leftType >= CT_LAST || rightType >= CT_LAST)
+		{
+			return CT_LAST;
+		}
+
+		return ArithmeticConversionTable.mCells[leftType][rightType];
+	}
+
 	/*!
 		\brief CTypeResolver's definition
 	*/
@@ -202,7 +315,9 @@ namespace gplc
 
 		auto pStructBody = pNode->GetFieldsDeclarations();
 
-		CStructType* pStructType = mpTypesFactory->CreateStructType({}, AV_AGGREGATE_TYPE, mpSymTable->GetCurrentScopeType());
+		const U32 layoutAttributes = pNode->GetAttributes() & (AV_PACKED_LAYOUT | AV_REORDER_FIELDS | AV_SOA_LAYOUT);
+
+		CStructType* pStructType = mpTypesFactory->CreateStructType({}, AV_AGGREGATE_TYPE | layoutAttributes, mpSymTable->GetCurrentScopeType());
 
 		CType* pFieldType = nullptr;
 
@@ -318,6 +433,13 @@ namespace gplc
 				{
 					return mpTypesFactory->CreateType(CT_UINT64, BTS_UINT64, 0x0, "length", pExprType);
 				}
+				break;
+			case CT_STRING:
+				if (identifierName == "length")
+				{
+					return mpTypesFactory->CreateType(CT_UINT64, BTS_UINT64, 0x0, "length", pExprType);
+				}
+				break;
 		}
 
 		return nullptr;
@@ -424,32 +546,25 @@ namespace gplc
 
 	CType* CTypeResolver::_deduceExprType(E_TOKEN_TYPE opType, E_COMPILER_TYPES leftType, E_COMPILER_TYPES rightType)
 	{
-		// here the type inference table is placed
+		const E_COMPILER_TYPES commonType = GetCommonArithmeticType(leftType, rightType);
+
 		switch (opType)
 		{
 			case TT_PLUS:
 			case TT_MINUS:
 			case TT_STAR:
 			case TT_SLASH:
-				if (leftType == rightType)
-				{
-					return _deduceBuiltinType(NodeToCompilerType(leftType));
-				}
-
-				// compiler-time error
-				return nullptr;
+				// compiler-time error if there is no common type
+				return (commonType != CT_LAST) ? _deduceBuiltinType(NodeToCompilerType(commonType)) : nullptr;
+			case TT_PERCENT_SIGN:
+				return (commonType >= CT_INT8 && commonType <= CT_UINT64) ? _deduceBuiltinType(NodeToCompilerType(commonType)) : nullptr;
 			case TT_LE:
 			case TT_LT:
 			case TT_GE:
 			case TT_GT:
 			case TT_EQ:
 			case TT_NE:
-				if (leftType == rightType)
-				{
-					return _deduceBuiltinType(NT_BOOL);
-				}
-
-				return nullptr;
+				return (commonType != CT_LAST) ? _deduceBuiltinType(NT_BOOL) : nullptr;
 		}
 
 		return nullptr;
@@ -457,23 +572,18 @@ namespace gplc
 
 
 	/*!
-		CType definition
+		TTargetAlignmentsInfo definition
 	*/
 
-	CType::TCastMap CType::mCastMap
-	{
-		{ CT_INT8, { { CT_INT16, true }, { CT_INT32, true }, { CT_INT64, true },  {CT_UINT8, true}, { CT_UINT16, true }, { CT_UINT32, true }, { CT_UINT64, true } } },
-		{ CT_INT16, { { CT_INT8, true }, { CT_INT32, true }, { CT_INT64, true },  {CT_UINT8, true}, { CT_UINT16, true }, { CT_UINT32, true }, { CT_UINT64, true } } },
-		{ CT_INT32, { { CT_INT8, true }, { CT_INT16, true }, { CT_INT64, true },  {CT_UINT8, true}, { CT_UINT16, true }, { CT_UINT32, true }, { CT_UINT64, true } } },
-		{ CT_INT64, { { CT_INT16, true }, { CT_INT32, true }, { CT_INT8, true },  {CT_UINT8, true}, { CT_UINT16, true }, { CT_UINT32, true }, { CT_UINT64, true } } },
-		{ CT_UINT8, { { CT_INT16, true }, { CT_INT32, true }, { CT_INT64, true },  {CT_INT8, true}, { CT_UINT16, true }, { CT_UINT32, true }, { CT_UINT64, true } } },
-		{ CT_UINT16, { { CT_INT16, true }, { CT_INT32, true }, { CT_INT64, true },  {CT_UINT8, true}, { CT_INT16, true }, { CT_UINT32, true }, { CT_UINT64, true } } },
-		{ CT_UINT32, { { CT_INT16, true }, { CT_INT32, true }, { CT_INT64, true },  {CT_UINT8, true}, { CT_UINT16, true }, { CT_INT32, true }, { CT_UINT64, true } } },
-		{ CT_UINT64, { { CT_INT16, true }, { CT_INT32, true }, { CT_INT64, true },  {CT_UINT8, true}, { CT_UINT16, true }, { CT_UINT32, true }, { CT_INT64, true } } },
-		{ CT_FLOAT, { { CT_DOUBLE, true } } },
-		{ CT_DOUBLE, { { CT_FLOAT, true } } },
-		{ CT_CHAR, { { CT_STRING, true } } },
-	};
+	bool TTargetAlignmentsInfo::operator== (const TTargetAlignmentsInfo& info) const
+	{
+		return (mIntegersAlignments == info.mIntegersAlignments) && (mFloatsAlignments == info.mFloatsAlignments) && (mPointerAlignment == info.mPointerAlignment);
+	}
+
+
+	/*!
+		CType definition
+	*/
 
 	CType::CType() :
 		mType(CT_INT32), mSize(4), mAttributes(0x0), mName(ToShortAliasString())
@@ -481,7 +591,7 @@ namespace gplc
 	}
 
 	CType::CType(const CType& type) :
-		mType(type.mType), mSize(type.mSize), mAttributes(type.mAttributes)
+		mType(type.mType), mSize(type.mSize), mAttributes(type.mAttributes), mpLayoutContext(type.mpLayoutContext)
 	{
 	}
 
@@ -523,11 +633,15 @@ namespace gplc
 	void CType::SetAttribute(U32 attribute)
 	{
 		mAttributes |= attribute;
+
+		_invalidateLayouts();
 	}
 
 	void CType::ResetAttribute(U32 attribute)
 	{
 		mAttributes &= ~attribute;
+
+		_invalidateLayouts();
 	}
 
 	void CType::SetName(const std::string& name)
@@ -582,6 +696,11 @@ namespace gplc
 		return mSize;
 	}
 
+	U32 CType::GetAlignment() const
+	{
+		return _getBuiltinTypeAlignment(mType, mSize);
+	}
+
 	U32 CType::GetAttributes() const
 	{
 		return mAttributes;
@@ -607,6 +726,11 @@ namespace gplc
 		return ComputeHash(ToShortAliasString().c_str());
 	}
 
+	void CType::SetLayoutContext(TTargetLayoutContext* pLayoutContext)
+	{
+		mpLayoutContext = pLayoutContext;
+	}
+
 	bool CType::AreSame(const CType* pType) const
 	{
 		if (!pType)
@@ -632,7 +756,12 @@ namespace gplc
 			return true; // \note each built-in type can be converted to a string literal automatically
 		}
 
-		return mCastMap[mType][pType->mType];
+		if (mType >= CT_LAST || pType->mType >= CT_LAST)
+		{
+			return false;
+		}
+
+		return CastTable.mCells[mType][pType->mType];
 	}
 
 	std::string CType::ToShortAliasString() const
@@ -752,6 +881,43 @@ namespace gplc
 		return nullptr; ///< unknown type
 	}
 
+	U32 CType::_getBuiltinTypeAlignment(E_COMPILER_TYPES type, U32 size) const
+	{
+		static const TTargetAlignmentsInfo defaultAlignments {};
+
+		const TTargetAlignmentsInfo& targetAlignments = mpLayoutContext ? mpLayoutContext->mAlignments : defaultAlignments;
+
+		const TTargetAlignmentsInfo::TAlignmentsMap* pAlignments = nullptr;
+
+		switch (type)
+		{
+			case CT_POINTER:
+			case CT_STRING:
+			case CT_FUNCTION:
+				return targetAlignments.mPointerAlignment;
+			case CT_FLOAT:
+			case CT_DOUBLE:
+				pAlignments = &targetAlignments.mFloatsAlignments;
+				break;
+			default:
+				pAlignments = &targetAlignments.mIntegersAlignments;
+				break;
+		}
+
+		auto iter = pAlignments->find(size);
+
+		// \note types are aligned by their own size if the target doesn't specify the alignment
+		return (iter != pAlignments->cend()) ? iter->second : (std::max)(1u, (std::min)(size, static_cast<U32>(BTS_POINTER)));
+	}
+
+	void CType::_invalidateLayouts()
+	{
+		if (mpLayoutContext)
+		{
+			++mpLayoutContext->mLayoutsVersion;
+		}
+	}
+
 
 	/*!
 		\brief CPointerType's definition
@@ -837,6 +1003,9 @@ namespace gplc
 	void CStructType::AddField(const std::string& fieldName, CType* pFieldType)
 	{
 		mFieldsTypes.push_back({ fieldName, pFieldType });
+
+		// \note structures which contain this one should be recomputed too, so all cached layouts become outdated
+		_invalidateLayouts();
 	}
 
 	TLLVMIRData CStructType::Accept(ITypeVisitor<TLLVMIRData>* pVisitor)
@@ -847,6 +1016,8 @@ namespace gplc
 	void CStructType::SetAttributes(U32 attributes)
 	{
 		mAttributes = attributes;
+
+		_invalidateLayouts();
 	}
 
 	const CStructType::TFieldsArray& CStructType::GetFieldsTypes() const
@@ -854,6 +1025,115 @@ namespace gplc
 		return mFieldsTypes;
 	}
 
+	const CStructType::TLayoutInfo& CStructType::GetLayoutInfo() const
+	{
+		// \note a layout isn't cached without a context, because there is nothing to invalidate it. A structure which
+		// contains itself can't be laid out, so a field of it sees an incomplete layout instead of infinite recursion
+		if (mIsLayoutBeingComputed || (mpLayoutContext && (mLayoutInfoVersion == mpLayoutContext->mLayoutsVersion)))
+		{
+			return mLayoutInfo;
+		}
+
+		mIsLayoutBeingComputed = true;
+
+		TLayoutInfo& layoutInfo = mLayoutInfo;
+
+		const U32 fieldsCount = static_cast<U32>(mFieldsTypes.size());
+
+		layoutInfo.mFieldsOrder.resize(fieldsCount);
+		layoutInfo.mFieldsOffsets.resize(fieldsCount);
+
+		for (U32 i = 0; i < fieldsCount; ++i)
+		{
+			layoutInfo.mFieldsOrder[i] = i;
+		}
+
+		const bool isPacked = IsPacked();
+
+		// \note the sort is stable, so fields with the same alignment preserve their declaration order
+		if (!isPacked && (mAttributes & AV_REORDER_FIELDS))
+		{
+			std::stable_sort(layoutInfo.mFieldsOrder.begin(), layoutInfo.mFieldsOrder.end(), [this](U32 left, U32 right)
+			{
+				return mFieldsTypes[left].second->GetAlignment() > mFieldsTypes[right].second->GetAlignment();
+			});
+		}
+
+		auto alignOffset = [](U32 offset, U32 alignment)
+		{
+			return (offset + alignment - 1) / alignment * alignment;
+		};
+
+		U32 currOffset    = 0;
+		U32 currAlignment = 1;
+		U32 maxAlignment  = 1;
+
+		CType* pCurrFieldType = nullptr;
+
+		for (U32 currFieldIndex : layoutInfo.mFieldsOrder)
+		{
+			pCurrFieldType = mFieldsTypes[currFieldIndex].second;
+
+			currAlignment = isPacked ? 1 : pCurrFieldType->GetAlignment();
+			maxAlignment  = (std::max)(maxAlignment, currAlignment);
+
+			currOffset = alignOffset(currOffset, currAlignment);
+
+			layoutInfo.mFieldsOffsets[currFieldIndex] = currOffset;
+
+			currOffset += pCurrFieldType->GetSize();
+		}
+
+		layoutInfo.mAlignment = maxAlignment;
+		layoutInfo.mSize      = alignOffset(currOffset, maxAlignment); // \note add tail padding
+
+		mLayoutInfoVersion = mpLayoutContext ? mpLayoutContext->mLayoutsVersion : 0;
+
+		mIsLayoutBeingComputed = false;
+
+		return layoutInfo;
+	}
+
+	I32 CStructType::GetFieldIndex(const std::string& fieldName) const
+	{
+		auto iter = std::find_if(mFieldsTypes.cbegin(), mFieldsTypes.cend(), [&fieldName](auto&& field)
+		{
+			return field.first == fieldName;
+		});
+
+		if (iter == mFieldsTypes.cend())
+		{
+			return -1;
+		}
+
+		U32 declarationIndex = static_cast<U32>(std::distance(mFieldsTypes.cbegin(), iter));
+
+		// \note there is no need to compute the whole layout if the fields are placed in declaration order
+		if (IsPacked() || !(mAttributes & AV_REORDER_FIELDS))
+		{
+			return declarationIndex;
+		}
+
+		const std::vector<U32>& fieldsOrder = GetLayoutInfo().mFieldsOrder;
+
+		return static_cast<I32>(std::distance(fieldsOrder.cbegin(), std::find(fieldsOrder.cbegin(), fieldsOrder.cend(), declarationIndex)));
+	}
+
+	U32 CStructType::GetSize() const
+	{
+		return GetLayoutInfo().mSize;
+	}
+
+	U32 CStructType::GetAlignment() const
+	{
+		return GetLayoutInfo().mAlignment;
+	}
+
+	bool CStructType::IsPacked() const
+	{
+		return mAttributes & AV_PACKED_LAYOUT;
+	}
+
 	CASTExpressionNode* CStructType::GetDefaultValue(IASTNodesFactory* pNodesFactory) const
 	{
 		return pNodesFactory->CreateUnaryExpr(TT_DEFAULT, pNodesFactory->CreateLiteralNode(new CIntValue(0)));
@@ -910,7 +1190,7 @@ namespace gplc
 	*/
 
 	CFunctionType::CFunctionType(const TArgsArray& argsTypes, CType* pReturnValueType, U32 attributes, CType* pParent):
-		CType(CT_FUNCTION, CT_POINTER, attributes, "", pParent), mpReturnValueType(pReturnValueType)
+		CType(CT_FUNCTION, BTS_POINTER, attributes, "", pParent), mpReturnValueType(pReturnValueType)
 	{
 		std::copy(argsTypes.begin(), argsTypes.end(), std::back_inserter(mArgsTypes));
 	}
@@ -1126,6 +1406,13 @@ namespace gplc
 		return pDependentType->GetSize();
 	}
 
+	U32 CDependentNamedType::GetAlignment() const
+	{
+		const CType* pDependentType = mpSymTable->LookUpNamedScope(mName)->mpType;
+
+		return pDependentType->GetAlignment();
+	}
+
 	CType* CDependentNamedType::GetDependentType() const
 	{
 		return mpSymTable->LookUpNamedScope(mName)->mpType;
@@ -1198,11 +1485,65 @@ namespace gplc
 		return "array";
 	}
 
+	U32 CArrayType::GetSize() const
+	{
+		// \note a static array is represented as a fat structure { [N x T], i64 } where the last field stores its length
+		const U32 alignment = GetAlignment();
+
+		auto alignOffset = [](U32 offset, U32 alignment)
+		{
+			return (offset + alignment - 1) / alignment * alignment;
+		};
+
+		const CStructType* pSoAElementType = GetSoAElementType();
+
+		if (!pSoAElementType)
+		{
+			return alignOffset(mpBaseType->GetSize() * mElementsCount, alignment) + BTS_UINT64;
+		}
+
+		// \note @soa array's data is { [N x F0], [N x F1], ... }, fields' arrays are placed in the same order as within the structure
+		const auto& fields = pSoAElementType->GetFieldsTypes();
+
+		U32 dataSize = 0;
+
+		CType* pCurrFieldType = nullptr;
+
+		for (U32 currFieldIndex : pSoAElementType->GetLayoutInfo().mFieldsOrder)
+		{
+			pCurrFieldType = fields[currFieldIndex].second;
+
+			dataSize = alignOffset(dataSize, pCurrFieldType->GetAlignment()) + pCurrFieldType->GetSize() * mElementsCount;
+		}
+
+		return alignOffset(dataSize, alignment) + BTS_UINT64;
+	}
+
+	U32 CArrayType::GetAlignment() const
+	{
+		// \note the length is stored with uint64
+		return (std::max)(mpBaseType->GetAlignment(), _getBuiltinTypeAlignment(CT_UINT64, BTS_UINT64));
+	}
+
 	CType* CArrayType::GetBaseType() const
 	{
 		return mpBaseType;
 	}
 
+	const CStructType* CArrayType::GetSoAElementType() const
+	{
+		const CType* pElementType = mpBaseType;
+
+		if (const CDependentNamedType* pNamedType = dynamic_cast<const CDependentNamedType*>(pElementType))
+		{
+			pElementType = pNamedType->GetDependentType();
+		}
+
+		const CStructType* pStructType = dynamic_cast<const CStructType*>(pElementType);
+
+		return (pStructType && (pStructType->GetAttributes() & AV_SOA_LAYOUT)) ? pStructType : nullptr;
+	}
+
 	U32 CArrayType::GetElementsCount() const
 	{
 		return mElementsCount;
@@ -1287,6 +1628,80 @@ namespace gplc
 		return ComputeHash(fullTypeSignature.c_str());
 	}
 
+	I32 CVariantType::GetTag(const CType* pAltType) const
+	{
+		if (!pAltType)
+		{
+			return -1;
+		}
+
+		const U64 altTypeId = pAltType->GetTypeId();
+
+		auto iter = std::find_if(mFieldsTypes.cbegin(), mFieldsTypes.cend(), [altTypeId](const CType* pCurrAltType)
+		{
+			return pCurrAltType->GetTypeId() == altTypeId;
+		});
+
+		return (iter == mFieldsTypes.cend()) ? -1 : static_cast<I32>(std::distance(mFieldsTypes.cbegin(), iter));
+	}
+
+	U32 CVariantType::GetTagSize() const
+	{
+		const size_t altTypesCount = mFieldsTypes.size();
+
+		if (altTypesCount <= (1 << 8))
+		{
+			return sizeof(U8);
+		}
+
+		return (altTypesCount <= (1 << 16)) ? sizeof(U16) : sizeof(U32);
+	}
+
+	U32 CVariantType::GetPayloadSize() const
+	{
+		U32 payloadSize = 0;
+
+		for (auto pCurrAltType : mFieldsTypes)
+		{
+			payloadSize = (std::max)(payloadSize, pCurrAltType->GetSize());
+		}
+
+		return payloadSize;
+	}
+
+	U32 CVariantType::GetPayloadAlignment() const
+	{
+		U32 payloadAlignment = 1;
+
+		for (auto pCurrAltType : mFieldsTypes)
+		{
+			payloadAlignment = (std::max)(payloadAlignment, pCurrAltType->GetAlignment());
+		}
+
+		return (std::min)(payloadAlignment, static_cast<U32>(BTS_UINT64));
+	}
+
+	U32 CVariantType::GetSize() const
+	{
+		auto alignOffset = [](U32 offset, U32 alignment)
+		{
+			return (offset + alignment - 1) / alignment * alignment;
+		};
+
+		const U32 tagSize            = GetTagSize();
+		const U32 payloadElementSize = GetPayloadAlignment();
+		const U32 payloadSize        = alignOffset(GetPayloadSize(), payloadElementSize);
+
+		const U32 payloadOffset = alignOffset(tagSize, _getBuiltinTypeAlignment(CT_UINT64, payloadElementSize));
+
+		return alignOffset(payloadOffset + payloadSize, GetAlignment());
+	}
+
+	U32 CVariantType::GetAlignment() const
+	{
+		return (std::max)(_getBuiltinTypeAlignment(CT_UINT64, GetTagSize()), _getBuiltinTypeAlignment(CT_UINT64, GetPayloadAlignment()));
+	}
+
 	bool CVariantType::AreSame(const CType* pType) const
 	{
 		UNIMPLEMENTED();
@@ -1,10 +1,21 @@
 #include "common/gplcTypesFactory.h"
 #include "common/gplcTypeSystem.h"
+#include "common/gplcStatistics.h"
 #include <cassert>
 
 
 namespace gplc
 {
+	CTypesFactory::CTypesFactory():
+		mpLayoutContext(new TTargetLayoutContext())
+	{
+	}
+
+	CTypesFactory::CTypesFactory(const TTargetAlignmentsInfo& targetAlignments):
+		mpLayoutContext(new TTargetLayoutContext { targetAlignments })
+	{
+	}
+
 	CTypesFactory::~CTypesFactory()
 	{
 		CType* pCurrType = nullptr;
@@ -22,50 +33,58 @@ namespace gplc
 
 			mpCachedTypes.erase(mpCachedTypes.begin());
 		}
+
+		delete mpLayoutContext;
 	}
 
 	CType* CTypesFactory::CreateType(E_COMPILER_TYPES type, U32 size, U32 attributes, const std::string& name, CType* pParent)
 	{
-		return _insertValue(new CType(type, size, attributes, name, pParent));
+		// \note the factory doesn't intern types, so the counter shows how many of them could be shared
+		if (CStatistics::IsEnabled() && !mCreatedBuiltinTypes.emplace(type, size, attributes, name, pParent).second)
+		{
+			CStatistics::Add("types", "duplicates of builtin types");
+		}
+
+		return _insertValue(new CType(type, size, attributes, name, pParent), "builtin");
 	}
 
 	CPointerType* CTypesFactory::CreatePointerType(CType* pType, CType* pParent)
 	{
-		return _insertValue(new CPointerType(pType, pParent));
+		return _insertValue(new CPointerType(pType, pParent), "pointer");
 	}
 
 	CStructType* CTypesFactory::CreateStructType(const TSubTypesArray& fieldsTypes, U32 attributes, CType* pParent)
 	{
-		return _insertValue(new CStructType(fieldsTypes, attributes, pParent));
+		return _insertValue(new CStructType(fieldsTypes, attributes, pParent), "struct");
 	}
 
 	CEnumType* CTypesFactory::CreateEnumType(const ISymTable* pSymTable, const std::string& enumName, CType* pParent)
 	{
-		return _insertValue(new CEnumType(pSymTable, enumName, pParent));
+		return _insertValue(new CEnumType(pSymTable, enumName, pParent), "enum");
 	}
 
 	CFunctionType* CTypesFactory::CreateFunctionType(const TSubTypesArray& argsTypes, CType* pReturnValueType, U32 attributes, CType* pParent)
 	{
-		return _insertValue(new CFunctionType(argsTypes, pReturnValueType, attributes, pParent));
+		return _insertValue(new CFunctionType(argsTypes, pReturnValueType, attributes, pParent), "function");
 	}
 
 	CModuleType* CTypesFactory::CreateModuleType(const std::string& moduleName, U32 attributes, CType* pParent)
 	{
-		return _insertValue(new CModuleType(moduleName, attributes, pParent));
+		return _insertValue(new CModuleType(moduleName, attributes, pParent), "module");
 	}
 
 	CDependentNamedType* CTypesFactory::CreateDependentNamedType(const ISymTable* pSymTable, const std::string& typeIdentifier, CType* pParent)
 	{
-		return _insertValue(new CDependentNamedType(pSymTable, typeIdentifier, pParent));
+		return _insertValue(new CDependentNamedType(pSymTable, typeIdentifier, pParent), "dependent named");
 	}
 
 	CArrayType* CTypesFactory::CreateArrayType(CType* pBaseType, U32 elementsCount, U32 attribute, CType* pParent)
 	{
-		return _insertValue(new CArrayType(pBaseType, elementsCount, attribute, pParent));
+		return _insertValue(new CArrayType(pBaseType, elementsCount, attribute, pParent), "array");
 	}
 
 	CVariantType* CTypesFactory::CreateVariantType(const TTypesArray& typesArray, const std::string& name, U32 attributes, CType* pParent)
 	{
-		return _insertValue(new CVariantType(typesArray, name, attributes, pParent));
+		return _insertValue(new CVariantType(typesArray, name, attributes, pParent), "variant");
 	}
 }
\ No newline at end of file
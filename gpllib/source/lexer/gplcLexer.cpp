@@ -13,6 +13,7 @@
 #include "common\gplcConstants.h"
 #include "common/gplcValues.h"
 #include "lexer/gplcInputStream.h"
+#include "common/gplcStatistics.h"
 #include <cctype>
 
 
@@ -90,6 +91,16 @@ namespace gplc
 		{ "__abort", TT_ABORT_INTRINSIC },
 		{ "cast", TT_CAST_INTRINSIC },
 		{ "variant", TT_VARIANT_TYPE },
+		{ "packed", TT_PACKED_KEYWORD },
+		{ "reorder", TT_REORDER_KEYWORD },
+		{ "soa", TT_SOA_KEYWORD },
+		{ "unchecked", TT_UNCHECKED_KEYWORD },
+		{ "vectorize", TT_VECTORIZE_KEYWORD },
+		{ "novectorize", TT_NOVECTORIZE_KEYWORD },
+		{ "unroll", TT_UNROLL_KEYWORD },
+		{ "restrict", TT_RESTRICT_KEYWORD },
+		{ "inline", TT_INLINE_KEYWORD },
+		{ "noinline", TT_NOINLINE_KEYWORD },
 	};
 
 	CLexer::CLexer():
@@ -272,12 +283,16 @@ namespace gplc
 			// try to parse literal
 			if (pRecognizedToken = _tryRecognizeLiteral(currCh))
 			{
+				GPLC_STATISTIC_ADD("lexer", std::string("tokens ").append(TokenTypeToString(pRecognizedToken->GetType())), 1);
+
 				return pRecognizedToken;
 			}
 
 			// try to parse reserved keywords
 			if (pRecognizedToken = _tryRecognizeKeywordOrIdentifier(currCh))
 			{
+				GPLC_STATISTIC_ADD("lexer", std::string("tokens ").append(TokenTypeToString(pRecognizedToken->GetType())), 1);
+
 				return pRecognizedToken;
 			}
 		}
@@ -18,6 +18,123 @@
 
 namespace gplc
 {
+	std::string NodeTypeToString(E_NODE_TYPE type)
+	{
+		switch (type)
+		{
+			case NT_PROGRAM_UNIT:
+				return "NT_PROGRAM_UNIT";
+			case NT_STATEMENTS:
+				return "NT_STATEMENTS";
+			case NT_OPERATOR:
+				return "NT_OPERATOR";
+			case NT_DECL:
+				return "NT_DECL";
+			case NT_IDENTIFIER:
+				return "NT_IDENTIFIER";
+			case NT_IDENTIFIERS_LIST:
+				return "NT_IDENTIFIERS_LIST";
+			case NT_INT8:
+				return "NT_INT8";
+			case NT_INT16:
+				return "NT_INT16";
+			case NT_INT32:
+				return "NT_INT32";
+			case NT_INT64:
+				return "NT_INT64";
+			case NT_UINT8:
+				return "NT_UINT8";
+			case NT_UINT16:
+				return "NT_UINT16";
+			case NT_UINT32:
+				return "NT_UINT32";
+			case NT_UINT64:
+				return "NT_UINT64";
+			case NT_CHAR:
+				return "NT_CHAR";
+			case NT_STRING:
+				return "NT_STRING";
+			case NT_BOOL:
+				return "NT_BOOL";
+			case NT_FLOAT:
+				return "NT_FLOAT";
+			case NT_DOUBLE:
+				return "NT_DOUBLE";
+			case NT_VOID:
+				return "NT_VOID";
+			case NT_POINTER:
+				return "NT_POINTER";
+			case NT_ASSIGNMENT:
+				return "NT_ASSIGNMENT";
+			case NT_UNARY_EXPR:
+				return "NT_UNARY_EXPR";
+			case NT_BINARY_EXPR:
+				return "NT_BINARY_EXPR";
+			case NT_LITERAL:
+				return "NT_LITERAL";
+			case NT_IF_STATEMENT:
+				return "NT_IF_STATEMENT";
+			case NT_LOOP_STATEMENT:
+				return "NT_LOOP_STATEMENT";
+			case NT_WHILE_STATEMENT:
+				return "NT_WHILE_STATEMENT";
+			case NT_FUNC_DECL:
+				return "NT_FUNC_DECL";
+			case NT_FUNC_CLOSURE:
+				return "NT_FUNC_CLOSURE";
+			case NT_FUNC_ARGS:
+				return "NT_FUNC_ARGS";
+			case NT_FUNC_CALL:
+				return "NT_FUNC_CALL";
+			case NT_RETURN_STATEMENT:
+				return "NT_RETURN_STATEMENT";
+			case NT_DEFINITION:
+				return "NT_DEFINITION";
+			case NT_BLOCK:
+				return "NT_BLOCK";
+			case NT_ENUM_DECL:
+				return "NT_ENUM_DECL";
+			case NT_STRUCT_DECL:
+				return "NT_STRUCT_DECL";
+			case NT_DEPENDENT_TYPE:
+				return "NT_DEPENDENT_TYPE";
+			case NT_BREAK_OPERATOR:
+				return "NT_BREAK_OPERATOR";
+			case NT_CONTINUE_OPERATOR:
+				return "NT_CONTINUE_OPERATOR";
+			case NT_ACCESS_OPERATOR:
+				return "NT_ACCESS_OPERATOR";
+			case NT_ARRAY:
+				return "NT_ARRAY";
+			case NT_INDEXED_ACCESS_OPERATOR:
+				return "NT_INDEXED_ACCESS_OPERATOR";
+			case NT_IMPORT:
+				return "NT_IMPORT";
+			case NT_DEFER_OPERATOR:
+				return "NT_DEFER_OPERATOR";
+			case NT_SIZEOF_OPERATOR:
+				return "NT_SIZEOF_OPERATOR";
+			case NT_TYPEID_OPERATOR:
+				return "NT_TYPEID_OPERATOR";
+			case NT_MEMCPY32_INTRINSIC:
+				return "NT_MEMCPY32_INTRINSIC";
+			case NT_MEMCPY64_INTRINSIC:
+				return "NT_MEMCPY64_INTRINSIC";
+			case NT_MEMSET32_INTRINSIC:
+				return "NT_MEMSET32_INTRINSIC";
+			case NT_MEMSET64_INTRINSIC:
+				return "NT_MEMSET64_INTRINSIC";
+			case NT_ABORT_INTRINSIC:
+				return "NT_ABORT_INTRINSIC";
+			case NT_CAST_INTRINSIC:
+				return "NT_CAST_INTRINSIC";
+			case NT_VARIANT_DECL:
+				return "NT_VARIANT_DECL";
+		}
+
+		return "unknown";
+	}
+
 	/*!
 		CASTNode class definition
 	*/
@@ -97,11 +214,54 @@ namespace gplc
 		return RV_SUCCESS;
 	}
 
+	Result CASTNode::ReplaceChild(CASTNode* pChild, CASTNode* pNewChild)
+	{
+		if (!pChild || !pNewChild)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		std::vector<CASTNode*>::iterator currElement = std::find(mChildren.begin(), mChildren.end(), pChild);
+
+		if (currElement == mChildren.end())
+		{
+			return RV_FAIL;
+		}
+
+		*currElement = pNewChild;
+
+		return RV_SUCCESS;
+	}
+
+	Result CASTNode::RemoveChild(CASTNode* pChild)
+	{
+		if (!pChild)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		std::vector<CASTNode*>::iterator currElement = std::find(mChildren.begin(), mChildren.end(), pChild);
+
+		if (currElement == mChildren.end())
+		{
+			return RV_FAIL;
+		}
+
+		mChildren.erase(currElement);
+
+		return RV_SUCCESS;
+	}
+
 	void CASTNode::SetAttribute(U32 attribute)
 	{
 		mAttributes |= attribute;
 	}
 
+	void CASTNode::ResetAttribute(U32 attribute)
+	{
+		mAttributes &= ~attribute;
+	}
+
 	const std::vector<CASTNode*> CASTNode::GetChildren() const
 	{
 		return mChildren;
@@ -549,8 +709,8 @@ namespace gplc
 		\brief CASTLoopStatementNode's definition
 	*/
 
-	CASTLoopStatementNode::CASTLoopStatementNode(CASTBlockNode* pBody):
-		CASTNode(NT_LOOP_STATEMENT)
+	CASTLoopStatementNode::CASTLoopStatementNode(CASTBlockNode* pBody, const TLoopHints& hints):
+		CASTNode(NT_LOOP_STATEMENT), mHints(hints)
 	{
 		AttachChild(pBody);
 	}
@@ -575,13 +735,18 @@ namespace gplc
 		return dynamic_cast<CASTBlockNode*>(mChildren[0]);
 	}
 
+	const TLoopHints& CASTLoopStatementNode::GetHints() const
+	{
+		return mHints;
+	}
+
 
 	/*!
 		\brief CASTWhileLoopStatementNode's definition
 	*/
 
-	CASTWhileLoopStatementNode::CASTWhileLoopStatementNode(CASTExpressionNode* pCondition, CASTBlockNode* pBody) :
-		CASTNode(NT_WHILE_STATEMENT)
+	CASTWhileLoopStatementNode::CASTWhileLoopStatementNode(CASTExpressionNode* pCondition, CASTBlockNode* pBody, const TLoopHints& hints) :
+		CASTNode(NT_WHILE_STATEMENT), mHints(hints)
 	{
 		AttachChild(pCondition);
 		AttachChild(pBody);
@@ -612,6 +777,11 @@ namespace gplc
 		return dynamic_cast<CASTBlockNode*>(mChildren[1]);
 	}
 
+	const TLoopHints& CASTWhileLoopStatementNode::GetHints() const
+	{
+		return mHints;
+	}
+
 
 	/*!
 		\brief CASTFunctionDeclNode's definition
@@ -910,8 +1080,8 @@ namespace gplc
 		\brief CASTStructDeclNode's definition
 	*/
 
-	CASTStructDeclNode::CASTStructDeclNode(CASTIdentifierNode* pStructName, CASTBlockNode* pStructFields):
-		CASTTypeNode(NT_STRUCT_DECL)
+	CASTStructDeclNode::CASTStructDeclNode(CASTIdentifierNode* pStructName, CASTBlockNode* pStructFields, U32 attributes):
+		CASTTypeNode(NT_STRUCT_DECL, attributes)
 	{
 		AttachChild(pStructName);
 		AttachChild(pStructFields);
@@ -81,14 +81,14 @@ namespace gplc
 		return _insertNode(new CASTIfStatementNode(pCondition, pThenBlock, pElseBlock));
 	}
 
-	CASTLoopStatementNode* CASTNodesFactory::CreateLoopStmtNode(CASTBlockNode* pBody)
+	CASTLoopStatementNode* CASTNodesFactory::CreateLoopStmtNode(CASTBlockNode* pBody, const TLoopHints& hints)
 	{
-		return _insertNode(new CASTLoopStatementNode(pBody));
+		return _insertNode(new CASTLoopStatementNode(pBody, hints));
 	}
 
-	CASTWhileLoopStatementNode* CASTNodesFactory::CreateWhileStmtNode(CASTExpressionNode* pCondition, CASTBlockNode* pBody)
+	CASTWhileLoopStatementNode* CASTNodesFactory::CreateWhileStmtNode(CASTExpressionNode* pCondition, CASTBlockNode* pBody, const TLoopHints& hints)
 	{
-		return _insertNode(new CASTWhileLoopStatementNode(pCondition, pBody));
+		return _insertNode(new CASTWhileLoopStatementNode(pCondition, pBody, hints));
 	}
 
 	CASTFunctionClosureNode* CASTNodesFactory::CreateFuncClosureNode()
@@ -131,9 +131,9 @@ namespace gplc
 		return _insertNode(new CASTEnumDeclNode(pEnumName));
 	}
 
-	CASTStructDeclNode* CASTNodesFactory::CreateStructDeclNode(CASTIdentifierNode* pStructName, CASTBlockNode* pStructFields)
+	CASTStructDeclNode* CASTNodesFactory::CreateStructDeclNode(CASTIdentifierNode* pStructName, CASTBlockNode* pStructFields, U32 attributes)
 	{
-		return _insertNode(new CASTStructDeclNode(pStructName, pStructFields));
+		return _insertNode(new CASTStructDeclNode(pStructName, pStructFields, attributes));
 	}
 
 	CASTNamedTypeNode* CASTNodesFactory::CreateNamedTypeNode(CASTIdentifierNode* pIdentifier, U32 attributes)
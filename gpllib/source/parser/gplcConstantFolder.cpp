@@ -0,0 +1,406 @@
+#include "parser/gplcConstantFolder.h"
+#include "parser/gplcASTNodes.h"
+#include "parser/gplcASTNodesFactory.h"
+#include "common/gplcConstExprInterpreter.h"
+#include "common/gplcSymTable.h"
+#include "common/gplcValues.h"
+
+
+namespace gplc
+{
+	/*!
+		\brief CConstantFolder's definition
+	*/
+
+	Result CConstantFolder::Fold(CASTSourceUnitNode* pSourceUnit, ISymTable* pSymTable, IConstExprInterpreter* pInterpreter, IASTNodesFactory* pNodesFactory)
+	{
+		if (!pSourceUnit || !pSymTable || !pInterpreter || !pNodesFactory)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		mpSymTable     = pSymTable;
+		mpInterpreter  = pInterpreter;
+		mpNodesFactory = pNodesFactory;
+
+		// \note scopes of a module are visited in the same order as the code generator does, the state of the table is restored after that
+		return mpSymTable->VisitNamedScopeWithRestore(pSourceUnit->GetModuleName(), [this, pSourceUnit](ISymTable* pSymTable)
+		{
+			for (auto pCurrStatement : pSourceUnit->GetStatements())
+			{
+				_foldChild(pSourceUnit, pCurrStatement);
+			}
+		});
+	}
+
+	CASTNode* CConstantFolder::_foldStatement(CASTNode* pNode)
+	{
+		if (!pNode)
+		{
+			return nullptr;
+		}
+
+		switch (pNode->GetType())
+		{
+			case NT_IF_STATEMENT:
+				return _foldIfStatement(dynamic_cast<CASTIfStatementNode*>(pNode));
+			case NT_LOOP_STATEMENT:
+				_foldBlock(dynamic_cast<CASTLoopStatementNode*>(pNode)->GetBody());
+				return pNode;
+			case NT_WHILE_STATEMENT:
+				{
+					auto pWhileStatement = dynamic_cast<CASTWhileLoopStatementNode*>(pNode);
+
+					_foldChild(pWhileStatement, pWhileStatement->GetCondition());
+					_foldBlock(pWhileStatement->GetBody());
+				}
+				return pNode;
+			case NT_DEFINITION:
+				if (auto pFuncDefinition = dynamic_cast<CASTFuncDefinitionNode*>(pNode))
+				{
+					_foldBlock(dynamic_cast<CASTBlockNode*>(pFuncDefinition->GetValue()));
+
+					return pNode;
+				}
+
+				_foldChild(pNode, dynamic_cast<CASTDefinitionNode*>(pNode)->GetValue());
+				return pNode;
+			case NT_ASSIGNMENT:
+				_foldChild(pNode, dynamic_cast<CASTAssignmentNode*>(pNode)->GetRight());
+				return pNode;
+			case NT_RETURN_STATEMENT:
+			case NT_DEFER_OPERATOR:
+				_foldChild(pNode, pNode->GetChildren()[0]);
+				return pNode;
+		}
+
+		// \note declarations of types and other statements are left as is
+		return _foldExpression(pNode);
+	}
+
+	void CConstantFolder::_foldBlock(CASTBlockNode* pBlock)
+	{
+		if (!pBlock)
+		{
+			return;
+		}
+
+		mpSymTable->VisitScope();
+
+		// \note iterate over a copy, because statements can be replaced or removed
+		const std::vector<CASTNode*> statements = pBlock->GetStatements();
+
+		for (auto pCurrStatement : statements)
+		{
+			_foldChild(pBlock, pCurrStatement);
+		}
+
+		mpSymTable->LeaveScope();
+	}
+
+	CASTNode* CConstantFolder::_foldIfStatement(CASTIfStatementNode* pNode)
+	{
+		_foldChild(pNode, pNode->GetCondition());
+
+		auto pThenBlock = pNode->GetThenBlock();
+		auto pElseBlock = pNode->GetElseBlock();
+
+		auto pConditionValue = dynamic_cast<CBoolValue*>(_getConstantValue(pNode->GetCondition()));
+
+		if (!pConditionValue)
+		{
+			_foldBlock(pThenBlock);
+			_foldBlock(pElseBlock);
+
+			return pNode;
+		}
+
+		if (pConditionValue->GetValue())
+		{
+			_foldBlock(pThenBlock);
+
+			if (pElseBlock)
+			{
+				mpSymTable->RemoveScope();
+				pNode->RemoveChild(pElseBlock);
+			}
+
+			return pNode;
+		}
+
+		mpSymTable->RemoveScope();
+
+		if (!pElseBlock)
+		{
+			return nullptr;
+		}
+
+		_foldBlock(pElseBlock);
+
+		// \note the else branch becomes the only one, its condition is always true
+		return mpNodesFactory->CreateIfStmtNode(dynamic_cast<CASTExpressionNode*>(_createLiteral({ CT_BOOL, true })), pElseBlock, nullptr);
+	}
+
+	CASTNode* CConstantFolder::_foldExpression(CASTNode* pNode)
+	{
+		if (!pNode)
+		{
+			return nullptr;
+		}
+
+		switch (pNode->GetType())
+		{
+			case NT_UNARY_EXPR:
+				return _foldUnaryExpression(dynamic_cast<CASTUnaryExpressionNode*>(pNode));
+			case NT_BINARY_EXPR:
+				return _foldBinaryExpression(dynamic_cast<CASTBinaryExpressionNode*>(pNode));
+			case NT_FUNC_CALL:
+				if (auto pArgs = dynamic_cast<CASTFunctionCallNode*>(pNode)->GetArgs())
+				{
+					for (auto pCurrArg : pArgs->GetChildren())
+					{
+						_foldChild(pArgs, pCurrArg);
+					}
+				}
+				break;
+			case NT_INDEXED_ACCESS_OPERATOR:
+				_foldChild(pNode, dynamic_cast<CASTIndexedAccessOperatorNode*>(pNode)->GetIndexExpression());
+				break;
+		}
+
+		return pNode;
+	}
+
+	CASTNode* CConstantFolder::_foldUnaryExpression(CASTUnaryExpressionNode* pNode)
+	{
+		CASTNode* pData = pNode->GetData();
+
+		_foldChild(pNode, pData);
+
+		pData = pNode->GetData();
+
+		auto pDataExpr = dynamic_cast<CASTUnaryExpressionNode*>(pData);
+
+		switch (pNode->GetOpType())
+		{
+			case TT_DEFAULT:
+				// \note (expr) is represented with two nested unary expressions, drop the outer one
+				return (pDataExpr && pDataExpr->GetOpType() == TT_DEFAULT) ? pDataExpr : pNode;
+			case TT_MINUS:
+				return _getConstantValue(pData) ? _evalConstantExpression(pNode) : pNode;
+			case TT_NOT:
+				if (_getConstantValue(pData))
+				{
+					return _evalConstantExpression(pNode);
+				}
+
+				// \note !!b -> b
+				if (pDataExpr && pDataExpr->GetOpType() == TT_NOT)
+				{
+					CASTNode* pOperand = pDataExpr->GetData();
+
+					return dynamic_cast<CASTExpressionNode*>(pOperand) ? pOperand : mpNodesFactory->CreateUnaryExpr(TT_DEFAULT, pOperand);
+				}
+
+				return pNode;
+		}
+
+		return pNode;
+	}
+
+	CASTNode* CConstantFolder::_foldBinaryExpression(CASTBinaryExpressionNode* pNode)
+	{
+		_foldChild(pNode, pNode->GetLeft());
+		_foldChild(pNode, pNode->GetRight());
+
+		CASTExpressionNode* pLeft  = pNode->GetLeft();
+		CASTExpressionNode* pRight = pNode->GetRight();
+
+		CBaseValue* pLeftValue  = _getConstantValue(pLeft);
+		CBaseValue* pRightValue = _getConstantValue(pRight);
+
+		if (pLeftValue && pRightValue)
+		{
+			return _evalConstantExpression(pNode);
+		}
+
+		/*!
+			\note The semantic analyser guarantees that both operands have the same type, so an identity
+			operation can be replaced with its non constant operand. x + 0 isn't simplified for floating point
+			values, because -0.0 + 0.0 gives 0.0
+		*/
+
+		bool isFloatingPoint = (pLeftValue && (pLeftValue->GetType() == LT_FLOAT || pLeftValue->GetType() == LT_DOUBLE)) ||
+							   (pRightValue && (pRightValue->GetType() == LT_FLOAT || pRightValue->GetType() == LT_DOUBLE));
+
+		switch (pNode->GetOpType())
+		{
+			case TT_STAR:
+				if (_isConstantValueEqualTo(pRight, 1))
+				{
+					return pLeft;
+				}
+
+				if (_isConstantValueEqualTo(pLeft, 1))
+				{
+					return pRight;
+				}
+
+				break;
+			case TT_SLASH:
+				if (_isConstantValueEqualTo(pRight, 1))
+				{
+					return pLeft;
+				}
+
+				break;
+			case TT_PLUS:
+				if (!isFloatingPoint && _isConstantValueEqualTo(pRight, 0))
+				{
+					return pLeft;
+				}
+
+				if (!isFloatingPoint && _isConstantValueEqualTo(pLeft, 0))
+				{
+					return pRight;
+				}
+
+				break;
+			case TT_MINUS:
+				if (_isConstantValueEqualTo(pRight, 0))
+				{
+					return pLeft;
+				}
+
+				break;
+		}
+
+		return pNode;
+	}
+
+	void CConstantFolder::_foldChild(CASTNode* pParent, CASTNode* pChild)
+	{
+		if (!pChild)
+		{
+			return;
+		}
+
+		CASTNode* pNewChild = _foldStatement(pChild);
+
+		if (pNewChild == pChild)
+		{
+			return;
+		}
+
+		if (!pNewChild)
+		{
+			pParent->RemoveChild(pChild);
+
+			return;
+		}
+
+		pParent->ReplaceChild(pChild, pNewChild);
+	}
+
+	CASTNode* CConstantFolder::_evalConstantExpression(CASTExpressionNode* pExpr)
+	{
+		auto evalResult = mpInterpreter->EvalValue(pExpr, mpSymTable);
+
+		if (evalResult.HasError())
+		{
+			return pExpr;
+		}
+
+		CASTNode* pLiteral = _createLiteral(evalResult.Get());
+
+		return pLiteral ? pLiteral : pExpr;
+	}
+
+	CASTNode* CConstantFolder::_createLiteral(const TConstValue& value)
+	{
+		CBaseValue* pValue = nullptr;
+
+		switch (value.mType)
+		{
+			case CT_INT32:
+			case CT_INT64:
+				pValue = new CIntValue(std::get<I64>(value.mValue), value.mType == CT_INT64);
+				break;
+			case CT_UINT32:
+			case CT_UINT64:
+				pValue = new CUIntValue(std::get<U64>(value.mValue), value.mType == CT_UINT64);
+				break;
+			case CT_FLOAT:
+				pValue = new CFloatValue(static_cast<F32>(std::get<F64>(value.mValue)));
+				break;
+			case CT_DOUBLE:
+				pValue = new CDoubleValue(std::get<F64>(value.mValue));
+				break;
+			case CT_BOOL:
+				pValue = new CBoolValue(std::get<bool>(value.mValue));
+				break;
+			default:
+				// \note there are no literals of other types
+				return nullptr;
+		}
+
+		return mpNodesFactory->CreateUnaryExpr(TT_DEFAULT, mpNodesFactory->CreateLiteralNode(pValue));
+	}
+
+	CBaseValue* CConstantFolder::_getConstantValue(CASTNode* pNode) const
+	{
+		auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode);
+
+		while (pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT)
+		{
+			pNode      = pUnaryExpr->GetData();
+			pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode);
+		}
+
+		auto pLiteral = dynamic_cast<CASTLiteralNode*>(pNode);
+
+		if (!pLiteral)
+		{
+			return nullptr;
+		}
+
+		CBaseValue* pValue = pLiteral->GetValue();
+
+		switch (pValue->GetType())
+		{
+			case LT_INT:
+			case LT_UINT:
+			case LT_FLOAT:
+			case LT_DOUBLE:
+			case LT_BOOLEAN:
+				return pValue;
+		}
+
+		// \note strings, chars and pointers aren't folded
+		return nullptr;
+	}
+
+	bool CConstantFolder::_isConstantValueEqualTo(CASTNode* pNode, I32 value) const
+	{
+		CBaseValue* pValue = _getConstantValue(pNode);
+
+		if (!pValue)
+		{
+			return false;
+		}
+
+		switch (pValue->GetType())
+		{
+			case LT_INT:
+				return dynamic_cast<CIntValue*>(pValue)->GetValue() == value;
+			case LT_UINT:
+				return dynamic_cast<CUIntValue*>(pValue)->GetValue() == static_cast<U64>(value);
+			case LT_FLOAT:
+				return dynamic_cast<CFloatValue*>(pValue)->GetValue() == static_cast<F32>(value);
+			case LT_DOUBLE:
+				return dynamic_cast<CDoubleValue*>(pValue)->GetValue() == static_cast<F64>(value);
+		}
+
+		return false;
+	}
+}
@@ -0,0 +1,424 @@
+#include "parser/gplcFunctionAttributesAnalyser.h"
+#include "parser/gplcASTNodes.h"
+#include "common/gplcSymTable.h"
+#include "common/gplcTypeSystem.h"
+#include <algorithm>
+
+
+namespace gplc
+{
+	/*!
+		\brief CFunctionAttributesAnalyser's definition
+	*/
+
+	Result CFunctionAttributesAnalyser::Analyze(CASTSourceUnitNode* pSourceUnit, ISymTable* pSymTable)
+	{
+		if (!pSourceUnit || !pSymTable)
+		{
+			return RV_INVALID_ARGUMENTS;
+		}
+
+		mpSymTable = pSymTable;
+
+		mFunctions.clear();
+		mFunctionsIndices.clear();
+		mLocalScopes.clear();
+
+		// \note symbols are looked up from the module's scope, locals of functions are tracked by the pass itself
+		Result result = mpSymTable->VisitNamedScopeWithRestore(pSourceUnit->GetModuleName(), [this, pSourceUnit](ISymTable* pSymTable)
+		{
+			for (auto pCurrStatement : pSourceUnit->GetStatements())
+			{
+				if (auto pFuncDefinition = dynamic_cast<CASTFuncDefinitionNode*>(pCurrStatement))
+				{
+					_analyzeFunction(pFuncDefinition);
+				}
+			}
+		});
+
+		if (!SUCCESS(result))
+		{
+			return result;
+		}
+
+		_propagateEffects();
+
+		for (auto& currFunction : mFunctions)
+		{
+			switch (currFunction.mEffects)
+			{
+				case ME_NONE:
+					currFunction.mpDefinition->SetAttribute(AV_READNONE);
+					break;
+				case ME_READ_ONLY:
+					currFunction.mpDefinition->SetAttribute(AV_READONLY);
+					break;
+			}
+		}
+
+		return RV_SUCCESS;
+	}
+
+	void CFunctionAttributesAnalyser::_analyzeFunction(CASTFuncDefinitionNode* pNode)
+	{
+		U32 prevFunctionIndex = mCurrFunctionIndex;
+
+		TLocalScopesArray prevLocalScopes = std::move(mLocalScopes);
+
+		mCurrFunctionIndex = static_cast<U32>(mFunctions.size());
+
+		mFunctionsIndices[pNode] = mCurrFunctionIndex;
+		mFunctions.push_back({ pNode });
+
+		// \note locals of an enclosing function aren't visible here, captured variables are treated as global ones
+		mLocalScopes = { {} };
+
+		// \note the function's own name is declared to recognize recursive calls of nested functions
+		_declareLocals(pNode->GetDeclaration(), pNode);
+
+		if (auto pArgs = pNode->GetLambdaTypeInfo()->GetArgs())
+		{
+			for (auto pCurrArg : pArgs->GetChildren())
+			{
+				_declareLocals(pCurrArg);
+			}
+		}
+
+		_analyzeBlock(dynamic_cast<CASTBlockNode*>(pNode->GetValue()));
+
+		mLocalScopes       = std::move(prevLocalScopes);
+		mCurrFunctionIndex = prevFunctionIndex;
+	}
+
+	void CFunctionAttributesAnalyser::_analyzeStatement(CASTNode* pNode)
+	{
+		if (!pNode)
+		{
+			return;
+		}
+
+		switch (pNode->GetType())
+		{
+			case NT_DEFINITION:
+				if (auto pFuncDefinition = dynamic_cast<CASTFuncDefinitionNode*>(pNode))
+				{
+					_declareLocals(pFuncDefinition->GetDeclaration(), pFuncDefinition);
+					_analyzeFunction(pFuncDefinition);
+
+					return;
+				}
+
+				// \note the value is analysed first, because x := x refers to a previously declared variable
+				_analyzeExpression(dynamic_cast<CASTDefinitionNode*>(pNode)->GetValue());
+				_declareLocals(dynamic_cast<CASTDefinitionNode*>(pNode)->GetDeclaration());
+				return;
+			case NT_DECL:
+				_declareLocals(pNode);
+				return;
+			case NT_ASSIGNMENT:
+				{
+					auto pAssignment = dynamic_cast<CASTAssignmentNode*>(pNode);
+
+					_analyzeStoreTarget(pAssignment->GetLeft());
+					_analyzeExpression(pAssignment->GetRight());
+				}
+				return;
+			case NT_IF_STATEMENT:
+				{
+					auto pIfStatement = dynamic_cast<CASTIfStatementNode*>(pNode);
+
+					_analyzeExpression(pIfStatement->GetCondition());
+					_analyzeBlock(pIfStatement->GetThenBlock());
+					_analyzeBlock(pIfStatement->GetElseBlock());
+				}
+				return;
+			case NT_LOOP_STATEMENT:
+				_analyzeBlock(dynamic_cast<CASTLoopStatementNode*>(pNode)->GetBody());
+				return;
+			case NT_WHILE_STATEMENT:
+				{
+					auto pWhileStatement = dynamic_cast<CASTWhileLoopStatementNode*>(pNode);
+
+					_analyzeExpression(pWhileStatement->GetCondition());
+					_analyzeBlock(pWhileStatement->GetBody());
+				}
+				return;
+			case NT_BLOCK:
+				_analyzeBlock(dynamic_cast<CASTBlockNode*>(pNode));
+				return;
+			case NT_RETURN_STATEMENT:
+			case NT_DEFER_OPERATOR:
+				_analyzeStatement(pNode->GetChildrenCount() ? pNode->GetChildren()[0] : nullptr);
+				return;
+			case NT_BREAK_OPERATOR:
+			case NT_CONTINUE_OPERATOR:
+			case NT_ENUM_DECL:
+			case NT_STRUCT_DECL:
+			case NT_VARIANT_DECL:
+			case NT_IMPORT:
+				return;
+		}
+
+		_analyzeExpression(pNode);
+	}
+
+	void CFunctionAttributesAnalyser::_analyzeBlock(CASTBlockNode* pBlock)
+	{
+		if (!pBlock)
+		{
+			return;
+		}
+
+		mLocalScopes.push_back({});
+
+		for (auto pCurrStatement : pBlock->GetStatements())
+		{
+			_analyzeStatement(pCurrStatement);
+		}
+
+		mLocalScopes.pop_back();
+	}
+
+	void CFunctionAttributesAnalyser::_analyzeExpression(CASTNode* pNode)
+	{
+		if (!pNode)
+		{
+			return;
+		}
+
+		switch (pNode->GetType())
+		{
+			case NT_IDENTIFIER:
+				{
+					const std::string& name = dynamic_cast<CASTIdentifierNode*>(pNode)->GetName();
+
+					if (_isLocal(name))
+					{
+						return;
+					}
+
+					const TSymbolDesc* pSymbolDesc = mpSymTable->LookUp(name);
+
+					// \note an address of a function which is never reassigned is a constant
+					if (pSymbolDesc && pSymbolDesc->mpFuncDefinition && !pSymbolDesc->mIsReassigned)
+					{
+						return;
+					}
+
+					_addEffects(ME_READ_ONLY);
+				}
+				return;
+			case NT_LITERAL:
+			case NT_SIZEOF_OPERATOR:
+			case NT_TYPEID_OPERATOR:
+				return;
+			case NT_FUNC_CALL:
+				_analyzeFunctionCall(pNode);
+				return;
+			case NT_ACCESS_OPERATOR:
+				{
+					CASTExpressionNode* pExpression = dynamic_cast<CASTAccessOperatorNode*>(pNode)->GetExpression();
+
+					// \note enumerators are constants
+					if (_isEnumeration(pExpression))
+					{
+						return;
+					}
+
+					_addEffects(ME_READ_ONLY);
+					_analyzeExpression(pExpression);
+				}
+				return;
+			case NT_INDEXED_ACCESS_OPERATOR:
+				{
+					auto pIndexedAccess = dynamic_cast<CASTIndexedAccessOperatorNode*>(pNode);
+
+					// \note storage of arrays isn't tracked, so any access to an element is treated as a read of memory
+					_addEffects(ME_READ_ONLY);
+					_analyzeExpression(pIndexedAccess->GetExpression());
+					_analyzeExpression(pIndexedAccess->GetIndexExpression());
+				}
+				return;
+			case NT_UNARY_EXPR:
+				{
+					auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode);
+
+					if (pUnaryExpr->GetOpType() == TT_STAR)
+					{
+						_addEffects(ME_READ_ONLY);
+					}
+
+					_analyzeExpression(pUnaryExpr->GetData());
+				}
+				return;
+			case NT_CAST_INTRINSIC:
+				// \note the first argument is a type
+				_analyzeExpression(dynamic_cast<CASTIntrinsicCallNode*>(pNode)->GetArgs()->GetChildren()[1]);
+				return;
+			case NT_MEMCPY32_INTRINSIC:
+			case NT_MEMCPY64_INTRINSIC:
+			case NT_MEMSET32_INTRINSIC:
+			case NT_MEMSET64_INTRINSIC:
+			case NT_ABORT_INTRINSIC:
+				_addEffects(ME_UNKNOWN);
+				return;
+		}
+
+		for (auto pCurrChild : pNode->GetChildren())
+		{
+			_analyzeExpression(pCurrChild);
+		}
+	}
+
+	void CFunctionAttributesAnalyser::_analyzeStoreTarget(CASTNode* pNode)
+	{
+		CASTFuncDefinitionNode* pFuncDefinition = nullptr;
+
+		const std::string name = _getPlainIdentifierName(pNode);
+
+		// \note a store into a nested function's variable makes its calls indirect
+		if (name.empty() || !_isLocal(name, &pFuncDefinition) || pFuncDefinition)
+		{
+			_addEffects(ME_UNKNOWN);
+		}
+	}
+
+	void CFunctionAttributesAnalyser::_analyzeFunctionCall(CASTNode* pNode)
+	{
+		auto pCallNode = dynamic_cast<CASTFunctionCallNode*>(pNode);
+
+		if (auto pArgs = pCallNode->GetArgs())
+		{
+			for (auto pCurrArg : pArgs->GetChildren())
+			{
+				_analyzeExpression(pCurrArg);
+			}
+		}
+
+		const std::string name = _getPlainIdentifierName(pCallNode->GetIdentifier());
+
+		CASTFuncDefinitionNode* pCallee = nullptr;
+
+		if (!name.empty() && !_isLocal(name, &pCallee))
+		{
+			const TSymbolDesc* pSymbolDesc = mpSymTable->LookUp(name);
+
+			// \note native, imported and reassigned functions can do anything
+			if (pSymbolDesc && !pSymbolDesc->mIsReassigned && !(pSymbolDesc->mpType->GetAttributes() & AV_NATIVE_FUNC))
+			{
+				pCallee = pSymbolDesc->mpFuncDefinition;
+			}
+		}
+
+		if (!pCallee)
+		{
+			_addEffects(ME_UNKNOWN);
+
+			return;
+		}
+
+		mFunctions[mCurrFunctionIndex].mCallees.push_back(pCallee);
+	}
+
+	void CFunctionAttributesAnalyser::_declareLocals(CASTNode* pDeclaration, CASTFuncDefinitionNode* pFuncDefinition)
+	{
+		auto pDeclarationNode = dynamic_cast<CASTDeclarationNode*>(pDeclaration);
+
+		if (!pDeclarationNode || !pDeclarationNode->GetIdentifiers())
+		{
+			return;
+		}
+
+		TLocalScope& currScope = mLocalScopes.back();
+
+		for (auto pCurrIdentifier : pDeclarationNode->GetIdentifiers()->GetChildren())
+		{
+			currScope[dynamic_cast<CASTIdentifierNode*>(pCurrIdentifier)->GetName()] = pFuncDefinition;
+		}
+	}
+
+	bool CFunctionAttributesAnalyser::_isLocal(const std::string& name, CASTFuncDefinitionNode** ppFuncDefinition) const
+	{
+		for (auto iter = mLocalScopes.crbegin(); iter != mLocalScopes.crend(); ++iter)
+		{
+			auto symbolIter = iter->find(name);
+
+			if (symbolIter == iter->cend())
+			{
+				continue;
+			}
+
+			if (ppFuncDefinition)
+			{
+				*ppFuncDefinition = symbolIter->second;
+			}
+
+			return true;
+		}
+
+		return false;
+	}
+
+	bool CFunctionAttributesAnalyser::_isEnumeration(CASTNode* pNode) const
+	{
+		const std::string name = _getPlainIdentifierName(pNode);
+
+		if (name.empty() || _isLocal(name))
+		{
+			return false;
+		}
+
+		auto pScopeEntry = mpSymTable->LookUpNamedScope(name);
+
+		return pScopeEntry && pScopeEntry->mpType && pScopeEntry->mpType->GetType() == CT_ENUM;
+	}
+
+	std::string CFunctionAttributesAnalyser::_getPlainIdentifierName(CASTNode* pNode) const
+	{
+		auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode);
+
+		while (pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT)
+		{
+			pNode      = pUnaryExpr->GetData();
+			pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pNode);
+		}
+
+		auto pIdentifier = dynamic_cast<CASTIdentifierNode*>(pNode);
+
+		return pIdentifier ? pIdentifier->GetName() : "";
+	}
+
+	void CFunctionAttributesAnalyser::_addEffects(E_MEMORY_EFFECTS effects)
+	{
+		TFunctionInfo& currFunction = mFunctions[mCurrFunctionIndex];
+
+		currFunction.mEffects = std::max(currFunction.mEffects, effects);
+	}
+
+	void CFunctionAttributesAnalyser::_propagateEffects()
+	{
+		bool isChanged = true;
+
+		while (isChanged)
+		{
+			isChanged = false;
+
+			for (auto& currFunction : mFunctions)
+			{
+				for (auto pCurrCallee : currFunction.mCallees)
+				{
+					auto calleeIter = mFunctionsIndices.find(pCurrCallee);
+
+					// \note a function which is defined in another module isn't analysed
+					E_MEMORY_EFFECTS calleeEffects = (calleeIter == mFunctionsIndices.cend()) ? ME_UNKNOWN : mFunctions[calleeIter->second].mEffects;
+
+					if (calleeEffects > currFunction.mEffects)
+					{
+						currFunction.mEffects = calleeEffects;
+						isChanged             = true;
+					}
+				}
+			}
+		}
+	}
+}
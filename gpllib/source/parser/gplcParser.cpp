@@ -692,7 +692,17 @@ namespace gplc
 		// indexed access to an aggregate type
 		if (_match(pLexer->GetCurrToken(), TT_OPEN_SQR_BRACE))
 		{
-			return _parseIndexedAccessOperator(pPrimaryNode, pLexer, attributes);
+			auto pIndexedAccessNode = _parseIndexedAccessOperator(pPrimaryNode, pLexer, attributes);
+
+			// access to a field of an array's element, arr[i].field, the element itself is used as an address, so it shouldn't be loaded
+			if (pIndexedAccessNode && _match(pLexer->GetCurrToken(), TT_POINT))
+			{
+				pIndexedAccessNode->ResetAttribute(AV_RVALUE);
+
+				return _parseAccessOperator(pIndexedAccessNode, pLexer, attributes);
+			}
+
+			return pIndexedAccessNode;
 		}
 
 		return pPrimaryNode;
@@ -804,6 +814,10 @@ namespace gplc
 	
 	CASTLoopStatementNode* CParser::_parseLoopStatement(ILexer* pLexer)
 	{
+		TLoopHints hints;
+
+		U32 attributes = _parseAttributes(pLexer, &hints);
+
 		if (!SUCCESS(_expect(TT_OPEN_BRACE, pLexer->GetCurrToken())))
 		{
 			return nullptr;
@@ -820,11 +834,18 @@ namespace gplc
 
 		pLexer->GetNextToken(); // take }
 
-		return mpNodesFactory->CreateLoopStmtNode(pBodyBlock);
+		CASTLoopStatementNode* pLoopNode = mpNodesFactory->CreateLoopStmtNode(pBodyBlock, hints);
+		pLoopNode->SetAttribute(attributes);
+
+		return pLoopNode;
 	}
 	   
 	CASTWhileLoopStatementNode* CParser::_parseWhileLoopStatement(ILexer* pLexer)
 	{
+		TLoopHints hints;
+
+		U32 attributes = _parseAttributes(pLexer, &hints);
+
 		CASTExpressionNode* pCondition = _parseExpression(pLexer, AV_RVALUE);
 
 		if (!SUCCESS(_expect(TT_OPEN_BRACE, pLexer->GetCurrToken())))
@@ -843,7 +864,10 @@ namespace gplc
 
 		pLexer->GetNextToken(); // take }
 
-		return mpNodesFactory->CreateWhileStmtNode(pCondition, pBodyBlock);
+		CASTWhileLoopStatementNode* pLoopNode = mpNodesFactory->CreateWhileStmtNode(pCondition, pBodyBlock, hints);
+		pLoopNode->SetAttribute(attributes);
+
+		return pLoopNode;
 	}
 
 	CASTFunctionDeclNode* CParser::_parseFunctionDeclaration(ILexer* pLexer, bool allowCapture, bool isFunctionPrototype, U32 attributes)
@@ -1115,6 +1139,7 @@ namespace gplc
 			TSymbolDesc* pCurrEnumerator = mpSymTable->LookUp(currFieldHandle);
 
 			pCurrEnumerator->mpType = mpTypesFactory->CreateType(CT_INT32, BTS_INT32, 0x0);
+			pCurrEnumerator->mIsConstant = true;
 
 			pLexer->GetNextToken(); // take identifier
 
@@ -1164,6 +1189,8 @@ namespace gplc
 
 	CASTStructDeclNode* CParser::_parseStructDeclaration(ILexer* pLexer)
 	{
+		U32 attributes = _parseAttributes(pLexer);
+
 		if (!SUCCESS(_expect(TT_IDENTIFIER, pLexer->GetCurrToken())))
 		{
 			return nullptr;
@@ -1195,7 +1222,7 @@ namespace gplc
 
 		pLexer->GetNextToken(); // take }
 
-		return mpNodesFactory->CreateStructDeclNode(pStructIdentifier, pStructFields);
+		return mpNodesFactory->CreateStructDeclNode(pStructIdentifier, pStructFields, attributes);
 	}
 
 	CASTBlockNode* CParser::_parseStructFields(const std::string& structName, ILexer* pLexer)
@@ -1386,12 +1413,15 @@ namespace gplc
 		return mpNodesFactory->CreateImportDirective(dynamic_cast<CStringValue*>(pLiteralToken->GetValue())->GetValue(), pModuleName->GetName());
 	}
 
-	U32 CParser::_parseAttributes(ILexer* pLexer)
+	U32 CParser::_parseAttributes(ILexer* pLexer, TLoopHints* pLoopHints)
 	{
 		const CToken* pCurrToken = nullptr;
 
 		U32 attributes = 0x0;
 
+		// \note hints of anything except loops are parsed to skip their arguments, but they're reported as errors
+		TLoopHints ignoredHints;
+
 		// try to parse an @ attribute
 		while (_match(pLexer->GetCurrToken(), TT_AT_SIGN))
 		{
@@ -1399,7 +1429,14 @@ namespace gplc
 
 			pCurrToken = pLexer->GetCurrToken();
 
-			switch (pCurrToken->GetType())
+			const E_TOKEN_TYPE attributeType = pCurrToken->GetType();
+
+			if (!pLoopHints && (attributeType == TT_VECTORIZE_KEYWORD || attributeType == TT_NOVECTORIZE_KEYWORD || attributeType == TT_UNROLL_KEYWORD))
+			{
+				OnErrorOutput.Invoke({ PE_LOOP_HINT_OUTSIDE_LOOP, pCurrToken->GetPos(), pCurrToken->GetLine() });
+			}
+
+			switch (attributeType)
 			{
 				case TT_FOREIGN_KEYWORD:
 					pLexer->GetNextToken(); // take foreign
@@ -1411,6 +1448,66 @@ namespace gplc
 
 					attributes |= AV_KEEP_UNINITIALIZED;
 					break;
+				case TT_PACKED_KEYWORD:
+					pLexer->GetNextToken();
+
+					attributes |= AV_PACKED_LAYOUT;
+					break;
+				case TT_REORDER_KEYWORD:
+					pLexer->GetNextToken();
+
+					attributes |= AV_REORDER_FIELDS;
+					break;
+				case TT_SOA_KEYWORD:
+					pLexer->GetNextToken();
+
+					attributes |= AV_SOA_LAYOUT;
+					break;
+				case TT_UNCHECKED_KEYWORD:
+					pLexer->GetNextToken();
+
+					attributes |= AV_UNCHECKED_ACCESS;
+					break;
+				case TT_VECTORIZE_KEYWORD:
+					pLexer->GetNextToken();
+
+					if (!_parseAttributeArgument(pLexer, (pLoopHints ? pLoopHints : &ignoredHints)->mVectorizeWidth))
+					{
+						return attributes;
+					}
+
+					attributes |= AV_VECTORIZE;
+					break;
+				case TT_NOVECTORIZE_KEYWORD:
+					pLexer->GetNextToken();
+
+					attributes |= AV_NO_VECTORIZE;
+					break;
+				case TT_UNROLL_KEYWORD:
+					pLexer->GetNextToken();
+
+					if (!_parseAttributeArgument(pLexer, (pLoopHints ? pLoopHints : &ignoredHints)->mUnrollCount))
+					{
+						return attributes;
+					}
+
+					attributes |= AV_UNROLL;
+					break;
+				case TT_RESTRICT_KEYWORD:
+					pLexer->GetNextToken();
+
+					attributes |= AV_RESTRICT;
+					break;
+				case TT_INLINE_KEYWORD:
+					pLexer->GetNextToken();
+
+					attributes |= AV_INLINE;
+					break;
+				case TT_NOINLINE_KEYWORD:
+					pLexer->GetNextToken();
+
+					attributes |= AV_NO_INLINE;
+					break;
 				default:
 					UNIMPLEMENTED();	// \todo implement this case, it should be parsing error here
 					break;
@@ -1420,6 +1517,45 @@ namespace gplc
 		return attributes;
 	}
 
+	bool CParser::_parseAttributeArgument(ILexer* pLexer, U32& value)
+	{
+		if (!_match(pLexer->GetCurrToken(), TT_OPEN_BRACKET))
+		{
+			return true;
+		}
+
+		pLexer->GetNextToken(); // take (
+
+		if (!SUCCESS(_expect(TT_LITERAL, pLexer->GetCurrToken())))
+		{
+			return false;
+		}
+
+		auto pIntValue = dynamic_cast<CIntValue*>(dynamic_cast<const CLiteralToken*>(pLexer->GetCurrToken())->GetValue());
+
+		if (!pIntValue || pIntValue->GetValue() <= 0)
+		{
+			const CToken* pCurrToken = pLexer->GetCurrToken();
+
+			OnErrorOutput.Invoke({ PE_UNEXPECTED_TOKEN, pCurrToken->GetPos(), pCurrToken->GetLine(), { TParserErrorInfo::TUnexpectedTokenInfo { TT_LITERAL, TT_LITERAL } } });
+
+			return false;
+		}
+
+		value = static_cast<U32>(pIntValue->GetValue());
+
+		pLexer->GetNextToken(); // take a literal
+
+		if (!SUCCESS(_expect(TT_CLOSE_BRACKET, pLexer->GetCurrToken())))
+		{
+			return false;
+		}
+
+		pLexer->GetNextToken(); // take )
+
+		return true;
+	}
+
 	CASTIntrinsicCallNode* CParser::_parseIntrinsicCall(ILexer* pLexer)
 	{
 		const CToken* pCurrToken = pLexer->GetCurrToken();
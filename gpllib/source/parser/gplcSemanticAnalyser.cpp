@@ -157,6 +157,13 @@ namespace gplc
 
 		switch (pNode->GetOpType())
 		{
+			case TT_AMPERSAND:
+				// \note the function can be changed through the pointer
+				if (!_markReassignedFunction(pDataNode, pDataType))
+				{
+					return false;
+				}
+				break;
 			case TT_STAR: ///< dereferencing
 				// \note this case is just a simple typo
 				if (pDataType->GetType() != CT_POINTER)
@@ -226,6 +233,11 @@ namespace gplc
 			return false;
 		}
 
+		if (!_markReassignedFunction(pLeftExpr, pLeftValueType))
+		{
+			return false;
+		}
+
 		// \note if we assign an address to a pointer and it was unitinialized, we need to remove
 		// AV_INVALID_POINTER mark, because now it's absolutely correct
 		if ((pLeftValueType->GetType() == CT_POINTER) && (pLeftValueType->GetAttributes() & AV_INVALID_POINTER))
@@ -515,6 +527,14 @@ namespace gplc
 		{
 			return false;
 		}
+
+		// \note the definition is stored to allow the constant expressions interpreter to evaluate calls of the function
+		const std::string& funcIdentifier = dynamic_cast<CASTIdentifierNode*>(pDeclaration->GetIdentifiers()->GetChildren()[0])->GetName();
+
+		if (TSymbolDesc* pFuncSymbolDesc = mpSymTable->LookUp(mpSymTable->GetSymbolHandleByName(funcIdentifier)))
+		{
+			pFuncSymbolDesc->mpFuncDefinition = pNode;
+		}
 		
 		mpSymTable->CreateScope();
 
@@ -595,10 +615,16 @@ namespace gplc
 		auto pPrimary   = pNode->GetExpression();
 		auto pFieldExpr = pNode->GetMemberName();
 
+		// \note an element of @soa array can't be accessed as a whole, but arr[i].field is allowed, so check up only the array and the index
+		auto pIndexedAccessExpr = dynamic_cast<CASTIndexedAccessOperatorNode*>(pPrimary);
+
+		const bool isPrimaryValid = pIndexedAccessExpr ? (pIndexedAccessExpr->GetExpression()->Accept(this) && pIndexedAccessExpr->GetIndexExpression()->Accept(this)) :
+														 pPrimary->Accept(this);
+
 		// resolve the expression
 		CType* pType = nullptr;
 
-		if (!pPrimary->Accept(this) || !(pType = mpTypeResolver->Resolve(pPrimary)))
+		if (!isPrimaryValid || !(pType = mpTypeResolver->Resolve(pPrimary)))
 		{
 			return false;
 		}
@@ -622,6 +648,18 @@ namespace gplc
 		{
 			const std::string& identifier = pIdentifier->GetName();
 
+			// \note symbols of imported modules are declared on their first lookup, so it precedes checks of the scope's tables
+			if (type == CT_MODULE)
+			{
+				mpSymTable->VisitNamedScopeWithRestore(pType->GetName(), [&identifier](ISymTable* pSymTable)
+				{
+					if (!pSymTable->LookUp(identifier))
+					{
+						pSymTable->LookUpNamedScope(identifier);
+					}
+				});
+			}
+
 			if (pSymbolDesc->mVariables.find(identifier) == pSymbolDesc->mVariables.cend())
 			{
 				if (pSymbolDesc->mNamedScopes.find(identifier) == pSymbolDesc->mNamedScopes.cend())
@@ -644,7 +682,24 @@ namespace gplc
 
 	bool CSemanticAnalyser::VisitIndexedAccessOperator(CASTIndexedAccessOperatorNode* pNode)
 	{
-		// \todo implement the method
+		auto pArrayExpr = pNode->GetExpression();
+
+		if (!pArrayExpr->Accept(this) || !pNode->GetIndexExpression()->Accept(this))
+		{
+			return false;
+		}
+
+		CArrayType* pArrayType = dynamic_cast<CArrayType*>(mpTypeResolver->Resolve(pArrayExpr));
+
+		// \note elements of @soa arrays are spread among fields' arrays, so only arr[i].field is allowed
+		if (pArrayType && pArrayType->GetSoAElementType())
+		{
+			_notifyError(SAE_SOA_ELEMENT_ACCESS_IS_NOT_ALLOWED);
+
+			return false;
+		}
+
+		// \todo implement the rest checks
 		return true;
 	}
 
@@ -746,6 +801,51 @@ namespace gplc
 		return result;
 	}
 
+	bool CSemanticAnalyser::_markReassignedFunction(CASTNode* pExpr, CType* pExprType)
+	{
+		if (!pExprType || pExprType->GetType() != CT_FUNCTION)
+		{
+			return true;
+		}
+
+		auto pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pExpr);
+
+		while (pUnaryExpr && pUnaryExpr->GetOpType() == TT_DEFAULT)
+		{
+			pExpr      = pUnaryExpr->GetData();
+			pUnaryExpr = dynamic_cast<CASTUnaryExpressionNode*>(pExpr);
+		}
+
+		// \note a module calls its functions directly, so a new value of Module.f wouldn't be seen by the module itself
+		if (auto pAccessExpr = dynamic_cast<CASTAccessOperatorNode*>(pExpr))
+		{
+			CType* pPrimaryType = mpTypeResolver->Resolve(pAccessExpr->GetExpression());
+
+			if (pPrimaryType && pPrimaryType->GetType() == CT_MODULE)
+			{
+				_notifyError(SAE_IMPORTED_FUNCTION_CANNOT_BE_REASSIGNED);
+
+				return false;
+			}
+
+			return true;
+		}
+
+		auto pIdentifier = dynamic_cast<CASTIdentifierNode*>(pExpr);
+
+		if (!pIdentifier)
+		{
+			return true;
+		}
+
+		if (TSymbolDesc* pFuncSymbolDesc = mpSymTable->LookUp(mpSymTable->GetSymbolHandleByName(pIdentifier->GetName())))
+		{
+			pFuncSymbolDesc->mIsReassigned = true;
+		}
+
+		return true;
+	}
+
 	void CSemanticAnalyser::_lockSymbolTable(const std::function<void()>& action, bool lockSymTable)
 	{
 		if (lockSymTable)
@@ -1,5 +1,6 @@
 #include "utils/Utils.h"
 #include "lexer/gplcTokens.h"
+#include "llvm/ADT/StringExtras.h"
 
 
 namespace gplc
@@ -53,6 +54,8 @@ namespace gplc
 				return "Some of input arguments of IParser::Parse method are invalid";
 			case PE_INVALID_TYPE:
 				return "Invalid type has found";
+			case PE_LOOP_HINT_OUTSIDE_LOOP:
+				return "Hints @vectorize, @novectorize and @unroll are allowed only for loops";
 		}
 
 		return {};
@@ -92,8 +95,40 @@ namespace gplc
 				return "Try to dereference a non-pointer type";
 			case SAE_TRY_TO_REREF_INVALID_POINTER:
 				return "Try to dereference either invalid or dangling pointer";
+			case SAE_SOA_ELEMENT_ACCESS_IS_NOT_ALLOWED:
+				return "An element of @soa array can be accessed only through its fields";
+			case SAE_DIVISION_BY_ZERO_IN_CONST_EXPR:
+				return "Division by zero within a constant expression";
+			case SAE_INTEGER_OVERFLOW_IN_CONST_EXPR:
+				return "The constant expression's value doesn't fit into its type";
+			case SAE_IMPORTED_FUNCTION_CANNOT_BE_REASSIGNED:
+				return "A function of an imported module cannot be reassigned";
 		}
 
 		return {};
 	}
+
+
+	CDigestBuilder& CDigestBuilder::Append(const std::string& value)
+	{
+		return Append(reinterpret_cast<const U8*>(value.data()), value.size());
+	}
+
+	CDigestBuilder& CDigestBuilder::Append(const U8* pData, size_t size)
+	{
+		const U64 length = size;
+
+		mHasher.update(llvm::ArrayRef<U8>(reinterpret_cast<const U8*>(&length), sizeof(length)));
+		mHasher.update(llvm::ArrayRef<U8>(pData, size));
+
+		return *this;
+	}
+
+	std::string CDigestBuilder::GetDigest() const
+	{
+		// \note the hasher can't be appended after it's finalized, so a copy of it is used
+		llvm::SHA1 hasher(mHasher);
+
+		return llvm::toHex(hasher.final(), true);
+	}
 }
\ No newline at end of file
@@ -1,5 +1,14 @@
 #include <catch2/catch.hpp>
 #include <gplc.h>
+#include "../lexer/stubInputStream.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/CFG.h"
+#include "llvm/IR/Verifier.h"
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
 
 
 using namespace gplc;
@@ -7,36 +16,925 @@ using namespace gplc;
 
 TEST_CASE("CLLVMCodeGenerator tests")
 {
-	ICodeGenerator* pCodeGenerator = new CLLVMCodeGenerator();
+	ICodeGenerator*        pCodeGenerator    = new CLLVMCodeGenerator();
+	ISymTable*             pSymTable         = new CSymTable();
+	ITypesFactory*         pTypesFactory     = new CTypesFactory(GetHostTargetAlignments());
+	IASTNodesFactory*      pNodesFactory     = new CASTNodesFactory();
+	ITypeResolver*         pTypeResolver     = new CTypeResolver();
+	IConstExprInterpreter* pInterpreter      = new CConstExprInterpreter();
+	ILexer*                pLexer            = new CLexer();
+	IParser*               pParser           = new CParser();
+	ISemanticAnalyser*     pSemanticAnalyser = new CSemanticAnalyser();
+	IModuleResolver*       pModuleResolver   = new CModuleResolver();
 
-	SECTION("TestGenerate_PassEmptyProgram_ReturnsBytecode")
+	IFunctionAttributesAnalyser* pFunctionAttributesAnalyser = new CFunctionAttributesAnalyser();
+
+	pTypeResolver->Init(pSymTable, pInterpreter, pTypesFactory);
+	pInterpreter->Init(pTypeResolver);
+
+	pSymTable->AddVariable({ "puts", nullptr, pTypesFactory->CreateFunctionType({ { "str", pTypesFactory->CreateType(CT_STRING, BTS_POINTER, 0x0) } },
+																				pTypesFactory->CreateType(CT_INT32, BTS_INT32, 0x0), AV_NATIVE_FUNC) });
+
+	// \note the same stages as the compiler's driver runs for a single module, imports are declared by the callback after parsing
+	auto compile = [=](const std::vector<std::string>& lines, const std::string& moduleName = "test",
+					   const std::function<void()>& declareImports = nullptr) -> llvm::Module*
+	{
+		IInputStream* pInputStream = new CStubInputStream(lines);
+
+		REQUIRE(pLexer->Init(pInputStream) == RV_SUCCESS);
+
+		pSymTable->CreateNamedScope(moduleName);
+		pModuleResolver->ResolveModuleType(pSymTable, pTypesFactory, moduleName);
+
+		auto pSourceUnit = dynamic_cast<CASTSourceUnitNode*>(pParser->Parse(pLexer, pSymTable, pNodesFactory, pTypesFactory, moduleName));
+		REQUIRE(pSourceUnit);
+
+		if (declareImports)
+		{
+			declareImports();
+		}
+
+		REQUIRE(pSemanticAnalyser->Analyze(pSourceUnit, pTypeResolver, pSymTable, pNodesFactory));
+		REQUIRE(pFunctionAttributesAnalyser->Analyze(pSourceUnit, pSymTable) == RV_SUCCESS);
+
+		auto pModule = std::get<llvm::Module*>(pCodeGenerator->Generate(pSourceUnit, pSymTable, pTypeResolver, pInterpreter, [](ICodeGenerator* pCodeGenerator)
+		{
+			return RV_SUCCESS;
+		}));
+
+		pSymTable->LeaveScope();
+
+		delete pInputStream;
+
+		REQUIRE(pModule);
+		REQUIRE(!llvm::verifyModule(*pModule));
+
+		return pModule;
+	};
+
+	// \note returns arguments of all puts calls within the module in order of their appearance
+	auto getPrintedMessages = [](const llvm::Module* pModule)
+	{
+		std::vector<std::string> messages;
+
+		for (const llvm::Function& currFunction : *pModule)
+		{
+			for (const llvm::BasicBlock& currBlock : currFunction)
+			{
+				for (const llvm::Instruction& currInstruction : currBlock)
+				{
+					auto pCall = llvm::dyn_cast<llvm::CallInst>(&currInstruction);
+
+					if (!pCall || !pCall->getCalledFunction() || pCall->getCalledFunction()->getName() != "puts")
+					{
+						continue;
+					}
+
+					const llvm::Value* pArgument = pCall->getArgOperand(0)->stripPointerCasts();
+
+					// \note a local variable is passed, its message is the literal which the variable is initialized with
+					if (auto pLoad = llvm::dyn_cast<llvm::LoadInst>(pArgument))
+					{
+						for (const llvm::User* pUser : pLoad->getPointerOperand()->users())
+						{
+							if (auto pStore = llvm::dyn_cast<llvm::StoreInst>(pUser))
+							{
+								pArgument = pStore->getValueOperand()->stripPointerCasts();
+							}
+						}
+					}
+
+					auto pString = llvm::cast<llvm::GlobalVariable>(pArgument);
+
+					messages.push_back(llvm::cast<llvm::ConstantDataArray>(pString->getInitializer())->getAsCString().str());
+				}
+			}
+		}
+
+		return messages;
+	};
+
+	// \note a function's pointer global is initialized with the function itself
+	auto getFunction = [](const llvm::Module* pModule, const std::string& name) -> const llvm::Function*
+	{
+		auto pFunctionPointer = pModule->getGlobalVariable(name, true);
+
+		REQUIRE(pFunctionPointer);
+		REQUIRE(pFunctionPointer->hasInitializer());
+
+		return llvm::dyn_cast<llvm::Function>(pFunctionPointer->getInitializer()->stripPointerCasts());
+	};
+
+	// \note returns calls of $bounds_check within the function in order of their appearance
+	auto getBoundsChecks = [](const llvm::Function* pFunction)
+	{
+		std::vector<const llvm::CallInst*> checks;
+
+		for (const llvm::BasicBlock& currBlock : *pFunction)
+		{
+			for (const llvm::Instruction& currInstruction : currBlock)
+			{
+				auto pCall = llvm::dyn_cast<llvm::CallInst>(&currInstruction);
+
+				if (pCall && pCall->getCalledFunction() && pCall->getCalledFunction()->getName() == "$bounds_check")
+				{
+					checks.push_back(pCall);
+				}
+			}
+		}
+
+		return checks;
+	};
+
+	auto getCheckedLength = [](const llvm::CallInst* pCheck)
 	{
-	//	pCodeGenerator->Generate(new CASTSourceUnitNode(), new CSymTable());
+		return llvm::cast<llvm::ConstantInt>(pCheck->getArgOperand(1))->getZExtValue();
+	};
+
+	SECTION("TestGenerate_PassDeferWithinNestedLoops_DuplicatesItOntoExitEdges")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"f := () {",
+				"	i : int32 = 0;",
+				"	while i < 10 {",
+				"		defer puts(\"outer\");",
+				"		j : int32 = 0;",
+				"		while j < 10 {",
+				"			defer puts(\"inner\");",
+				"			j = j + 1;",
+				"			if j == 5 {",
+				"				continue;",
+				"			}",
+				"			if j == 7 {",
+				"				break;",
+				"			}",
+				"		}",
+				"		i = i + 1;",
+				"		if i == 3 {",
+				"			return;",
+				"		}",
+				"	}",
+				"};",
+			});
+
+		const std::vector<std::string> messages = getPrintedMessages(pModule);
+
+		// \note continue, break and the fallthrough leave the inner loop's body, break doesn't leave the outer one
+		REQUIRE(std::count(messages.cbegin(), messages.cend(), "inner") == 3);
+
+		// \note return and the fallthrough leave the outer loop's body
+		REQUIRE(std::count(messages.cbegin(), messages.cend(), "outer") == 2);
+
+		for (const llvm::Function& currFunction : *pModule)
+		{
+			for (const llvm::BasicBlock& currBlock : currFunction)
+			{
+				REQUIRE(currBlock.getName().find("defer") == llvm::StringRef::npos);
+			}
+		}
+
+		delete pModule;
 	}
-/*
-	SECTION("TestGenerate_PassBinaryExpression_ReturnsBytecode")
+
+	SECTION("TestGenerate_PassLoopsWithHints_EmitsCanonicalLoopsWithMetadata")
 	{
-		CASTSourceUnitNode* pProgram = new CASTSourceUnitNode();
+		llvm::Module* pModule = compile(
+			{
+				"main := () -> int32 {",
+				"	i : int32 = 0;",
+				"	while @vectorize(4) @unroll(2) i < 8 {",
+				"		i = i + 1;",
+				"	}",
+				"	loop @novectorize {",
+				"		if i == 16 {",
+				"			break;",
+				"		}",
+				"		i = i + 1;",
+				"	}",
+				"	return 0;",
+				"};",
+			});
 
-		ISymTable* pSymTable = new CSymTable();
+		// \note returns a hint of the loop's metadata, the first operand of the loop's node is the node itself
+		auto getHint = [](const llvm::MDNode* pLoopID, const std::string& name) -> const llvm::MDNode*
+		{
+			for (U32 i = 1; i < pLoopID->getNumOperands(); ++i)
+			{
+				auto pHint = llvm::dyn_cast<llvm::MDNode>(pLoopID->getOperand(i));
 
-		pSymTable->CreateScope();
-		pSymTable->AddVariable({ "x", nullptr, new CType(CT_INT32, BTS_INT32, 0x0) });
-		pSymTable->LeaveScope();
+				if (pHint && llvm::cast<llvm::MDString>(pHint->getOperand(0))->getString() == name)
+				{
+					return pHint;
+				}
+			}
+
+			return nullptr;
+		};
+
+		auto getHintValue = [](const llvm::MDNode* pHint)
+		{
+			return llvm::mdconst::extract<llvm::ConstantInt>(pHint->getOperand(1))->getZExtValue();
+		};
+
+		std::vector<const llvm::BranchInst*> backEdges;
+
+		for (const llvm::BasicBlock& currBlock : *getFunction(pModule, "_lang_entry_main"))
+		{
+			if (currBlock.getName().startswith("loop_latch"))
+			{
+				backEdges.push_back(llvm::dyn_cast<llvm::BranchInst>(currBlock.getTerminator()));
+			}
+		}
+
+		REQUIRE(backEdges.size() == 2);
+
+		// \note the latch is the only back edge, the header is entered from the preheader and the latch only
+		for (const llvm::BranchInst* pBackEdge : backEdges)
+		{
+			REQUIRE(pBackEdge);
+			REQUIRE(pBackEdge->isUnconditional());
+
+			const llvm::BasicBlock* pHeader = pBackEdge->getSuccessor(0);
+
+			REQUIRE(pHeader->hasNPredecessors(2));
+
+			for (const llvm::BasicBlock* pPredecessor : llvm::predecessors(pHeader))
+			{
+				auto pBranch = llvm::dyn_cast<llvm::BranchInst>(pPredecessor->getTerminator());
+
+				REQUIRE(pBranch);
+				REQUIRE(pBranch->isUnconditional());
+			}
+
+			const llvm::MDNode* pLoopID = pBackEdge->getMetadata(llvm::LLVMContext::MD_loop);
 
-		auto pBlock = new CASTBlockNode();
+			REQUIRE(pLoopID);
+			REQUIRE(pLoopID->getOperand(0) == pLoopID);
+		}
 
-		pBlock->AttachChild(new CASTAssignmentNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("x")),
-													new CASTBinaryExpressionNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(2))),
-														TT_PLUS,
-														new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(3))))));
+		const llvm::MDNode* pWhileLoopID = backEdges[0]->getMetadata(llvm::LLVMContext::MD_loop);
 
-		pProgram->AttachChild(pBlock);
+		REQUIRE(getHintValue(getHint(pWhileLoopID, "llvm.loop.vectorize.enable")) == 1);
+		REQUIRE(getHintValue(getHint(pWhileLoopID, "llvm.loop.vectorize.width")) == 4);
+		REQUIRE(getHintValue(getHint(pWhileLoopID, "llvm.loop.unroll.count")) == 2);
 
-		pCodeGenerator->Generate(pProgram, pSymTable);
+		const llvm::MDNode* pLoopID = backEdges[1]->getMetadata(llvm::LLVMContext::MD_loop);
 
-		delete pSymTable;
+		REQUIRE(getHintValue(getHint(pLoopID, "llvm.loop.vectorize.enable")) == 0);
+		REQUIRE(!getHint(pLoopID, "llvm.loop.unroll.count"));
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassDeferredExpressions_ExecutesThemInReverseOrder")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"f := () {",
+				"	defer puts(\"first\");",
+				"	defer puts(\"second\");",
+				"};",
+			});
+
+		REQUIRE(getPrintedMessages(pModule) == std::vector<std::string> { "second", "first" });
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassDeferredExpressionWithShadowedVariable_ResolvesItWithinScopeOfDefer")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"f := (x : int32) {",
+				"	s : string = \"outer\";",
+				"	defer puts(s);",
+				"	if x == 1 {",
+				"		s : string = \"inner\";",
+				"		return;",
+				"	}",
+				"};",
+			});
+
+		// \note both the return within the nested block and the fallthrough print the outer variable
+		REQUIRE(getPrintedMessages(pModule) == std::vector<std::string> { "outer", "outer" });
+
+		delete pModule;
 	}
-*/
+
+	SECTION("TestGenerate_PassLocalVariableWithinLoop_AllocatesItInEntryBlockAndMarksItsLifetime")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"main := () -> int32 {",
+				"	i : int32 = 0;",
+				"	while i < 10 {",
+				"		x : int32 = i;",
+				"		i = i + x + 1;",
+				"	}",
+				"	return i;",
+				"};",
+			});
+
+		const llvm::Function* pMainFunction = getFunction(pModule, "_lang_entry_main");
+
+		REQUIRE(pMainFunction);
+
+		const llvm::BasicBlock& allocasBlock = pMainFunction->getEntryBlock();
+
+		REQUIRE(allocasBlock.getName() == "allocas");
+
+		const llvm::AllocaInst* pLoopLocal = nullptr;
+
+		for (const llvm::BasicBlock& currBlock : *pMainFunction)
+		{
+			for (const llvm::Instruction& currInstruction : currBlock)
+			{
+				auto pAlloca = llvm::dyn_cast<llvm::AllocaInst>(&currInstruction);
+
+				// \note there are no allocas within the loop, so the stack doesn't grow with each iteration
+				REQUIRE((!pAlloca || &currBlock == &allocasBlock));
+
+				if (pAlloca && pAlloca->getName() == "x")
+				{
+					pLoopLocal = pAlloca;
+				}
+			}
+		}
+
+		REQUIRE(pLoopLocal);
+
+		// \note the variable lives only within the loop's body
+		std::vector<llvm::Intrinsic::ID> lifetimeMarkers;
+
+		for (const llvm::BasicBlock& currBlock : *pMainFunction)
+		{
+			for (const llvm::Instruction& currInstruction : currBlock)
+			{
+				auto pIntrinsic = llvm::dyn_cast<llvm::IntrinsicInst>(&currInstruction);
+
+				if (pIntrinsic && pIntrinsic->isLifetimeStartOrEnd() && pIntrinsic->getArgOperand(1)->stripPointerCasts() == pLoopLocal)
+				{
+					REQUIRE(&currBlock != &allocasBlock);
+
+					lifetimeMarkers.push_back(pIntrinsic->getIntrinsicID());
+				}
+			}
+		}
+
+		REQUIRE(lifetimeMarkers == std::vector<llvm::Intrinsic::ID> { llvm::Intrinsic::lifetime_start, llvm::Intrinsic::lifetime_end });
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassGlobalsWithConstantValues_InitializesThemStatically")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"limit : int32 = 4;",
+				"scale : float = 1.5;",
+				"g := () -> int32 {",
+				"	return limit;",
+				"};",
+				"n : int32 = g();",
+			});
+
+		auto pLimitVariable = pModule->getGlobalVariable("test$limit");
+		auto pScaleVariable = pModule->getGlobalVariable("test$scale");
+		auto pNVariable     = pModule->getGlobalVariable("test$n");
+
+		REQUIRE((pLimitVariable && pScaleVariable && pNVariable));
+		REQUIRE(llvm::cast<llvm::ConstantInt>(pLimitVariable->getInitializer())->getSExtValue() == 4);
+		REQUIRE(llvm::cast<llvm::ConstantFP>(pScaleVariable->getInitializer())->getValueAPF().convertToFloat() == 1.5f);
+
+		// \note only the global which is computed in runtime is assigned within the init function
+		std::vector<const llvm::Value*> initializedGlobals;
+
+		for (const llvm::BasicBlock& currBlock : *pModule->getFunction("test$initModuleGlobals"))
+		{
+			for (const llvm::Instruction& currInstruction : currBlock)
+			{
+				if (auto pStore = llvm::dyn_cast<llvm::StoreInst>(&currInstruction))
+				{
+					initializedGlobals.push_back(pStore->getPointerOperand()->stripPointerCasts());
+				}
+			}
+		}
+
+		REQUIRE(std::find(initializedGlobals.cbegin(), initializedGlobals.cend(), pLimitVariable) == initializedGlobals.cend());
+		REQUIRE(std::find(initializedGlobals.cbegin(), initializedGlobals.cend(), pScaleVariable) == initializedGlobals.cend());
+		REQUIRE(std::find(initializedGlobals.cbegin(), initializedGlobals.cend(), pNVariable) != initializedGlobals.cend());
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassStructsWithDefaultValues_InitializesThemWithoutConstructorsWhenPossible")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"limit : int32 = 4;",
+				"struct Zero {",
+				"	a : int32;",
+				"	b : float;",
+				"}",
+				"struct Consts {",
+				"	a : int32 = 42;",
+				"	b : int32 = 7;",
+				"}",
+				"struct Dynamic {",
+				"	a : int32 = limit;",
+				"}",
+				"main := () -> int32 {",
+				"	z : Zero;",
+				"	c : Consts;",
+				"	d : Dynamic;",
+				"	return 0;",
+				"};",
+			});
+
+		// \note maps a local variable onto an intrinsic or a function which initializes it
+		std::unordered_map<std::string, std::string> initializers;
+
+		for (const llvm::BasicBlock& currBlock : *getFunction(pModule, "_lang_entry_main"))
+		{
+			for (const llvm::Instruction& currInstruction : currBlock)
+			{
+				auto pCall = llvm::dyn_cast<llvm::CallInst>(&currInstruction);
+
+				if (!pCall || !pCall->getCalledFunction() || (pCall->getCalledFunction()->isIntrinsic() && !llvm::isa<llvm::MemIntrinsic>(pCall)))
+				{
+					continue;
+				}
+
+				initializers[pCall->getArgOperand(0)->stripPointerCasts()->getName().str()] = llvm::isa<llvm::MemSetInst>(pCall) ? "memset" :
+																							  llvm::isa<llvm::MemCpyInst>(pCall) ? "memcpy" :
+																							  pCall->getCalledFunction()->getName().str();
+
+				if (auto pMemCpy = llvm::dyn_cast<llvm::MemCpyInst>(pCall))
+				{
+					REQUIRE(pMemCpy->getSource()->stripPointerCasts() == pModule->getGlobalVariable("test$Consts$default", true));
+				}
+			}
+		}
+
+		REQUIRE(initializers == std::unordered_map<std::string, std::string> { { "z", "memset" }, { "c", "memcpy" }, { "d", "test$Dynamic$ctor" } });
+
+		// \note constructors are defined only for structures with dynamic default values
+		REQUIRE(!pModule->getFunction("test$Zero$ctor"));
+		REQUIRE(!pModule->getFunction("test$Consts$ctor"));
+		REQUIRE(!pModule->getFunction("test$Dynamic$ctor")->isDeclaration());
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassSizeofOfAggregatesInGlobalsAndFunctions_EvaluatesSameSizes")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"variant Data { int8, int64, int16 }\n",
+				"struct Pair {",
+				"	a : int8;",
+				"	b : int64;",
+				"}",
+				"dataSize : uint64 = sizeof(Data);",
+				"pairSize : uint64 = sizeof(Pair);",
+				"getDataSize := () -> uint64 {",
+				"	return sizeof(Data);",
+				"};",
+			});
+
+		const llvm::DataLayout& dataLayout = pModule->getDataLayout();
+
+		// \note globals are evaluated by the interpreter, the function's body is emitted by the code generator
+		const U64 dataSize = llvm::cast<llvm::ConstantInt>(pModule->getGlobalVariable("test$dataSize")->getInitializer())->getZExtValue();
+		const U64 pairSize = llvm::cast<llvm::ConstantInt>(pModule->getGlobalVariable("test$pairSize")->getInitializer())->getZExtValue();
+
+		REQUIRE(dataSize == dataLayout.getTypeAllocSize(llvm::StructType::getTypeByName(pModule->getContext(), "Data")));
+		REQUIRE(pairSize == dataLayout.getTypeAllocSize(llvm::StructType::getTypeByName(pModule->getContext(), "test$Pair")));
+
+		const llvm::ReturnInst* pReturn = nullptr;
+
+		for (const llvm::BasicBlock& currBlock : *getFunction(pModule, "getDataSize"))
+		{
+			pReturn = pReturn ? pReturn : llvm::dyn_cast<llvm::ReturnInst>(currBlock.getTerminator());
+		}
+
+		REQUIRE(pReturn);
+		REQUIRE(llvm::cast<llvm::ConstantInt>(pReturn->getReturnValue())->getZExtValue() == dataSize);
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassStructsImportedThroughInterface_InitializesThemAsTheirModuleDefinesThem")
+	{
+		llvm::Module* pShapesModule = compile(
+			{
+				"limit : int32 = 4;",
+				"struct Consts {",
+				"	a : int32 = 42;",
+				"	b : float = 1.5;",
+				"	p : int32* = null;",
+				"}",
+				"struct Dynamic {",
+				"	a : int32 = limit;",
+				"}",
+			}, "shapes");
+
+		IModuleInterfaceWriter* pWriter = new CModuleInterfaceWriter();
+		IModuleInterfaceReader* pReader = new CModuleInterfaceReader();
+
+		TModuleInterfaceInfo info;
+
+		IModuleInterfaceWriter::TBytesArray interfaceData;
+
+		REQUIRE(pWriter->Write(pSymTable, pInterpreter, "shapes", info, interfaceData) == RV_SUCCESS);
+		REQUIRE(pReader->Open(interfaceData) == RV_SUCCESS);
+
+		// \note the importer knows the module only by its interface
+		llvm::Module* pModule = compile(
+			{
+				"import \"shapes\" as shapes\n",
+				"main := () -> int32 {",
+				"	c : shapes.Consts;",
+				"	d : shapes.Dynamic;",
+				"	return 0;",
+				"};",
+			}, "test", [=]()
+			{
+				REQUIRE(pSymTable->CreateNamedScope("shapes") == RV_SUCCESS);
+				pModuleResolver->ResolveModuleType(pSymTable, pTypesFactory, "shapes");
+
+				REQUIRE(pReader->Load(pSymTable, pTypesFactory, pNodesFactory) == RV_SUCCESS);
+
+				pSymTable->LeaveScope();
+			});
+
+		std::unordered_map<std::string, std::string> initializers;
+
+		for (const llvm::BasicBlock& currBlock : *getFunction(pModule, "_lang_entry_main"))
+		{
+			for (const llvm::Instruction& currInstruction : currBlock)
+			{
+				auto pCall = llvm::dyn_cast<llvm::CallInst>(&currInstruction);
+
+				if (!pCall || !pCall->getCalledFunction() || (pCall->getCalledFunction()->isIntrinsic() && !llvm::isa<llvm::MemCpyInst>(pCall)))
+				{
+					continue;
+				}
+
+				initializers[pCall->getArgOperand(0)->stripPointerCasts()->getName().str()] = llvm::isa<llvm::MemCpyInst>(pCall) ? "memcpy" : pCall->getCalledFunction()->getName().str();
+			}
+		}
+
+		REQUIRE(initializers == std::unordered_map<std::string, std::string> { { "c", "memcpy" }, { "d", "shapes$Dynamic$ctor" } });
+
+		// \note the defaults are restored from the interface, the importer's template is the same as the module's constant
+		auto pTemplate = pModule->getGlobalVariable("shapes$Consts$default", true);
+
+		REQUIRE(pTemplate);
+
+		auto pDefaultValue = llvm::cast<llvm::ConstantStruct>(pTemplate->getInitializer());
+
+		REQUIRE(llvm::cast<llvm::ConstantInt>(pDefaultValue->getOperand(0))->getSExtValue() == 42);
+		REQUIRE(llvm::cast<llvm::ConstantFP>(pDefaultValue->getOperand(1))->isExactlyValue(1.5));
+		REQUIRE(pDefaultValue->getOperand(2)->isNullValue());
+
+		// \note the importer calls only constructors which the module defines
+		REQUIRE(!pShapesModule->getFunction("shapes$Consts$ctor"));
+		REQUIRE(!pShapesModule->getFunction("shapes$Dynamic$ctor")->isDeclaration());
+
+		delete pModule;
+		delete pShapesModule;
+		delete pReader;
+		delete pWriter;
+	}
+
+	SECTION("TestGenerate_PassAccessesOfStaticArray_ChecksOnlyIndicesWhichArentProven")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"main := () -> int32 {",
+				"	arr : int32[4];",
+				"	i : int32 = 0;",
+				"	while i < 4 {",
+				"		arr[i] = 1;",
+				"		i = i + 1;",
+				"	}",
+				"	k : int32 = 0;",
+				"	arr[k] = 2;",
+				"	arr[3] = 3;",
+				"	return 0;",
+				"};",
+			});
+
+		const std::vector<const llvm::CallInst*> checks = getBoundsChecks(getFunction(pModule, "_lang_entry_main"));
+
+		REQUIRE(checks.size() == 2);
+
+		// \note arr[i] isn't checked within the loop, only the initial value of i is checked up once in the preheader
+		const llvm::BranchInst* pPreheaderBranch = llvm::dyn_cast<llvm::BranchInst>(checks[0]->getParent()->getTerminator());
+
+		REQUIRE(getCheckedLength(checks[0]) == (1ULL << 63));
+		REQUIRE(pPreheaderBranch);
+		REQUIRE(pPreheaderBranch->isUnconditional());
+		REQUIRE(pPreheaderBranch->getSuccessor(0)->getName() == "loop_header");
+
+		// \note arr[k] is checked up, arr[3] is in range
+		REQUIRE(getCheckedLength(checks[1]) == 4);
+		REQUIRE(checks[1]->getParent()->getName() == "loop_exit");
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassIndexWhichShadowsInductionVariable_ChecksIt")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"main := () -> int32 {",
+				"	arr : int32[4];",
+				"	i : int32 = 0;",
+				"	while i < 4 {",
+				"		i : int32 = 100;",
+				"		arr[i] = 0;",
+				"	}",
+				"	return 0;",
+				"};",
+			});
+
+		const std::vector<const llvm::CallInst*> checks = getBoundsChecks(getFunction(pModule, "_lang_entry_main"));
+
+		REQUIRE(checks.size() == 1);
+		REQUIRE(getCheckedLength(checks[0]) == 4);
+		REQUIRE(checks[0]->getParent()->getName() != "entry");
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassConditionalAccessByMonotonicVariable_DoesntHoistItsCheck")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"main := () -> int32 {",
+				"	arr : int32[4];",
+				"	i : int32 = -2;",
+				"	while i < 4 {",
+				"		if i >= 0 {",
+				"			arr[i] = 1;",
+				"		}",
+				"		i = i + 1;",
+				"	}",
+				"	j : int32 = -2;",
+				"	while j < 4 {",
+				"		if j == 3 {",
+				"			break;",
+				"		}",
+				"		arr[j] = 2;",
+				"		j = j + 1;",
+				"	}",
+				"	return 0;",
+				"};",
+			});
+
+		const std::vector<const llvm::CallInst*> checks = getBoundsChecks(getFunction(pModule, "_lang_entry_main"));
+
+		// \note negative initial values are valid, because the accesses aren't executed on each iteration
+		REQUIRE(checks.size() == 2);
+		REQUIRE(getCheckedLength(checks[0]) == 4);
+		REQUIRE(getCheckedLength(checks[1]) == 4);
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassInclusiveBoundOfMaxValue_ChecksAccess")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"main := () -> int32 {",
+				"	arr : int32[4];",
+				"	i : uint64 = 0uL;",
+				"	while i <= 18446744073709551615uL {",
+				"		arr[i] = 1;",
+				"		i = i + 1uL;",
+				"	}",
+				"	return 0;",
+				"};",
+			});
+
+		const std::vector<const llvm::CallInst*> checks = getBoundsChecks(getFunction(pModule, "_lang_entry_main"));
+
+		REQUIRE(checks.size() == 1);
+		REQUIRE(getCheckedLength(checks[0]) == 4);
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassFunctionsWithBoundsChecks_DoesntMarkThemAndCallersAsReadOnly")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"sum := (a : int32, b : int32) -> int32 {",
+				"	return a + b;",
+				"};",
+				"callGet := (i : int32) -> int32 {",
+				"	return get(i);",
+				"};",
+				"get := (i : int32) -> int32 {",
+				"	arr : int32[4];",
+				"	return arr[i];",
+				"};",
+				"getFirst := () -> int32 {",
+				"	arr : int32[4];",
+				"	return arr[0];",
+				"};",
+			});
+
+		auto hasMemoryAttributes = [](const llvm::Function* pFunction)
+		{
+			return pFunction->hasFnAttribute(llvm::Attribute::ReadNone) || pFunction->hasFnAttribute(llvm::Attribute::ReadOnly);
+		};
+
+		REQUIRE(getFunction(pModule, "sum")->hasFnAttribute(llvm::Attribute::ReadNone));
+		REQUIRE(getFunction(pModule, "getFirst")->hasFnAttribute(llvm::Attribute::ReadOnly));
+
+		// \note a failed check terminates the program, so is a call of a function which contains it
+		REQUIRE(getBoundsChecks(getFunction(pModule, "get")).size() == 1);
+		REQUIRE(!hasMemoryAttributes(getFunction(pModule, "get")));
+		REQUIRE(!hasMemoryAttributes(getFunction(pModule, "callGet")));
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassUncheckedAccesses_DoesntCheckThem")
+	{
+		const std::vector<std::string> lines
+		{
+			"f := () {",
+			"	arr : @unchecked int32[4];",
+			"	k : int32 = 0;",
+			"	arr[k] = 1;",
+			"};",
+			"g : @unchecked () -> void = () {",
+			"	arr : int32[4];",
+			"	k : int32 = 0;",
+			"	arr[k] = 1;",
+			"};",
+			"h := () {",
+			"	arr : int32[4];",
+			"	k : int32 = 0;",
+			"	arr[k] = 1;",
+			"};",
+		};
+
+		llvm::Module* pModule = compile(lines);
+
+		REQUIRE(getBoundsChecks(getFunction(pModule, "f")).empty());
+		REQUIRE(getBoundsChecks(getFunction(pModule, "g")).empty());
+		REQUIRE(getBoundsChecks(getFunction(pModule, "h")).size() == 1);
+
+		delete pModule;
+
+		// \note the same as --no-bounds-checks
+		REQUIRE(pCodeGenerator->SetFlags(CGF_DISABLE_BOUNDS_CHECKS) == RV_SUCCESS);
+
+		pModule = compile(lines);
+
+		REQUIRE(getBoundsChecks(getFunction(pModule, "h")).empty());
+		REQUIRE(!pModule->getFunction("$bounds_check"));
+
+		REQUIRE(pCodeGenerator->SetFlags(0x0) == RV_SUCCESS);
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassLengthOfStringWithUnknownOrigin_CallsStrlen")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"getenv : @foreign (string) -> string;",
+				"f := (s : string) -> uint64 {",
+				"	return s.length;",
+				"};",
+				"g := () -> uint64 {",
+				"	s : string = getenv(\"HOME\");",
+				"	return s.length;",
+				"};",
+			});
+		// \note origins of an argument and a result of a foreign function aren't known, so their lengths are computed with strlen
+		// \note only literals have the length prefix, so neither an argument nor a result of a foreign function is read before its data
+		for (const std::string& currFunctionName : { "f", "g" })
+		{
+			const llvm::Function* pFunction = getFunction(pModule, currFunctionName);
+
+			REQUIRE(pFunction);
+
+			bool isStrlenCalled = false;
+
+			for (const llvm::BasicBlock& currBlock : *pFunction)
+			{
+				for (const llvm::Instruction& currInstruction : currBlock)
+				{
+					auto pCall = llvm::dyn_cast<llvm::CallInst>(&currInstruction);
+
+					isStrlenCalled = isStrlenCalled || (pCall && pCall->getCalledFunction() && pCall->getCalledFunction()->getName() == "strlen");
+
+					REQUIRE(!llvm::isa<llvm::GetElementPtrInst>(&currInstruction));
+				}
+			}
+
+			REQUIRE(isStrlenCalled);
+		}
+
+		delete pModule;
+	}
+
+	SECTION("TestGenerate_PassCallOfImmutableFunction_EmitsDirectCall")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"add := (a : int32, b : int32) -> int32 {",
+				"	return a + b;",
+				"};",
+				"main := () -> int32 {",
+				"	return add(2, 3);",
+				"};",
+			});
+
+		// \note returns callees of all calls within the function, nullptr stands for an indirect call
+		auto getCallees = [](const llvm::Function* pFunction)
+		{
+			std::vector<const llvm::Function*> callees;
+
+			for (const llvm::BasicBlock& currBlock : *pFunction)
+			{
+				for (const llvm::Instruction& currInstruction : currBlock)
+				{
+					auto pCall = llvm::dyn_cast<llvm::CallInst>(&currInstruction);
+
+					if (pCall && !(pCall->getCalledFunction() && pCall->getCalledFunction()->isIntrinsic()))
+					{
+						callees.push_back(pCall->getCalledFunction());
+					}
+				}
+			}
+
+			return callees;
+		};
+
+		const llvm::Function* pAddFunction  = getFunction(pModule, "add");
+		const llvm::Function* pMainFunction = getFunction(pModule, "_lang_entry_main");
+
+		REQUIRE(pAddFunction);
+		REQUIRE(pMainFunction);
+		REQUIRE(pModule->getGlobalVariable("add", true)->isConstant());
+
+		const std::vector<const llvm::Function*> mainCallees = getCallees(pMainFunction);
+
+		REQUIRE(mainCallees.size() == 1);
+		REQUIRE(mainCallees.front());
+		REQUIRE(mainCallees.front()->getName() == pAddFunction->getName());
+
+		// \note the program's entry point calls the module's main function directly too
+		const std::vector<const llvm::Function*> entryCallees = getCallees(pModule->getFunction("main"));
+
+		REQUIRE(std::find(entryCallees.cbegin(), entryCallees.cend(), pMainFunction) != entryCallees.cend());
+
+		delete pModule;
+	}
+
+	SECTION("TestLoadModule_PassSavedModule_RestoresIt")
+	{
+		llvm::Module* pModule = compile(
+			{
+				"f := () {",
+				"	puts(\"cached\");",
+				"};",
+			});
+
+		std::vector<U8> bitcode;
+
+		REQUIRE(pCodeGenerator->SaveModule(pModule, bitcode) == RV_SUCCESS);
+
+		auto pLoadedModule = std::get<llvm::Module*>(pCodeGenerator->LoadModule(bitcode));
+
+		REQUIRE(pLoadedModule);
+		REQUIRE(!llvm::verifyModule(*pLoadedModule));
+		REQUIRE(getPrintedMessages(pLoadedModule) == std::vector<std::string> { "cached" });
+
+		REQUIRE(!std::get<llvm::Module*>(pCodeGenerator->LoadModule({ 0x0, 0x1, 0x2 })));
+
+		delete pLoadedModule;
+		delete pModule;
+	}
+
+	delete pFunctionAttributesAnalyser;
+	delete pModuleResolver;
+	delete pSemanticAnalyser;
+	delete pParser;
+	delete pLexer;
+	delete pInterpreter;
+	delete pTypeResolver;
+	delete pNodesFactory;
+	delete pTypesFactory;
+	delete pSymTable;
 	delete pCodeGenerator;
-}
\ No newline at end of file
+}
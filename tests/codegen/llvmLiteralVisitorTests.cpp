@@ -5,26 +5,55 @@
 
 using namespace gplc;
 
-//
-//TEST_CASE("CLLVMLiteralVisitor tests")
-//{
-//	llvm::LLVMContext context;
-//
-//	ILiteralVisitor<TLLVMIRData>* pLiteralVisitor = new CLLVMLiteralVisitor(context);
-//
-//	auto checkAsserts = [](auto pConstant, auto expectedValue)
-//	{
-//		REQUIRE(pConstant != nullptr);
-//		REQUIRE(pConstant->getValue() == expectedValue);
-//	};
-//
-//	SECTION("TestVisitIntLiteral_PassIntLiteral_ReturnsLLVMIRValue")
-//	{
-//		checkAsserts(llvm::dyn_cast<llvm::ConstantInt>(std::get<llvm::Value*>(pLiteralVisitor->VisitIntLiteral(new CIntValue(42)))), 42);
-//
-//		checkAsserts(llvm::dyn_cast<llvm::ConstantInt>(std::get<llvm::Value*>(pLiteralVisitor->VisitBoolLiteral(new CBoolValue(true)))), true);
-//		checkAsserts(llvm::dyn_cast<llvm::ConstantInt>(std::get<llvm::Value*>(pLiteralVisitor->VisitBoolLiteral(new CBoolValue(false)))), false);
-//	}
-//
-//	delete pLiteralVisitor;
-//}
\ No newline at end of file
+
+TEST_CASE("CLLVMLiteralVisitor tests")
+{
+	llvm::LLVMContext context;
+	llvm::Module      module("test", context);
+
+	CLLVMLiteralVisitor* pLiteralVisitor = new CLLVMLiteralVisitor(context, &module, nullptr);
+
+	auto checkAsserts = [](auto pConstant, auto expectedValue)
+	{
+		REQUIRE(pConstant != nullptr);
+		REQUIRE(pConstant->getValue() == expectedValue);
+	};
+
+	SECTION("TestVisitIntLiteral_PassIntLiteral_ReturnsLLVMIRValue")
+	{
+		checkAsserts(llvm::dyn_cast<llvm::ConstantInt>(std::get<llvm::Value*>(pLiteralVisitor->VisitIntLiteral(new CIntValue(42)))), 42);
+
+		checkAsserts(llvm::dyn_cast<llvm::ConstantInt>(std::get<llvm::Value*>(pLiteralVisitor->VisitBoolLiteral(new CBoolValue(true)))), true);
+		checkAsserts(llvm::dyn_cast<llvm::ConstantInt>(std::get<llvm::Value*>(pLiteralVisitor->VisitBoolLiteral(new CBoolValue(false)))), false);
+	}
+
+	SECTION("TestVisitStringLiteral_PassSameLiteralTwice_ReturnsPooledConstant")
+	{
+		auto pFirst  = std::get<llvm::Value*>(pLiteralVisitor->VisitStringLiteral(new CStringValue("Hello")));
+		auto pSecond = std::get<llvm::Value*>(pLiteralVisitor->VisitStringLiteral(new CStringValue("Hello")));
+		auto pThird  = std::get<llvm::Value*>(pLiteralVisitor->VisitStringLiteral(new CStringValue("World")));
+
+		REQUIRE(pFirst == pSecond);
+		REQUIRE(pFirst != pThird);
+		REQUIRE(module.getGlobalList().size() == 2);
+
+		for (const llvm::GlobalVariable& currGlobal : module.globals())
+		{
+			REQUIRE(currGlobal.isConstant());
+			REQUIRE(currGlobal.hasPrivateLinkage());
+			REQUIRE(currGlobal.hasGlobalUnnamedAddr());
+		}
+	}
+
+	SECTION("TestGetStringLiteralLength_PassPooledAndOtherStrings_ReturnsLengthsOnlyOfPooledOnes")
+	{
+		llvm::Constant* pLiteral = pLiteralVisitor->GetStringLiteral("Hello");
+
+		checkAsserts(llvm::dyn_cast<llvm::ConstantInt>(pLiteralVisitor->GetStringLiteralLength(pLiteral)), 5);
+		checkAsserts(llvm::dyn_cast<llvm::ConstantInt>(pLiteralVisitor->GetStringLiteralLength(llvm::ConstantExpr::getBitCast(pLiteral, llvm::Type::getInt8PtrTy(context)))), 5);
+
+		REQUIRE(!pLiteralVisitor->GetStringLiteralLength(llvm::ConstantPointerNull::get(llvm::Type::getInt8PtrTy(context))));
+	}
+
+	delete pLiteralVisitor;
+}
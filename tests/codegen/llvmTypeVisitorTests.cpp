@@ -53,5 +53,35 @@ TEST_CASE("CLLVMTypeVisitor tests")
 		delete pSymTable;
 	}
 
+	SECTION("TestVisitVariantType_PassVariantDeclaration_ReturnsTaggedUnion")
+	{
+		/*!
+			variant Data { int8, int64, int16 }
+		*/
+		auto pVariantType = llvm::dyn_cast<llvm::StructType>(std::get<llvm::Type*>(pTypeVisitor->VisitVariantType(new CVariantType({ new CType(CT_INT8, BTS_INT8, 0x0),
+																																		  new CType(CT_INT64, BTS_INT64, 0x0),
+																																		  new CType(CT_INT16, BTS_INT16, 0x0) }, "Data"))));
+		REQUIRE(pVariantType);
+		REQUIRE(pVariantType->getElementType(0)->isIntegerTy(8));
+
+		// \note the payload is as large as the largest alternative instead of being a sum of them
+		auto pPayloadType = llvm::dyn_cast<llvm::ArrayType>(pVariantType->getElementType(1));
+		REQUIRE(pPayloadType);
+		REQUIRE(pPayloadType->getElementType()->isIntegerTy(64));
+		REQUIRE(pPayloadType->getNumElements() == 1);
+	}
+
+	SECTION("TestVisitVariantType_PassPointerOnlyVariant_ReturnsTaggedUnion")
+	{
+		/*!
+			variant Ref { int32*, int64* }
+		*/
+		auto pVariantType = llvm::dyn_cast<llvm::StructType>(std::get<llvm::Type*>(pTypeVisitor->VisitVariantType(new CVariantType({ new CPointerType(new CType(CT_INT32, BTS_INT32, 0x0)),
+																																	new CPointerType(new CType(CT_INT64, BTS_INT64, 0x0)) }, "Ref"))));
+		// \note there is no code which reads a tag from low bits of a pointer, so the tag is always stored explicitly
+		REQUIRE(pVariantType);
+		REQUIRE(pVariantType->getElementType(0)->isIntegerTy(8));
+	}
+
 	delete pTypeVisitor;
 }
\ No newline at end of file
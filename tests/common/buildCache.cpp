@@ -0,0 +1,79 @@
+#include <catch2/catch.hpp>
+#include <gplc.h>
+#include <filesystem>
+
+
+using namespace gplc;
+
+
+TEST_CASE("CBuildCache tests")
+{
+	const std::string cacheDirectory = (std::filesystem::temp_directory_path() / "gplc_build_cache_tests").string();
+
+	std::filesystem::remove_all(cacheDirectory);
+
+	IBuildCache* pBuildCache = new CBuildCache();
+
+	// \note a size of an entry is 24 bytes of the header and the payload
+	REQUIRE(pBuildCache->Init(cacheDirectory, 300) == RV_SUCCESS);
+
+	auto createEntry = [](U8 value) -> IBuildCache::TCacheEntry
+	{
+		return { IBuildCache::TBytesArray(90, value), IBuildCache::TBytesArray(10, value) };
+	};
+
+	SECTION("TestComputeKey_PassDifferentInputs_ReturnsDifferentKeys")
+	{
+		const IBuildCache::TCacheKeyDesc keyDesc { "x : int32;", "0.1", "0;0", { "core" } };
+
+		REQUIRE(pBuildCache->ComputeKey(keyDesc) == pBuildCache->ComputeKey(keyDesc));
+		REQUIRE(pBuildCache->ComputeKey(keyDesc).length() == 40);
+
+		REQUIRE(pBuildCache->ComputeKey(keyDesc) != pBuildCache->ComputeKey({ "x : int32;", "0.1", "0;0", { "memory" } }));
+		REQUIRE(pBuildCache->ComputeKey(keyDesc) != pBuildCache->ComputeKey({ "x : int32;", "0.1", "1;0", { "core" } }));
+		REQUIRE(pBuildCache->ComputeKey({ "ab", "c", "", {} }) != pBuildCache->ComputeKey({ "a", "bc", "", {} }));
+	}
+
+	SECTION("TestLoad_PassStoredEntry_ReturnsItsData")
+	{
+		IBuildCache::TCacheEntry entry;
+
+		REQUIRE(pBuildCache->Load("first", entry) == RV_FILE_NOT_FOUND);
+
+		REQUIRE(pBuildCache->Store("first", createEntry(1)) == RV_SUCCESS);
+		REQUIRE(pBuildCache->GetSize() == 124);
+
+		// \note the entry should be available for next runs of the compiler
+		IBuildCache* pReopenedBuildCache = new CBuildCache();
+
+		REQUIRE(pReopenedBuildCache->Init(cacheDirectory, 300) == RV_SUCCESS);
+		REQUIRE(pReopenedBuildCache->GetSize() == 124);
+		REQUIRE(pReopenedBuildCache->Load("first", entry) == RV_SUCCESS);
+
+		REQUIRE(entry.mModuleCode == createEntry(1).mModuleCode);
+		REQUIRE(entry.mInterface == createEntry(1).mInterface);
+
+		delete pReopenedBuildCache;
+	}
+
+	SECTION("TestStore_ExceedSizeLimit_EvictsLeastRecentlyUsedEntry")
+	{
+		IBuildCache::TCacheEntry entry;
+
+		REQUIRE(pBuildCache->Store("first", createEntry(1)) == RV_SUCCESS);
+		REQUIRE(pBuildCache->Store("second", createEntry(2)) == RV_SUCCESS);
+
+		REQUIRE(pBuildCache->Load("first", entry) == RV_SUCCESS);
+
+		REQUIRE(pBuildCache->Store("third", createEntry(3)) == RV_SUCCESS);
+		REQUIRE(pBuildCache->GetSize() == 248);
+
+		REQUIRE(pBuildCache->Load("second", entry) == RV_FILE_NOT_FOUND);
+		REQUIRE(pBuildCache->Load("first", entry) == RV_SUCCESS);
+		REQUIRE(pBuildCache->Load("third", entry) == RV_SUCCESS);
+	}
+
+	delete pBuildCache;
+
+	std::filesystem::remove_all(cacheDirectory);
+}
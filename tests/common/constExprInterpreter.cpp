@@ -18,12 +18,199 @@ TEST_CASE("ConstExprInterpreter Tests")
 	SECTION("TestEval_PassSingleIdentifier_ReturnsValue")
 	{
 		ISymTable* pSymTable = new CSymTable();
-		pSymTable->AddVariable({ "a", new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(42))), new CType(CT_INT32, BTS_INT32, 0x0) });
+		pSymTable->AddVariable({ "a", new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(42))), new CType(CT_INT32, BTS_INT32, 0x0), nullptr, false, true });
 
 		REQUIRE(pInterpreter->Eval(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("a", 0x0)), pSymTable).Get() == 42);
 
 		delete pSymTable;
 	}
 
+	SECTION("TestEvalValue_PassIdentifierOfVariable_ReturnsNotConstantError")
+	{
+		ISymTable* pSymTable = new CSymTable();
+
+		// \note a global variable which can be changed in runtime
+		pSymTable->AddVariable({ "a", new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(0))), new CType(CT_INT32, BTS_INT32, 0x0) });
+		pSymTable->AddVariable({ "b", new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(42))), new CType(CT_INT32, BTS_INT32, 0x0), nullptr, true, true });
+
+		REQUIRE(!pInterpreter->EvalValue(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("a", 0x0)), pSymTable).IsOk());
+		REQUIRE(!pInterpreter->EvalValue(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("b", 0x0)), pSymTable).IsOk());
+
+		delete pSymTable;
+	}
+
+	SECTION("TestEvalValue_PassMixedArithmeticAndComparison_ReturnsTypedValues")
+	{
+		ISymTable* pSymTable = new CSymTable();
+
+		// 7 / 2 * 1.5
+		auto floatResult = pInterpreter->EvalValue(new CASTBinaryExpressionNode(new CASTBinaryExpressionNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(7))),
+																											 TT_SLASH,
+																											 new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(2)))),
+																TT_STAR,
+																new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CFloatValue(1.5f)))), pSymTable);
+
+		REQUIRE(floatResult.IsOk());
+		REQUIRE(floatResult.Get().mType == CT_FLOAT);
+		REQUIRE(std::get<F64>(floatResult.Get().mValue) == 4.5);
+
+		// 3u >= 4 || true
+		auto boolResult = pInterpreter->EvalValue(new CASTBinaryExpressionNode(new CASTBinaryExpressionNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CUIntValue(3))),
+																											TT_GE,
+																											new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(4)))),
+															   TT_OR,
+															   new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CBoolValue(true)))), pSymTable);
+
+		REQUIRE(boolResult.IsOk());
+		REQUIRE(boolResult.Get().mType == CT_BOOL);
+		REQUIRE(std::get<bool>(boolResult.Get().mValue));
+
+		delete pSymTable;
+	}
+
+	SECTION("TestEvalValue_PassDivisionByZeroOrOverflow_ReportsErrors")
+	{
+		static std::vector<E_SEMANTIC_ANALYSER_MESSAGE> reportedErrors;
+
+		reportedErrors.clear();
+
+		pInterpreter->OnErrorOutput += [](const TSemanticAnalyserMessageInfo& info) { reportedErrors.push_back(info.mMessage); };
+
+		ISymTable* pSymTable = new CSymTable();
+		pSymTable->AddVariable({ "a", new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(100))), new CType(CT_INT8, BTS_INT8, 0x0), nullptr, false, true });
+
+		REQUIRE(pInterpreter->EvalValue(new CASTBinaryExpressionNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(42))),
+																	 TT_PERCENT_SIGN,
+																	 new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(0)))), pSymTable).HasError());
+
+		// a + a, where a : int8 = 100
+		REQUIRE(pInterpreter->EvalValue(new CASTBinaryExpressionNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("a")),
+																	 TT_PLUS,
+																	 new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("a"))), pSymTable).HasError());
+
+		REQUIRE(reportedErrors == std::vector<E_SEMANTIC_ANALYSER_MESSAGE> { SAE_DIVISION_BY_ZERO_IN_CONST_EXPR, SAE_INTEGER_OVERFLOW_IN_CONST_EXPR });
+
+		delete pSymTable;
+	}
+
+	SECTION("TestEvalValue_PassCallOfPureFunction_ReturnsItsResult")
+	{
+		/*!
+			sqr : (x : int32) -> int32 = (x : int32) -> int32 { 
+				result : int32 = 0;
+				i : int32 = 0;
+
+				while i < x {
+					result = result + x;
+					i = i + 1;
+				}
+
+				return result;
+			}
+		*/
+
+		auto createIdentifiersList = [](const std::string& identifier)
+		{
+			auto pIdentifiers = new CASTNode(NT_IDENTIFIERS_LIST);
+			pIdentifiers->AttachChild(new CASTIdentifierNode(identifier));
+
+			return pIdentifiers;
+		};
+
+		auto pBody = new CASTBlockNode();
+
+		pBody->AttachChild(new CASTDefinitionNode(new CASTDeclarationNode(createIdentifiersList("result"), new CASTTypeNode(NT_INT32)),
+												  new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(0)))));
+		pBody->AttachChild(new CASTDefinitionNode(new CASTDeclarationNode(createIdentifiersList("i"), new CASTTypeNode(NT_INT32)),
+												  new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(0)))));
+
+		auto pLoopBody = new CASTBlockNode();
+
+		pLoopBody->AttachChild(new CASTAssignmentNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("result")),
+													  new CASTBinaryExpressionNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("result")),
+																				   TT_PLUS,
+																				   new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("x")))));
+		pLoopBody->AttachChild(new CASTAssignmentNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("i")),
+													  new CASTBinaryExpressionNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("i")),
+																				   TT_PLUS,
+																				   new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(1))))));
+
+		pBody->AttachChild(new CASTWhileLoopStatementNode(new CASTBinaryExpressionNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("i")),
+																					   TT_LT,
+																					   new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("x"))),
+														  pLoopBody));
+		pBody->AttachChild(new CASTReturnStatementNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("result"))));
+
+		ISymTable* pSymTable = new CSymTable();
+		ITypesFactory* pTypesFactory = new CTypesFactory();
+		ITypeResolver* pTypeResolver = new CTypeResolver();
+
+		REQUIRE(pTypeResolver->Init(pSymTable, pInterpreter, pTypesFactory) == RV_SUCCESS);
+		REQUIRE(pInterpreter->Init(pTypeResolver) == RV_SUCCESS);
+
+		TSymbolDesc funcDesc { "sqr", nullptr, new CFunctionType({ { "x", new CType(CT_INT32, BTS_INT32, 0x0) } }, new CType(CT_INT32, BTS_INT32, 0x0)) };
+
+		funcDesc.mpFuncDefinition = new CASTFuncDefinitionNode(nullptr, nullptr, pBody);
+
+		pSymTable->AddVariable(funcDesc);
+
+		auto pArgs = new CASTNode(NT_FUNC_ARGS);
+		pArgs->AttachChild(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(12))));
+
+		auto result = pInterpreter->EvalValue(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTFunctionCallNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("sqr")), pArgs)), 
+											  pSymTable);
+
+		REQUIRE(result.IsOk());
+		REQUIRE(result.Get().mType == CT_INT32);
+		REQUIRE(std::get<I64>(result.Get().mValue) == 144);
+
+		delete pTypeResolver;
+		delete pTypesFactory;
+		delete pSymTable;
+	}
+
+	SECTION("TestEvalValue_CallFunctionFromScopeWhichShadowsItsGlobals_ResolvesNamesWithinScopeOfCallee")
+	{
+		/*!
+			k : int32 = 2; // a constant
+
+			getK := () -> int32 { return k; }
+
+			{
+				k : int32 = 100; // a constant which shadows the global one
+
+				getK();
+			}
+		*/
+
+		auto pBody = new CASTBlockNode();
+		pBody->AttachChild(new CASTReturnStatementNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("k"))));
+
+		ISymTable* pSymTable = new CSymTable();
+
+		pSymTable->AddVariable({ "k", new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(2))), new CType(CT_INT32, BTS_INT32, 0x0), nullptr, false, true });
+
+		TSymbolDesc funcDesc { "getK", nullptr, new CFunctionType({}, new CType(CT_INT32, BTS_INT32, 0x0)) };
+
+		funcDesc.mpFuncDefinition = new CASTFuncDefinitionNode(nullptr, nullptr, pBody);
+
+		pSymTable->AddVariable(funcDesc);
+
+		REQUIRE(pSymTable->CreateScope() == RV_SUCCESS);
+
+		pSymTable->AddVariable({ "k", new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(100))), new CType(CT_INT32, BTS_INT32, 0x0), nullptr, false, true });
+
+		auto result = pInterpreter->EvalValue(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTFunctionCallNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("getK")), nullptr)),
+											  pSymTable);
+
+		REQUIRE(result.IsOk());
+		REQUIRE(std::get<I64>(result.Get().mValue) == 2);
+		REQUIRE(std::get<I64>(pInterpreter->EvalValue(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTIdentifierNode("k")), pSymTable).Get().mValue) == 100);
+
+		pSymTable->LeaveScope();
+
+		delete pSymTable;
+	}
+
 	delete pInterpreter;
 }
\ No newline at end of file
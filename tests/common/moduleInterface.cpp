@@ -0,0 +1,232 @@
+#include <catch2/catch.hpp>
+#include <gplc.h>
+#include "../lexer/stubInputStream.h"
+
+
+using namespace gplc;
+
+
+TEST_CASE("CModuleInterface tests")
+{
+	ISymTable*             pSymTable         = new CSymTable();
+	ITypesFactory*         pTypesFactory     = new CTypesFactory();
+	IASTNodesFactory*      pNodesFactory     = new CASTNodesFactory();
+	ITypeResolver*         pTypeResolver     = new CTypeResolver();
+	IConstExprInterpreter* pInterpreter      = new CConstExprInterpreter();
+	ILexer*                pLexer            = new CLexer();
+	IParser*               pParser           = new CParser();
+	ISemanticAnalyser*     pSemanticAnalyser = new CSemanticAnalyser();
+	IModuleResolver*       pModuleResolver   = new CModuleResolver();
+
+	pTypeResolver->Init(pSymTable, pInterpreter, pTypesFactory);
+	pInterpreter->Init(pTypeResolver);
+
+	IInputStream* pInputStream = new CStubInputStream(
+		{
+			"enum Color {",
+			"	Red,",
+			"	Green = 5,",
+			"	Blue",
+			"}",
+			"struct Point {",
+			"	x : int32;",
+			"	y : int32;",
+			"}",
+			"add := (a : int32, b : int32) -> int32 {",
+			"	return a + b;",
+			"};",
+		});
+
+	REQUIRE(pLexer->Init(pInputStream) == RV_SUCCESS);
+
+	pSymTable->CreateNamedScope("shapes");
+	pModuleResolver->ResolveModuleType(pSymTable, pTypesFactory, "shapes");
+
+	auto pSourceUnit = dynamic_cast<CASTSourceUnitNode*>(pParser->Parse(pLexer, pSymTable, pNodesFactory, pTypesFactory, "shapes"));
+	REQUIRE(pSourceUnit);
+	REQUIRE(pSemanticAnalyser->Analyze(pSourceUnit, pTypeResolver, pSymTable, pNodesFactory));
+
+	pSymTable->LeaveScope();
+
+	IModuleInterfaceWriter* pWriter = new CModuleInterfaceWriter();
+
+	TModuleInterfaceInfo info { 42, 7, "code", "0;0" };
+
+	IModuleInterfaceWriter::TBytesArray interfaceData;
+
+	REQUIRE(pWriter->Write(pSymTable, pInterpreter, "shapes", info, interfaceData) == RV_SUCCESS);
+	REQUIRE(info.mInterfaceHash.length() == 40);
+
+	SECTION("TestWrite_PassSameModuleTwice_ReturnsSameBytes")
+	{
+		TModuleInterfaceInfo otherInfo { 42, 7, "code", "0;0" };
+
+		IModuleInterfaceWriter::TBytesArray otherInterfaceData;
+
+		REQUIRE(pWriter->Write(pSymTable, pInterpreter, "shapes", otherInfo, otherInterfaceData) == RV_SUCCESS);
+		REQUIRE(otherInterfaceData == interfaceData);
+		REQUIRE(otherInfo.mInterfaceHash == info.mInterfaceHash);
+	}
+
+	SECTION("TestLoad_PassWrittenInterface_RestoresModuleSymbols")
+	{
+		IModuleInterfaceReader* pReader = new CModuleInterfaceReader();
+
+		REQUIRE(pReader->Open(interfaceData) == RV_SUCCESS);
+		REQUIRE(pReader->GetInfo().mSourceSize == 42);
+		REQUIRE(pReader->GetInfo().mSourceModificationTime == 7);
+		REQUIRE(pReader->GetInfo().mCodeKey == "code");
+		REQUIRE(pReader->GetInfo().mBuildOptions == "0;0");
+		REQUIRE(pReader->GetInfo().mInterfaceHash == info.mInterfaceHash);
+
+		// \note an importer's table doesn't know anything about the module except its interface
+		ISymTable*     pImporterSymTable     = new CSymTable();
+		ITypesFactory* pImporterTypesFactory = new CTypesFactory();
+
+		pImporterSymTable->CreateNamedScope("shapes");
+		pModuleResolver->ResolveModuleType(pImporterSymTable, pImporterTypesFactory, "shapes");
+
+		REQUIRE(pReader->Load(pImporterSymTable, pImporterTypesFactory, pNodesFactory) == RV_SUCCESS);
+
+		auto pModuleScope = pImporterSymTable->LookUpNamedScope("shapes");
+
+		// \note symbols are declared only when they're requested
+		REQUIRE(pModuleScope->mVariables.empty());
+		REQUIRE(pModuleScope->mNamedScopes.empty());
+
+		auto pAddFuncType = dynamic_cast<const CFunctionType*>(pImporterSymTable->LookUp("add")->mpType);
+		REQUIRE(pAddFuncType);
+		REQUIRE(pAddFuncType->GetArgsTypes().size() == 2);
+		REQUIRE(pAddFuncType->GetArgsTypes()[1].first == "b");
+		REQUIRE(pAddFuncType->GetReturnValueType()->GetType() == CT_INT32);
+		REQUIRE(pModuleScope->mVariables.size() == 1);
+		REQUIRE(pModuleScope->mNamedScopes.empty());
+
+		// \note mangled names of imported functions should match the names which were emitted by the module itself
+		pSymTable->VisitNamedScope("shapes");
+		REQUIRE(pAddFuncType->GetMangledName() == pSymTable->LookUp("add")->mpType->GetMangledName());
+		pSymTable->LeaveScope();
+
+		auto pPointType = dynamic_cast<const CStructType*>(pImporterSymTable->LookUpNamedScope("Point")->mpType);
+		REQUIRE(pPointType);
+		REQUIRE(pPointType->GetFieldsTypes().size() == 2);
+		REQUIRE(pPointType->GetFieldsTypes()[0].first == "x");
+
+		REQUIRE(pImporterSymTable->VisitNamedScopeWithRestore("Color", [pInterpreter](ISymTable* pSymTable)
+		{
+			REQUIRE(std::get<I64>(pInterpreter->EvalValue(pSymTable->LookUp("Red")->mpValue, pSymTable).Get().mValue) == 0);
+			REQUIRE(std::get<I64>(pInterpreter->EvalValue(pSymTable->LookUp("Blue")->mpValue, pSymTable).Get().mValue) == 6);
+		}) == RV_SUCCESS);
+
+		pImporterSymTable->LeaveScope();
+
+		delete pImporterTypesFactory;
+		delete pImporterSymTable;
+		delete pReader;
+	}
+
+	SECTION("TestWrite_ChangeDefaultValueOfStructField_ChangesInterfaceHashAndLoadedValue")
+	{
+		// \note importers initialize structures with constant defaults by themselves, so the defaults are a part of the interface
+		REQUIRE(pSymTable->VisitNamedScopeWithRestore("shapes", [pNodesFactory](ISymTable* pSymTable)
+		{
+			pSymTable->VisitNamedScopeWithRestore("Point", [pNodesFactory](ISymTable* pSymTable)
+			{
+				pSymTable->LookUp(pSymTable->GetSymbolHandleByName("y"))->mpValue = pNodesFactory->CreateUnaryExpr(TT_DEFAULT, pNodesFactory->CreateLiteralNode(new CIntValue(42)));
+			});
+		}) == RV_SUCCESS);
+
+		TModuleInterfaceInfo otherInfo { 42, 7, "code", "0;0" };
+
+		IModuleInterfaceWriter::TBytesArray otherInterfaceData;
+
+		REQUIRE(pWriter->Write(pSymTable, pInterpreter, "shapes", otherInfo, otherInterfaceData) == RV_SUCCESS);
+		REQUIRE(otherInfo.mInterfaceHash != info.mInterfaceHash);
+
+		IModuleInterfaceReader* pReader = new CModuleInterfaceReader();
+
+		REQUIRE(pReader->Open(otherInterfaceData) == RV_SUCCESS);
+
+		ISymTable*     pImporterSymTable     = new CSymTable();
+		ITypesFactory* pImporterTypesFactory = new CTypesFactory();
+
+		pImporterSymTable->CreateNamedScope("shapes");
+		pModuleResolver->ResolveModuleType(pImporterSymTable, pImporterTypesFactory, "shapes");
+
+		REQUIRE(pReader->Load(pImporterSymTable, pImporterTypesFactory, pNodesFactory) == RV_SUCCESS);
+
+		REQUIRE(pImporterSymTable->VisitNamedScopeWithRestore("Point", [pInterpreter](ISymTable* pSymTable)
+		{
+			const TSymbolDesc* pFieldDesc = pSymTable->LookUp("y");
+
+			REQUIRE(pFieldDesc->mpValue);
+			REQUIRE(!pFieldDesc->mIsConstant);
+			REQUIRE(std::get<I64>(pInterpreter->EvalValue(pFieldDesc->mpValue, pSymTable).Get().mValue) == 42);
+		}) == RV_SUCCESS);
+
+		pImporterSymTable->LeaveScope();
+
+		delete pImporterTypesFactory;
+		delete pImporterSymTable;
+		delete pReader;
+	}
+
+	SECTION("TestAnalyze_ReassignFunctionOfImportedModule_ReturnsFalse")
+	{
+		// \note the module calls its functions directly, so importers can't change them
+		auto analyzeImporter = [=](const std::string& moduleName, const std::string& statement)
+		{
+			IInputStream* pImporterInputStream = new CStubInputStream(
+				{
+					"import \"shapes\" as shapes\n",
+					"sub := (a : int32, b : int32) -> int32 {",
+					"	return a - b;",
+					"};",
+					"main := () -> int32 {",
+					statement,
+					"	return 0;",
+					"};",
+				});
+
+			REQUIRE(pLexer->Init(pImporterInputStream) == RV_SUCCESS);
+
+			pSymTable->CreateNamedScope(moduleName);
+			pModuleResolver->ResolveModuleType(pSymTable, pTypesFactory, moduleName);
+
+			auto pImporterSourceUnit = dynamic_cast<CASTSourceUnitNode*>(pParser->Parse(pLexer, pSymTable, pNodesFactory, pTypesFactory, moduleName));
+			REQUIRE(pImporterSourceUnit);
+
+			const bool result = pSemanticAnalyser->Analyze(pImporterSourceUnit, pTypeResolver, pSymTable, pNodesFactory);
+
+			pSymTable->LeaveScope();
+
+			delete pImporterInputStream;
+
+			return result;
+		};
+
+		REQUIRE(analyzeImporter("caller", "	shapes.add(1, 2);"));
+		REQUIRE(!analyzeImporter("assigner", "	shapes.add = sub;"));
+	}
+
+	SECTION("TestOpen_PassTruncatedInterface_ReturnsError")
+	{
+		IModuleInterfaceReader* pReader = new CModuleInterfaceReader();
+
+		REQUIRE(pReader->Open(IModuleInterfaceWriter::TBytesArray(interfaceData.cbegin(), interfaceData.cbegin() + 20)) != RV_SUCCESS);
+
+		delete pReader;
+	}
+
+	delete pWriter;
+	delete pInputStream;
+	delete pModuleResolver;
+	delete pSemanticAnalyser;
+	delete pParser;
+	delete pLexer;
+	delete pInterpreter;
+	delete pTypeResolver;
+	delete pNodesFactory;
+	delete pTypesFactory;
+	delete pSymTable;
+}
@@ -0,0 +1,185 @@
+#include <catch2/catch.hpp>
+#include <gplc.h>
+#include "../lexer/stubInputStream.h"
+#include <filesystem>
+#include <fstream>
+
+
+using namespace gplc;
+
+
+TEST_CASE("CModuleResolver tests")
+{
+	const std::filesystem::path workingDirectory = std::filesystem::temp_directory_path() / "gplc_module_resolver_tests";
+
+	std::filesystem::remove_all(workingDirectory);
+	std::filesystem::create_directories(workingDirectory);
+
+	const std::string sourceFilename = (workingDirectory / "shapes.gpls").string();
+
+	const std::vector<std::string> sourceLines
+	{
+		"enum Color {",
+		"	Red,",
+		"	Green",
+		"}",
+		"area := (w : int32, h : int32) -> int32 {",
+		"	return w * h;",
+		"};",
+	};
+
+	auto writeSource = [&sourceFilename](const std::vector<std::string>& lines)
+	{
+		std::ofstream sourceFile(sourceFilename, std::ios::trunc);
+
+		for (const std::string& currLine : lines)
+		{
+			sourceFile << currLine << std::endl;
+		}
+	};
+
+	writeSource(sourceLines);
+
+	// \note the stamp is taken before the module is compiled as the driver does
+	TModuleInterfaceInfo sourceStamp;
+
+	ITypesFactory*         pTypesFactory = new CTypesFactory();
+	IASTNodesFactory*      pNodesFactory = new CASTNodesFactory();
+	IConstExprInterpreter* pInterpreter  = new CConstExprInterpreter();
+
+	// \note the module is compiled once to write its interface
+	{
+		ISymTable*         pSymTable         = new CSymTable();
+		ITypeResolver*     pTypeResolver     = new CTypeResolver();
+		ILexer*            pLexer            = new CLexer();
+		IParser*           pParser           = new CParser();
+		ISemanticAnalyser* pSemanticAnalyser = new CSemanticAnalyser();
+		IModuleResolver*   pModuleResolver   = new CModuleResolver();
+
+		REQUIRE(pModuleResolver->TakeSourceStamp(sourceFilename, sourceStamp) == RV_SUCCESS);
+
+		pTypeResolver->Init(pSymTable, pInterpreter, pTypesFactory);
+		pInterpreter->Init(pTypeResolver);
+
+		IInputStream* pInputStream = new CStubInputStream(sourceLines);
+
+		REQUIRE(pLexer->Init(pInputStream) == RV_SUCCESS);
+
+		pSymTable->CreateNamedScope("shapes");
+		pModuleResolver->ResolveModuleType(pSymTable, pTypesFactory, "shapes");
+
+		auto pSourceUnit = dynamic_cast<CASTSourceUnitNode*>(pParser->Parse(pLexer, pSymTable, pNodesFactory, pTypesFactory, "shapes"));
+		REQUIRE(pSourceUnit);
+		REQUIRE(pSemanticAnalyser->Analyze(pSourceUnit, pTypeResolver, pSymTable, pNodesFactory));
+
+		TModuleInterfaceInfo info = sourceStamp;
+		info.mCodeKey = "shapesCode";
+
+		std::vector<U8> interfaceData;
+
+		REQUIRE(pModuleResolver->SaveModuleInterface(pSymTable, pInterpreter, pSourceUnit, sourceFilename, info, interfaceData) == RV_SUCCESS);
+		REQUIRE(std::filesystem::exists(workingDirectory / "shapes.gpli"));
+
+		// \note the interface is renamed into place, so no temporary files are left
+		REQUIRE(std::distance(std::filesystem::directory_iterator(workingDirectory), std::filesystem::directory_iterator()) == 2);
+		REQUIRE(pModuleResolver->GetModuleInterfaceHash("shapes").length() == 40);
+
+		pSymTable->LeaveScope();
+
+		delete pInputStream;
+		delete pModuleResolver;
+		delete pSemanticAnalyser;
+		delete pParser;
+		delete pLexer;
+		delete pTypeResolver;
+		delete pSymTable;
+	}
+
+	ISymTable*       pSymTable       = new CSymTable();
+	IModuleResolver* pModuleResolver = new CModuleResolver();
+
+	std::string loadedCodeKey;
+
+	auto onCompileModule = [](const std::string&, const std::string&, TLLVMIRData&)
+	{
+		return RV_FAIL;
+	};
+
+	auto onLoadModule = [&loadedCodeKey](const std::string& moduleName, const TModuleInterfaceInfo& info, TLLVMIRData& compiledModuleData)
+	{
+		loadedCodeKey      = info.mCodeKey;
+		compiledModuleData = std::string("code of ").append(moduleName);
+
+		return RV_SUCCESS;
+	};
+
+	pSymTable->CreateNamedScope("shapes");
+
+	SECTION("TestResolveFromInterface_PassUnchangedModule_DeclaresItWithoutParsing")
+	{
+		REQUIRE(pModuleResolver->ResolveFromInterface(pSymTable, pTypesFactory, pNodesFactory, workingDirectory.string(), sourceFilename, "shapes",
+													  onCompileModule, onLoadModule) == RV_SUCCESS);
+
+		REQUIRE(loadedCodeKey == "shapesCode");
+		REQUIRE(std::get<std::string>(pModuleResolver->GetModuleEntry("shapes").mCompiledIRCode) == "code of shapes");
+
+		auto pAreaDesc = pSymTable->LookUp("area");
+		REQUIRE(pAreaDesc);
+		REQUIRE(pAreaDesc->mpType->GetType() == CT_FUNCTION);
+		REQUIRE(pSymTable->LookUpNamedScope("Color"));
+	}
+
+	SECTION("TestResolveFromInterface_PassChangedSource_ReturnsFail")
+	{
+		std::vector<std::string> changedSourceLines(sourceLines);
+		changedSourceLines.push_back("perimeter := (w : int32, h : int32) -> int32 { return 2 * (w + h); };");
+
+		writeSource(changedSourceLines);
+
+		REQUIRE(pModuleResolver->ResolveFromInterface(pSymTable, pTypesFactory, pNodesFactory, workingDirectory.string(), sourceFilename, "shapes",
+													  onCompileModule, onLoadModule) == RV_FAIL);
+		REQUIRE(loadedCodeKey.empty());
+		REQUIRE(!pSymTable->LookUp("area"));
+	}
+
+	pSymTable->LeaveScope();
+
+	SECTION("TestGetDependencyGraph_PassModuleWithImport_ContainsPathOfImportedModule")
+	{
+		ILexer*  pLexer  = new CLexer();
+		IParser* pParser = new CParser();
+
+		IInputStream* pInputStream = new CStubInputStream({ "import \"shapes\" as shapes;" });
+
+		REQUIRE(pLexer->Init(pInputStream) == RV_SUCCESS);
+
+		pSymTable->CreateNamedScope("app");
+
+		auto pSourceUnit = dynamic_cast<CASTSourceUnitNode*>(pParser->Parse(pLexer, pSymTable, pNodesFactory, pTypesFactory, "app"));
+		REQUIRE(pSourceUnit);
+
+		REQUIRE(pModuleResolver->Resolve(pSourceUnit, pSymTable, pTypesFactory, pNodesFactory, workingDirectory.string(), onCompileModule, onLoadModule) == RV_SUCCESS);
+
+		pSymTable->LeaveScope();
+
+		const IModuleResolver::TModuleEntry& dependencyGraph = pModuleResolver->GetDependencyGraph();
+
+		REQUIRE(dependencyGraph.mModuleName == "app");
+		REQUIRE(dependencyGraph.mModulePath.empty());
+		REQUIRE(dependencyGraph.mDependencies.size() == 1);
+		REQUIRE(dependencyGraph.mDependencies[0].mModuleName == "shapes");
+		REQUIRE(std::filesystem::path(dependencyGraph.mDependencies[0].mModulePath) == std::filesystem::path(sourceFilename));
+
+		delete pInputStream;
+		delete pParser;
+		delete pLexer;
+	}
+
+	delete pModuleResolver;
+	delete pSymTable;
+	delete pInterpreter;
+	delete pNodesFactory;
+	delete pTypesFactory;
+
+	std::filesystem::remove_all(workingDirectory);
+}
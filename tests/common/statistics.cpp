@@ -0,0 +1,70 @@
+#include <catch2/catch.hpp>
+#include <gplc.h>
+#include "../lexer/stubInputStream.h"
+
+
+using namespace gplc;
+
+
+TEST_CASE("CStatistics tests")
+{
+	CStatistics::Reset();
+
+	SECTION("TestAdd_PassDisabledStatistics_DoesntEvaluateArguments")
+	{
+		CStatistics::SetEnabled(false);
+
+		bool isNameEvaluated = false;
+
+		auto getName = [&isNameEvaluated]()
+		{
+			isNameEvaluated = true;
+
+			return std::string("counter");
+		};
+
+		GPLC_STATISTIC_ADD("group", getName(), 1);
+
+		REQUIRE(!isNameEvaluated);
+		REQUIRE(CStatistics::GetCounters().empty());
+	}
+
+	SECTION("TestAdd_PassEnabledStatistics_AccumulatesCounters")
+	{
+		CStatistics::SetEnabled(true);
+
+		GPLC_STATISTIC_ADD("group", "counter", 2);
+		GPLC_STATISTIC_ADD("group", "counter", 3);
+		GPLC_STATISTIC_MAX("group", "max", 4);
+		GPLC_STATISTIC_MAX("group", "max", 1);
+
+		REQUIRE(CStatistics::GetValue("group", "counter") == 5);
+		REQUIRE(CStatistics::GetValue("group", "max") == 4);
+		REQUIRE(CStatistics::GetValue("group", "unknown") == 0);
+		REQUIRE(CStatistics::ToString().find("group\n") != std::string::npos);
+	}
+
+	SECTION("TestGetNextToken_PassEnabledStatistics_CountsTokensPerType")
+	{
+		CStatistics::SetEnabled(true);
+
+		ILexer* pLexer = new CLexer();
+
+		IInputStream* pInputStream = new CStubInputStream({ "x : int32 = y;" });
+
+		REQUIRE(pLexer->Init(pInputStream) == RV_SUCCESS);
+
+		while (pLexer->GetNextToken())
+		{
+		}
+
+		REQUIRE(CStatistics::GetValue("lexer", std::string("tokens ").append(TokenTypeToString(TT_IDENTIFIER))) == 2);
+		REQUIRE(CStatistics::GetValue("lexer", std::string("tokens ").append(TokenTypeToString(TT_INT32_TYPE))) == 1);
+
+		delete pInputStream;
+		delete pLexer;
+	}
+
+	CStatistics::SetEnabled(false);
+	CStatistics::Reset();
+}
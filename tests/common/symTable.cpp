@@ -220,6 +220,128 @@ TEST_CASE("CSymTable tests")
 
 		pSymTable->LeaveScope();
 	}
+
+
+	SECTION("TestLookUp_PassNameOfLazySymbol_DeclaresItOnFirstLookUp")
+	{
+		U32 loaderCallsCount = 0;
+
+		pSymTable->CreateNamedScope("Module");
+
+		REQUIRE(pSymTable->SetLazySymbolsLoader([&loaderCallsCount](ISymTable* pSymTable, const std::string& name) -> Result
+		{
+			++loaderCallsCount;
+
+			if (name == "Enum")
+			{
+				return pSymTable->CreateNamedScope(name) == RV_SUCCESS ? pSymTable->LeaveScope() : RV_FAIL;
+			}
+
+			return (name == "x") && (pSymTable->AddVariable({ name, nullptr, new gplc::CType(gplc::CT_INT32, gplc::BTS_INT32, 0x0) }) != InvalidSymbolHandle) ? RV_SUCCESS : RV_FAIL;
+		}) == RV_SUCCESS);
+
+		pSymTable->LeaveScope();
+
+		REQUIRE(pSymTable->LookUpNamedScope("Module")->mVariables.empty());
+
+		pSymTable->VisitNamedScope("Module");
+
+		checkAsserts(pSymTable->LookUp("x"), gplc::CT_INT32);
+		checkAsserts(pSymTable->LookUp("x"), gplc::CT_INT32);
+		REQUIRE(loaderCallsCount == 1);
+
+		REQUIRE(!pSymTable->LookUp("y"));
+		REQUIRE(pSymTable->LookUpNamedScope("Enum"));
+
+		pSymTable->LeaveScope();
+
+		REQUIRE(pSymTable->LookUpNamedScope("Module")->mVariables.size() == 1);
+		REQUIRE(pSymTable->LookUpNamedScope("Module")->mNamedScopes.size() == 1);
+	}
+
+	SECTION("TestVisitNamedScopeWithRestore_VisitFromNestedScope_DoesntChangeTraversalOfOuterScopes")
+	{
+		pSymTable->CreateNamedScope("Module");
+		{
+			pSymTable->CreateScope();
+			{
+				pSymTable->CreateScope();
+				pSymTable->LeaveScope();
+
+				pSymTable->CreateScope();
+				pSymTable->LeaveScope();
+			}
+			pSymTable->LeaveScope();
+		}
+		pSymTable->LeaveScope();
+
+		pSymTable->CreateNamedScope("Imported");
+		pSymTable->LeaveScope();
+
+		pSymTable->CreateScope();
+		pSymTable->AddVariable({ "z", nullptr, new gplc::CType(gplc::CT_INT64, gplc::BTS_INT64, 0x0) });
+		pSymTable->LeaveScope();
+
+		REQUIRE(pSymTable->VisitNamedScope("Module") == RV_SUCCESS);
+		{
+			REQUIRE(pSymTable->VisitScope() == RV_SUCCESS);
+			{
+				REQUIRE(pSymTable->VisitScope() == RV_SUCCESS);
+				REQUIRE(pSymTable->LeaveScope() == RV_SUCCESS);
+
+				// \note a lookup of an imported module's symbol in the middle of a function
+				REQUIRE(pSymTable->VisitNamedScopeWithRestore("Imported", [](ISymTable*) {}) == RV_SUCCESS);
+
+				REQUIRE(pSymTable->VisitScope() == RV_SUCCESS);
+				REQUIRE(pSymTable->LeaveScope() == RV_SUCCESS);
+			}
+			REQUIRE(pSymTable->LeaveScope() == RV_SUCCESS);
+		}
+		REQUIRE(pSymTable->LeaveScope() == RV_SUCCESS);
+
+		REQUIRE(pSymTable->VisitScope() == RV_SUCCESS);
+		checkAsserts(pSymTable->LookUp("z"), gplc::CT_INT64);
+		REQUIRE(pSymTable->LeaveScope() == RV_SUCCESS);
+	}
+
+	SECTION("TestVisitScopeWithRestore_PassHandleOfOuterScope_ResolvesShadowedNamesWithinIt")
+	{
+		pSymTable->CreateScope();
+		pSymTable->AddVariable({ "x", nullptr, new gplc::CType(gplc::CT_INT32, gplc::BTS_INT32, 0x0) });
+		pSymTable->CreateScope();
+		pSymTable->AddVariable({ "x", nullptr, new gplc::CType(gplc::CT_INT16, gplc::BTS_INT16, 0x0) });
+		pSymTable->LeaveScope();
+		pSymTable->LeaveScope();
+
+		REQUIRE(pSymTable->VisitScope() == RV_SUCCESS);
+		{
+			auto outerScopeHandle = pSymTable->GetCurrentScopeHandle();
+
+			REQUIRE(pSymTable->VisitScope() == RV_SUCCESS);
+
+			checkAsserts(pSymTable->LookUp("x"), gplc::CT_INT16);
+
+			REQUIRE(pSymTable->VisitScopeWithRestore(outerScopeHandle, [&checkAsserts](ISymTable* pTable)
+			{
+				checkAsserts(pTable->LookUp("x"), gplc::CT_INT32);
+			}) == RV_SUCCESS);
+
+			checkAsserts(pSymTable->LookUp("x"), gplc::CT_INT16);
+
+			REQUIRE(pSymTable->LeaveScope() == RV_SUCCESS);
+			REQUIRE(pSymTable->GetCurrentScopeHandle() == outerScopeHandle);
+		}
+		REQUIRE(pSymTable->LeaveScope() == RV_SUCCESS);
+	}
+
+	SECTION("TestGetSymbolHandleByName_PassReservedIdentifier_ReturnsHandleOfRenamedSymbol")
+	{
+		TSymbolHandle mainHandle = pSymTable->AddVariable({ "main", nullptr, new gplc::CFunctionType({}, new gplc::CType(gplc::CT_INT32, gplc::BTS_INT32, 0x0)) });
+
+		REQUIRE(mainHandle != InvalidSymbolHandle);
+		REQUIRE(pSymTable->GetSymbolHandleByName("main") == mainHandle);
+		REQUIRE(pSymTable->LookUp(pSymTable->GetSymbolHandleByName("main")) == pSymTable->LookUp("main"));
+	}
 	
 	delete pSymTable;
 }
\ No newline at end of file
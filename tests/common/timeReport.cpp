@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+#include <gplc.h>
+
+
+using namespace gplc;
+
+
+TEST_CASE("CTimeReport tests")
+{
+	ITimeReport* pTimeReport = new CTimeReport("gplc");
+
+	SECTION("TestBeginPhase_PassNestedPhases_BuildsTreeOfPhases")
+	{
+		{
+			CTimeReportScope modulePhase(pTimeReport, "app");
+			CTimeReportScope stagePhase(pTimeReport, "Lexing & parsing");
+
+			stagePhase.NextPhase("Module resolution");
+
+			CTimeReportScope importedModulePhase(pTimeReport, "math");
+		}
+
+		CTimeReportScope linkingPhase(pTimeReport, "Linking");
+
+		const ITimeReport::TPhaseInfo& rootPhase = pTimeReport->GetRootPhase();
+
+		REQUIRE(rootPhase.mName == "gplc");
+		REQUIRE(rootPhase.mChildren.size() == 2);
+		REQUIRE(rootPhase.mChildren[1].mName == "Linking");
+
+		const ITimeReport::TPhaseInfo& modulePhase = rootPhase.mChildren[0];
+
+		REQUIRE(modulePhase.mName == "app");
+		REQUIRE(modulePhase.mChildren.size() == 2);
+		REQUIRE(modulePhase.mChildren[0].mName == "Lexing & parsing");
+		REQUIRE(modulePhase.mChildren[1].mName == "Module resolution");
+		REQUIRE(modulePhase.mChildren[1].mChildren.size() == 1);
+		REQUIRE(modulePhase.mChildren[1].mChildren[0].mName == "math");
+
+		REQUIRE(modulePhase.mWallTime >= modulePhase.mChildren[1].mWallTime);
+		REQUIRE(rootPhase.mWallTime >= modulePhase.mWallTime);
+	}
+
+	SECTION("TestToJSON_PassPhaseWithQuotesAndControlCharacters_ReturnsEscapedNames")
+	{
+		{
+			CTimeReportScope phase(pTimeReport, "\"quoted\"");
+		}
+
+		{
+			CTimeReportScope phase(pTimeReport, "two\nlines\x01");
+		}
+
+		const std::string json = pTimeReport->ToJSON();
+
+		REQUIRE(json.find("{\"name\":\"gplc\"") == 0);
+		REQUIRE(json.find("\"children\":[{\"name\":\"\\\"quoted\\\"\"") != std::string::npos);
+		REQUIRE(json.find("\"wall_ms\":") != std::string::npos);
+		REQUIRE(json.find("{\"name\":\"two\\u000alines\\u0001\"") != std::string::npos);
+		REQUIRE(json.find('\n') == json.length() - 1);
+		REQUIRE(json.find("\"process_peak_rss_kb\":") != std::string::npos);
+		REQUIRE(json.find("\"peak_rss_growth_kb\":") != std::string::npos);
+	}
+
+	SECTION("TestToTraceEvents_PassNestedPhases_ReturnsCompleteEventPerPhase")
+	{
+		{
+			CTimeReportScope modulePhase(pTimeReport, "app");
+			CTimeReportScope importedModulePhase(pTimeReport, "math");
+		}
+
+		const std::string trace = pTimeReport->ToTraceEvents();
+
+		REQUIRE(trace.find("{\"traceEvents\":[") == 0);
+		REQUIRE(trace.find("\"name\":\"process_name\",\"ph\":\"M\"") != std::string::npos);
+
+		size_t eventsCount = 0;
+
+		for (size_t pos = trace.find("\"ph\":\"X\""); pos != std::string::npos; pos = trace.find("\"ph\":\"X\"", pos + 1))
+		{
+			++eventsCount;
+		}
+
+		REQUIRE(eventsCount == 3);
+		REQUIRE(trace.find("{\"name\":\"app\",\"cat\":\"gplc\",\"ph\":\"X\"") < trace.find("{\"name\":\"math\","));
+		REQUIRE(trace.find("\"displayTimeUnit\":\"ms\"}") != std::string::npos);
+	}
+
+	SECTION("TestScope_PassNullReport_DoesNothing")
+	{
+		CTimeReportScope phase(nullptr, "unused");
+
+		phase.NextPhase("unused");
+
+		REQUIRE(pTimeReport->GetRootPhase().mChildren.empty());
+	}
+
+	delete pTimeReport;
+}
@@ -0,0 +1,218 @@
+#include <catch2/catch.hpp>
+#include <gplc.h>
+
+
+using namespace gplc;
+
+
+TEST_CASE("CType and CTypeResolver tests")
+{
+	ISymTable* pSymTable = new CSymTable();
+
+	ITypesFactory* pTypesFactory = new CTypesFactory();
+
+	IConstExprInterpreter* pInterpreter = new CConstExprInterpreter();
+
+	ITypeResolver* pTypeResolver = new CTypeResolver();
+
+	pTypeResolver->Init(pSymTable, pInterpreter, pTypesFactory);
+
+	SECTION("TestAreConvertibleTo_PassBuiltinTypes_ReturnsCorrectResults")
+	{
+		CType int8Type(CT_INT8, BTS_INT8, 0x0);
+		CType uint64Type(CT_UINT64, BTS_UINT64, 0x0);
+		CType floatType(CT_FLOAT, BTS_FLOAT, 0x0);
+		CType doubleType(CT_DOUBLE, BTS_DOUBLE, 0x0);
+		CType boolType(CT_BOOL, BTS_BOOL, 0x0);
+		CType charType(CT_CHAR, BTS_CHAR, 0x0);
+		CType stringType(CT_STRING, BTS_POINTER, 0x0);
+
+		REQUIRE(int8Type.AreConvertibleTo(&uint64Type));
+		REQUIRE(uint64Type.AreConvertibleTo(&int8Type));
+		REQUIRE(floatType.AreConvertibleTo(&doubleType));
+		REQUIRE(doubleType.AreConvertibleTo(&floatType));
+		REQUIRE(charType.AreConvertibleTo(&stringType));
+		REQUIRE(boolType.AreConvertibleTo(&stringType));
+
+		REQUIRE(!int8Type.AreConvertibleTo(&floatType));
+		REQUIRE(!boolType.AreConvertibleTo(&int8Type));
+		REQUIRE(!stringType.AreConvertibleTo(&charType));
+		REQUIRE(!int8Type.AreConvertibleTo(nullptr));
+	}
+
+	SECTION("TestGetCommonArithmeticType_PassOperandsTypes_ReturnsPromotedType")
+	{
+		REQUIRE(GetCommonArithmeticType(CT_INT32, CT_INT32) == CT_INT32);
+		REQUIRE(GetCommonArithmeticType(CT_INT8, CT_INT64) == CT_INT64);
+		REQUIRE(GetCommonArithmeticType(CT_UINT16, CT_INT16) == CT_UINT16);
+		REQUIRE(GetCommonArithmeticType(CT_INT64, CT_DOUBLE) == CT_DOUBLE);
+		REQUIRE(GetCommonArithmeticType(CT_FLOAT, CT_DOUBLE) == CT_DOUBLE);
+		REQUIRE(GetCommonArithmeticType(CT_BOOL, CT_INT32) == CT_LAST);
+		REQUIRE(GetCommonArithmeticType(CT_STRUCT, CT_FLOAT) == CT_LAST);
+	}
+
+	SECTION("TestResolve_PassBinaryExpressionWithDifferentIntegralTypes_ReturnsWiderType")
+	{
+		auto pExpr = new CASTBinaryExpressionNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(42))),
+												  TT_PLUS,
+												  new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(42, true))));
+
+		CType* pType = pTypeResolver->Resolve(pExpr);
+
+		REQUIRE(pType);
+		REQUIRE(pType->GetType() == CT_INT64);
+
+		delete pExpr;
+	}
+
+	SECTION("TestResolve_PassComparisonOfIncompatibleTypes_ReturnsNullptr")
+	{
+		auto pExpr = new CASTBinaryExpressionNode(new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CBoolValue(true))),
+												  TT_LT,
+												  new CASTUnaryExpressionNode(TT_DEFAULT, new CASTLiteralNode(new CIntValue(42))));
+
+		REQUIRE(!pTypeResolver->Resolve(pExpr));
+
+		delete pExpr;
+	}
+
+	SECTION("TestGetLayoutInfo_PassStructWithPaddings_ReturnsDeclarationOrderLayout")
+	{
+		/*!
+			struct Foo { a : int8; b : int64; c : int16; }
+		*/
+		CStructType structType({ { "a", new CType(CT_INT8, BTS_INT8, 0x0) }, { "b", new CType(CT_INT64, BTS_INT64, 0x0) }, { "c", new CType(CT_INT16, BTS_INT16, 0x0) } });
+
+		auto layout = structType.GetLayoutInfo();
+
+		REQUIRE(layout.mFieldsOrder == std::vector<U32> { 0, 1, 2 });
+		REQUIRE(layout.mFieldsOffsets == std::vector<U32> { 0, 8, 16 });
+		REQUIRE(layout.mAlignment == 8);
+		REQUIRE(structType.GetSize() == 24);
+		REQUIRE(structType.GetFieldIndex("c") == 2);
+		REQUIRE(structType.GetFieldIndex("d") == -1);
+	}
+
+	SECTION("TestGetLayoutInfo_PassReorderedStruct_ReturnsLayoutWithoutPaddings")
+	{
+		/*!
+			struct @reorder Foo { a : int8; b : int64; c : int16; }
+		*/
+		CStructType structType({ { "a", new CType(CT_INT8, BTS_INT8, 0x0) }, { "b", new CType(CT_INT64, BTS_INT64, 0x0) }, { "c", new CType(CT_INT16, BTS_INT16, 0x0) } }, 
+							   AV_AGGREGATE_TYPE | AV_REORDER_FIELDS);
+
+		auto layout = structType.GetLayoutInfo();
+
+		REQUIRE(layout.mFieldsOrder == std::vector<U32> { 1, 2, 0 });
+		REQUIRE(layout.mFieldsOffsets == std::vector<U32> { 10, 0, 8 });
+		REQUIRE(structType.GetSize() == 16);
+		REQUIRE(structType.GetFieldIndex("a") == 2);
+		REQUIRE(structType.GetFieldIndex("b") == 0);
+	}
+
+	SECTION("TestGetLayoutInfo_PassPackedStruct_ReturnsLayoutWithoutPaddings")
+	{
+		/*!
+			struct @packed Foo { a : int8; b : int64; c : int16; }
+		*/
+		CStructType structType({ { "a", new CType(CT_INT8, BTS_INT8, 0x0) }, { "b", new CType(CT_INT64, BTS_INT64, 0x0) }, { "c", new CType(CT_INT16, BTS_INT16, 0x0) } },
+							   AV_AGGREGATE_TYPE | AV_PACKED_LAYOUT);
+
+		auto layout = structType.GetLayoutInfo();
+
+		REQUIRE(layout.mFieldsOffsets == std::vector<U32> { 0, 1, 9 });
+		REQUIRE(layout.mAlignment == 1);
+		REQUIRE(structType.GetSize() == 11);
+	}
+
+	SECTION("TestGetLayoutInfo_PassTargetAlignmentsAndChangeFields_RecomputesCachedLayouts")
+	{
+		/*!
+			struct Inner { a : int8; b : int64; }
+			struct Outer { c : int8; inner : Inner; }
+		*/
+		auto createTypes = [](ITypesFactory* pFactory)
+		{
+			CStructType* pInnerType = pFactory->CreateStructType({ { "a", pFactory->CreateType(CT_INT8, BTS_INT8, 0x0) }, { "b", pFactory->CreateType(CT_INT64, BTS_INT64, 0x0) } });
+			CStructType* pOuterType = pFactory->CreateStructType({ { "c", pFactory->CreateType(CT_INT8, BTS_INT8, 0x0) }, { "inner", pInnerType } });
+
+			return std::make_pair(pInnerType, pOuterType);
+		};
+
+		auto defaultTypes = createTypes(pTypesFactory);
+
+		REQUIRE(defaultTypes.second->GetSize() == 24);
+		REQUIRE(&defaultTypes.second->GetLayoutInfo() == &defaultTypes.second->GetLayoutInfo());
+
+		// \note int64 is aligned by 4 bytes on 32 bits x86, types of another factory aren't affected by these alignments
+		TTargetAlignmentsInfo alignments;
+		alignments.mIntegersAlignments = { { BTS_INT8, 1 }, { BTS_INT64, 4 } };
+
+		ITypesFactory* pTargetTypesFactory = new CTypesFactory(alignments);
+
+		auto targetTypes = createTypes(pTargetTypesFactory);
+
+		REQUIRE(targetTypes.first->GetLayoutInfo().mFieldsOffsets == std::vector<U32> { 0, 4 });
+		REQUIRE(targetTypes.second->GetSize() == 16);
+		REQUIRE(defaultTypes.second->GetSize() == 24);
+
+		targetTypes.first->AddField("d", pTargetTypesFactory->CreateType(CT_INT8, BTS_INT8, 0x0));
+
+		REQUIRE(targetTypes.first->GetSize() == 16);
+		REQUIRE(targetTypes.second->GetSize() == 20);
+
+		defaultTypes.first->AddField("d", pTypesFactory->CreateType(CT_INT8, BTS_INT8, 0x0));
+
+		REQUIRE(defaultTypes.second->GetSize() == 32);
+
+		delete pTargetTypesFactory;
+	}
+
+	SECTION("TestGetSize_PassArrayOfSoAStructs_ReturnsSizeOfFieldsArrays")
+	{
+		/*!
+			struct @soa Foo { a : int8; b : int64; c : int16; }
+
+			arr : Foo[3];
+		*/
+		CStructType* pStructType = new CStructType({ { "a", new CType(CT_INT8, BTS_INT8, 0x0) }, { "b", new CType(CT_INT64, BTS_INT64, 0x0) }, { "c", new CType(CT_INT16, BTS_INT16, 0x0) } },
+												   AV_AGGREGATE_TYPE | AV_SOA_LAYOUT);
+
+		CArrayType soaArrayType(pStructType, 3);
+
+		REQUIRE(soaArrayType.GetSoAElementType() == pStructType);
+		REQUIRE(soaArrayType.GetSize() == 48); // { [3 x i8], [3 x i64], [3 x i16] } + length
+
+		CStructType* pOrdinaryStructType = new CStructType({ { "a", new CType(CT_INT8, BTS_INT8, 0x0) }, { "b", new CType(CT_INT64, BTS_INT64, 0x0) }, { "c", new CType(CT_INT16, BTS_INT16, 0x0) } });
+
+		CArrayType arrayType(pOrdinaryStructType, 3);
+
+		REQUIRE(!arrayType.GetSoAElementType());
+		REQUIRE(arrayType.GetSize() == 80);
+
+		delete pStructType;
+		delete pOrdinaryStructType;
+	}
+
+	SECTION("TestGetTag_PassAlternativesOfVariant_ReturnsDenseTags")
+	{
+		/*!
+			variant Data { int32, float, string }
+		*/
+		CVariantType variantType({ new CType(CT_INT32, BTS_INT32, 0x0), new CType(CT_FLOAT, BTS_FLOAT, 0x0), new CType(CT_STRING, BTS_POINTER, 0x0) }, "Data");
+
+		CType int32Type(CT_INT32, BTS_INT32, 0x0);
+		CType stringType(CT_STRING, BTS_POINTER, 0x0);
+		CType boolType(CT_BOOL, BTS_BOOL, 0x0);
+
+		REQUIRE(variantType.GetTag(&int32Type) == 0);
+		REQUIRE(variantType.GetTag(&stringType) == 2);
+		REQUIRE(variantType.GetTag(&boolType) == -1);
+		REQUIRE(variantType.GetTagSize() == 1);
+	}
+
+	delete pTypeResolver;
+	delete pInterpreter;
+	delete pTypesFactory;
+	delete pSymTable;
+}
@@ -351,7 +351,7 @@ TEST_CASE("Lexer's tests")
 	{
 		IInputStream* pInputStream = new CStubInputStream(
 			{
-				"@foreign@uninit"
+				"@foreign@uninit@unchecked@vectorize(4)@novectorize@unroll@restrict@inline@noinline"
 			});
 
 		REQUIRE(pLexer->Init(pInputStream) == gplc::RV_SUCCESS);
@@ -360,6 +360,23 @@ TEST_CASE("Lexer's tests")
 		REQUIRE(pLexer->GetNextToken()->GetType() == TT_FOREIGN_KEYWORD);
 		REQUIRE(pLexer->GetNextToken()->GetType() == TT_AT_SIGN);
 		REQUIRE(pLexer->GetNextToken()->GetType() == TT_UNINIT_KEYWORD);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_AT_SIGN);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_UNCHECKED_KEYWORD);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_AT_SIGN);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_VECTORIZE_KEYWORD);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_OPEN_BRACKET);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_LITERAL);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_CLOSE_BRACKET);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_AT_SIGN);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_NOVECTORIZE_KEYWORD);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_AT_SIGN);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_UNROLL_KEYWORD);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_AT_SIGN);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_RESTRICT_KEYWORD);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_AT_SIGN);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_INLINE_KEYWORD);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_AT_SIGN);
+		REQUIRE(pLexer->GetNextToken()->GetType() == TT_NOINLINE_KEYWORD);
 		REQUIRE(!pLexer->GetNextToken());
 
 		delete pInputStream;
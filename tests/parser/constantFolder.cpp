@@ -0,0 +1,139 @@
+#include <catch2/catch.hpp>
+#include <gplc.h>
+
+
+using namespace gplc;
+
+
+TEST_CASE("CConstantFolder tests")
+{
+	IASTNodesFactory*      pNodesFactory = new CASTNodesFactory();
+	ISymTable*             pSymTable     = new CSymTable();
+	IConstExprInterpreter* pInterpreter  = new CConstExprInterpreter();
+	IConstantFolder*       pFolder       = new CConstantFolder();
+
+	auto createIntLiteral = [pNodesFactory](I64 value)
+	{
+		return pNodesFactory->CreateUnaryExpr(TT_DEFAULT, pNodesFactory->CreateLiteralNode(new CIntValue(value)));
+	};
+
+	auto createIdentifier = [pNodesFactory](const std::string& name)
+	{
+		return pNodesFactory->CreateUnaryExpr(TT_DEFAULT, pNodesFactory->CreateIdNode(name));
+	};
+
+	auto createDefinition = [pNodesFactory](const std::string& name, CASTNode* pValue)
+	{
+		auto pIdentifiers = pNodesFactory->CreateNode(NT_IDENTIFIERS_LIST);
+		pIdentifiers->AttachChild(pNodesFactory->CreateIdNode(name));
+
+		return pNodesFactory->CreateDefNode(pNodesFactory->CreateDeclNode(pIdentifiers, pNodesFactory->CreateTypeNode(NT_INT32)), pValue);
+	};
+
+	SECTION("TestFold_PassLiteralOnlyExpression_ReplacesItWithLiteral")
+	{
+		pSymTable->CreateNamedScope("main");
+		pSymTable->LeaveScope();
+
+		// x : int32 = 2 * 3 + 4;
+		auto pDefinition = createDefinition("x", pNodesFactory->CreateBinaryExpr(pNodesFactory->CreateBinaryExpr(createIntLiteral(2), TT_STAR, createIntLiteral(3)),
+																				 TT_PLUS,
+																				 createIntLiteral(4)));
+
+		auto pSourceUnit = pNodesFactory->CreateSourceUnitNode("main");
+		pSourceUnit->AttachChild(pDefinition);
+
+		REQUIRE(pFolder->Fold(pSourceUnit, pSymTable, pInterpreter, pNodesFactory) == RV_SUCCESS);
+
+		auto pValue = dynamic_cast<CASTUnaryExpressionNode*>(pDefinition->GetValue());
+		REQUIRE(pValue);
+
+		auto pLiteral = dynamic_cast<CASTLiteralNode*>(pValue->GetData());
+		REQUIRE(pLiteral);
+		REQUIRE(dynamic_cast<CIntValue*>(pLiteral->GetValue())->GetValue() == 10);
+	}
+
+	SECTION("TestFold_PassIdentityOperations_ReturnsTheirOperands")
+	{
+		pSymTable->CreateNamedScope("main");
+		pSymTable->LeaveScope();
+
+		// y : int32 = x * 1 + 0;
+		auto pOperand = createIdentifier("x");
+
+		auto pDefinition = createDefinition("y", pNodesFactory->CreateBinaryExpr(pNodesFactory->CreateBinaryExpr(pOperand, TT_STAR, createIntLiteral(1)),
+																				 TT_PLUS,
+																				 createIntLiteral(0)));
+
+		// z = !!b;
+		auto pBoolOperand = createIdentifier("b");
+
+		auto pAssignment = pNodesFactory->CreateAssignNode(createIdentifier("z"),
+														   pNodesFactory->CreateUnaryExpr(TT_NOT, pNodesFactory->CreateUnaryExpr(TT_NOT, pBoolOperand)));
+
+		auto pSourceUnit = pNodesFactory->CreateSourceUnitNode("main");
+		pSourceUnit->AttachChild(pDefinition);
+		pSourceUnit->AttachChild(pAssignment);
+
+		REQUIRE(pFolder->Fold(pSourceUnit, pSymTable, pInterpreter, pNodesFactory) == RV_SUCCESS);
+		REQUIRE(pDefinition->GetValue() == pOperand);
+		REQUIRE(pAssignment->GetRight() == pBoolOperand);
+	}
+
+	SECTION("TestFold_PassIfStatementWithConstantCondition_PrunesDeadBranch")
+	{
+		// scopes of then, else and loop's blocks which are created by the semantic analyser
+		pSymTable->CreateNamedScope("main");
+		{
+			pSymTable->CreateScope();
+			pSymTable->AddVariable({ "a", nullptr, new CType(CT_INT32, BTS_INT32, 0x0) });
+			pSymTable->LeaveScope();
+
+			pSymTable->CreateScope();
+			pSymTable->AddVariable({ "b", nullptr, new CType(CT_INT32, BTS_INT32, 0x0) });
+			pSymTable->LeaveScope();
+
+			pSymTable->CreateScope();
+			pSymTable->AddVariable({ "c", nullptr, new CType(CT_INT32, BTS_INT32, 0x0) });
+			pSymTable->LeaveScope();
+		}
+		pSymTable->LeaveScope();
+
+		// if 2 < 1 { } else { } loop { }
+		auto pThenBlock = pNodesFactory->CreateBlockNode();
+		auto pElseBlock = pNodesFactory->CreateBlockNode();
+		auto pLoopBody  = pNodesFactory->CreateBlockNode();
+
+		auto pCondition = pNodesFactory->CreateBinaryExpr(createIntLiteral(2), TT_LT, createIntLiteral(1));
+
+		auto pSourceUnit = pNodesFactory->CreateSourceUnitNode("main");
+		pSourceUnit->AttachChild(pNodesFactory->CreateIfStmtNode(pCondition, pThenBlock, pElseBlock));
+		pSourceUnit->AttachChild(pNodesFactory->CreateLoopStmtNode(pLoopBody));
+
+		REQUIRE(pFolder->Fold(pSourceUnit, pSymTable, pInterpreter, pNodesFactory) == RV_SUCCESS);
+
+		auto pIfStatement = dynamic_cast<CASTIfStatementNode*>(pSourceUnit->GetStatements()[0]);
+		REQUIRE(pIfStatement);
+		REQUIRE(pIfStatement->GetThenBlock() == pElseBlock);
+		REQUIRE(!pIfStatement->GetElseBlock());
+
+		// the scope of the removed block should be removed too
+		pSymTable->VisitNamedScope("main");
+		{
+			pSymTable->VisitScope();
+			REQUIRE(pSymTable->LookUp("b"));
+			REQUIRE(!pSymTable->LookUp("a"));
+			pSymTable->LeaveScope();
+
+			pSymTable->VisitScope();
+			REQUIRE(pSymTable->LookUp("c"));
+			pSymTable->LeaveScope();
+		}
+		pSymTable->LeaveScope();
+	}
+
+	delete pFolder;
+	delete pInterpreter;
+	delete pSymTable;
+	delete pNodesFactory;
+}
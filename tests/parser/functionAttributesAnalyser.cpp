@@ -0,0 +1,107 @@
+#include <catch2/catch.hpp>
+#include <gplc.h>
+
+
+using namespace gplc;
+
+
+TEST_CASE("CFunctionAttributesAnalyser tests")
+{
+	IASTNodesFactory*            pNodesFactory = new CASTNodesFactory();
+	ISymTable*                   pSymTable     = new CSymTable();
+	IFunctionAttributesAnalyser* pAnalyser     = new CFunctionAttributesAnalyser();
+
+	auto createIdentifier = [pNodesFactory](const std::string& name)
+	{
+		return pNodesFactory->CreateUnaryExpr(TT_DEFAULT, pNodesFactory->CreateIdNode(name));
+	};
+
+	auto createDeclaration = [pNodesFactory](const std::string& name)
+	{
+		auto pIdentifiers = pNodesFactory->CreateNode(NT_IDENTIFIERS_LIST);
+		pIdentifiers->AttachChild(pNodesFactory->CreateIdNode(name));
+
+		return pNodesFactory->CreateDeclNode(pIdentifiers, pNodesFactory->CreateTypeNode(NT_INT32));
+	};
+
+	// name : (x : int32) -> int32 = { <statements> }
+	auto createFunction = [pNodesFactory, createDeclaration](const std::string& name, const std::vector<CASTNode*>& statements)
+	{
+		auto pArgs = pNodesFactory->CreateFuncArgsNode();
+		pArgs->AttachChild(createDeclaration("x"));
+
+		auto pLambdaType = pNodesFactory->CreateFuncDeclNode(nullptr, pArgs, pNodesFactory->CreateTypeNode(NT_INT32));
+
+		auto pBody = pNodesFactory->CreateBlockNode();
+
+		for (auto pCurrStatement : statements)
+		{
+			pBody->AttachChild(pCurrStatement);
+		}
+
+		return pNodesFactory->CreateFuncDefNode(createDeclaration(name), pLambdaType, pBody);
+	};
+
+	SECTION("TestAnalyze_PassFunctionsWithDifferentMemoryAccess_MarksThemCorrectly")
+	{
+		// pure : (x : int32) -> int32 = { return x * 2; }
+		auto pPureFunction = createFunction("pure", { pNodesFactory->CreateReturnStmtNode(pNodesFactory->CreateBinaryExpr(createIdentifier("x"), TT_STAR,
+																																		 pNodesFactory->CreateUnaryExpr(TT_DEFAULT, pNodesFactory->CreateLiteralNode(new CIntValue(2))))) });
+
+		// reader : (x : int32) -> int32 = { return x + g; }
+		auto pReaderFunction = createFunction("reader", { pNodesFactory->CreateReturnStmtNode(pNodesFactory->CreateBinaryExpr(createIdentifier("x"), TT_PLUS, createIdentifier("g"))) });
+
+		// writer : (x : int32) -> int32 = { g = x; return x; }
+		auto pWriterFunction = createFunction("writer", { pNodesFactory->CreateAssignNode(createIdentifier("g"), createIdentifier("x")),
+														  pNodesFactory->CreateReturnStmtNode(createIdentifier("x")) });
+
+		// caller : (x : int32) -> int32 = { y : int32; y = pure(x); return y; }
+		auto pCallArgs = pNodesFactory->CreateNode(NT_FUNC_ARGS);
+		pCallArgs->AttachChild(createIdentifier("x"));
+
+		auto pCallerFunction = createFunction("caller", { createDeclaration("y"),
+														  pNodesFactory->CreateAssignNode(createIdentifier("y"), pNodesFactory->CreateUnaryExpr(TT_DEFAULT, pNodesFactory->CreateFuncCallNode(createIdentifier("pure"), pCallArgs))),
+														  pNodesFactory->CreateReturnStmtNode(createIdentifier("y")) });
+
+		pSymTable->CreateNamedScope("main");
+		pSymTable->AddVariable({ "g", nullptr, new CType(CT_INT32, BTS_INT32, 0x0) });
+		pSymTable->AddVariable({ "pure", nullptr, new CFunctionType({}, new CType(CT_INT32, BTS_INT32, 0x0)), pPureFunction });
+		pSymTable->LeaveScope();
+
+		auto pSourceUnit = pNodesFactory->CreateSourceUnitNode("main");
+		pSourceUnit->AttachChild(pPureFunction);
+		pSourceUnit->AttachChild(pReaderFunction);
+		pSourceUnit->AttachChild(pWriterFunction);
+		pSourceUnit->AttachChild(pCallerFunction);
+
+		REQUIRE(pAnalyser->Analyze(pSourceUnit, pSymTable) == RV_SUCCESS);
+
+		REQUIRE((pPureFunction->GetAttributes() & AV_READNONE));
+		REQUIRE((pReaderFunction->GetAttributes() & AV_READONLY));
+		REQUIRE(!(pWriterFunction->GetAttributes() & (AV_READNONE | AV_READONLY)));
+		REQUIRE((pCallerFunction->GetAttributes() & AV_READNONE));
+	}
+
+	SECTION("TestAnalyze_PassCallOfUnknownFunction_DoesntMarkCaller")
+	{
+		// caller : (x : int32) -> int32 = { return puts(x); }
+		auto pCallArgs = pNodesFactory->CreateNode(NT_FUNC_ARGS);
+		pCallArgs->AttachChild(createIdentifier("x"));
+
+		auto pCallerFunction = createFunction("caller", { pNodesFactory->CreateReturnStmtNode(pNodesFactory->CreateUnaryExpr(TT_DEFAULT, pNodesFactory->CreateFuncCallNode(createIdentifier("puts"), pCallArgs))) });
+
+		pSymTable->CreateNamedScope("main");
+		pSymTable->AddVariable({ "puts", nullptr, new CFunctionType({}, new CType(CT_INT32, BTS_INT32, 0x0), AV_NATIVE_FUNC) });
+		pSymTable->LeaveScope();
+
+		auto pSourceUnit = pNodesFactory->CreateSourceUnitNode("main");
+		pSourceUnit->AttachChild(pCallerFunction);
+
+		REQUIRE(pAnalyser->Analyze(pSourceUnit, pSymTable) == RV_SUCCESS);
+		REQUIRE(!(pCallerFunction->GetAttributes() & (AV_READNONE | AV_READONLY)));
+	}
+
+	delete pAnalyser;
+	delete pSymTable;
+	delete pNodesFactory;
+}
@@ -2,6 +2,7 @@
 #include <gplc.h>
 #include "stubLexer.h"
 #include <iostream>
+#include <vector>
 
 void OnError(const gplc::TParserErrorInfo& errorInfo)
 {
@@ -496,6 +497,171 @@ TEST_CASE("Parser's tests")
 		delete pSymbolTable;
 	}
 
+	SECTION("TestParse_PassStructDeclarationWithLayoutAttributes_ReturnsCorrectAST")
+	{
+		gplc::ISymTable* pSymbolTable = new gplc::CSymTable();
+
+		gplc::CASTNode* pMain = pParser->Parse(new CStubLexer(
+			{
+				/*!
+					the sequence below specifies the following declaration
+					struct @packed @reorder NewType {
+						data : int32;
+					}
+				*/
+				new gplc::CToken(gplc::TT_STRUCT_TYPE, 0),
+				new gplc::CToken(gplc::TT_AT_SIGN, 1),
+				new gplc::CToken(gplc::TT_PACKED_KEYWORD, 1),
+				new gplc::CToken(gplc::TT_AT_SIGN, 1),
+				new gplc::CToken(gplc::TT_REORDER_KEYWORD, 1),
+				new gplc::CIdentifierToken("NewType", 1),
+				new gplc::CToken(gplc::TT_OPEN_BRACE, 2),
+				new gplc::CIdentifierToken("data", 3),
+				new gplc::CToken(gplc::TT_COLON, 4),
+				new gplc::CToken(gplc::TT_INT32_TYPE, 5),
+				new gplc::CToken(gplc::TT_SEMICOLON, 6),
+				new gplc::CToken(gplc::TT_CLOSE_BRACE, 7),
+			}), pSymbolTable, pNodesFactory, pTypesFactory);
+
+		REQUIRE(pMain != nullptr);
+
+		auto pStructDecl = dynamic_cast<gplc::CASTStructDeclNode*>(pMain->GetChildren()[0]);
+
+		REQUIRE(pStructDecl);
+		REQUIRE(pStructDecl->GetAttributes() == (gplc::AV_PACKED_LAYOUT | gplc::AV_REORDER_FIELDS));
+
+		delete pSymbolTable;
+	}
+
+	SECTION("TestParse_PassAccessToFieldOfArrayElement_ReturnsCorrectAST")
+	{
+		gplc::ISymTable* pSymbolTable = new gplc::CSymTable();
+
+		gplc::CASTNode* pMain = pParser->Parse(new CStubLexer(
+			{
+				/*!
+					the sequence below specifies the following declaration
+					x : int32 = arr[0].value;
+				*/
+				new gplc::CIdentifierToken("x", 0),
+				new gplc::CToken(gplc::TT_COLON, 1),
+				new gplc::CToken(gplc::TT_INT32_TYPE, 2),
+				new gplc::CToken(gplc::TT_ASSIGN_OP, 3),
+				new gplc::CIdentifierToken("arr", 4),
+				new gplc::CToken(gplc::TT_OPEN_SQR_BRACE, 5),
+				new gplc::CLiteralToken(new gplc::CIntValue(0), 6),
+				new gplc::CToken(gplc::TT_CLOSE_SQR_BRACE, 7),
+				new gplc::CToken(gplc::TT_POINT, 8),
+				new gplc::CIdentifierToken("value", 9),
+				new gplc::CToken(gplc::TT_SEMICOLON, 10),
+			}), pSymbolTable, pNodesFactory, pTypesFactory);
+
+		REQUIRE(pMain != nullptr);
+
+		auto pDefinition = dynamic_cast<gplc::CASTDefinitionNode*>(pMain->GetChildren()[0]);
+
+		REQUIRE(pDefinition);
+
+		auto pAccessNode = dynamic_cast<gplc::CASTAccessOperatorNode*>(pDefinition->GetValue());
+
+		REQUIRE(pAccessNode);
+
+		auto pElementNode = dynamic_cast<gplc::CASTIndexedAccessOperatorNode*>(pAccessNode->GetExpression());
+
+		REQUIRE(pElementNode);
+		REQUIRE(!(pElementNode->GetAttributes() & gplc::AV_RVALUE)); // the element is used as an address of the field
+
+		delete pSymbolTable;
+	}
+
+	SECTION("TestParse_PassWhileLoopWithHints_ReturnsCorrectAST")
+	{
+		gplc::ISymTable* pSymbolTable = new gplc::CSymTable();
+
+		gplc::CASTNode* pMain = pParser->Parse(new CStubLexer(
+			{
+				/*!
+					the sequence below specifies the following statements
+					while @vectorize(4) @unroll(2) i < n { }
+					loop @novectorize { }
+				*/
+				new gplc::CToken(gplc::TT_WHILE_KEYWORD, 0),
+				new gplc::CToken(gplc::TT_AT_SIGN, 1),
+				new gplc::CToken(gplc::TT_VECTORIZE_KEYWORD, 1),
+				new gplc::CToken(gplc::TT_OPEN_BRACKET, 2),
+				new gplc::CLiteralToken(new gplc::CIntValue(4), 3),
+				new gplc::CToken(gplc::TT_CLOSE_BRACKET, 4),
+				new gplc::CToken(gplc::TT_AT_SIGN, 5),
+				new gplc::CToken(gplc::TT_UNROLL_KEYWORD, 5),
+				new gplc::CToken(gplc::TT_OPEN_BRACKET, 6),
+				new gplc::CLiteralToken(new gplc::CIntValue(2), 7),
+				new gplc::CToken(gplc::TT_CLOSE_BRACKET, 8),
+				new gplc::CIdentifierToken("i", 9),
+				new gplc::CToken(gplc::TT_LT, 10),
+				new gplc::CIdentifierToken("n", 11),
+				new gplc::CToken(gplc::TT_OPEN_BRACE, 12),
+				new gplc::CToken(gplc::TT_CLOSE_BRACE, 13),
+				new gplc::CToken(gplc::TT_LOOP_KEYWORD, 14),
+				new gplc::CToken(gplc::TT_AT_SIGN, 15),
+				new gplc::CToken(gplc::TT_NOVECTORIZE_KEYWORD, 15),
+				new gplc::CToken(gplc::TT_OPEN_BRACE, 16),
+				new gplc::CToken(gplc::TT_CLOSE_BRACE, 17),
+			}), pSymbolTable, pNodesFactory, pTypesFactory);
+
+		REQUIRE(pMain != nullptr);
+
+		auto pWhileStatement = dynamic_cast<gplc::CASTWhileLoopStatementNode*>(pMain->GetChildren()[0]);
+
+		REQUIRE(pWhileStatement);
+		REQUIRE(pWhileStatement->GetCondition());
+		REQUIRE(pWhileStatement->GetAttributes() == (gplc::AV_VECTORIZE | gplc::AV_UNROLL));
+		REQUIRE(pWhileStatement->GetHints().mVectorizeWidth == 4);
+		REQUIRE(pWhileStatement->GetHints().mUnrollCount == 2);
+
+		auto pLoopStatement = dynamic_cast<gplc::CASTLoopStatementNode*>(pMain->GetChildren()[1]);
+
+		REQUIRE(pLoopStatement);
+		REQUIRE(pLoopStatement->GetAttributes() == gplc::AV_NO_VECTORIZE);
+		REQUIRE(pLoopStatement->GetHints().mVectorizeWidth == 0);
+
+		delete pSymbolTable;
+	}
+
+	SECTION("TestParse_PassLoopHintsOfFunction_ReportsError")
+	{
+		// \note the shared parser fails on any error, so the separate one collects them
+		gplc::CParser* pOtherParser = new gplc::CParser();
+
+		static std::vector<gplc::E_PARSER_ERRORS> errors;
+
+		errors.clear();
+
+		pOtherParser->OnErrorOutput += [](const gplc::TParserErrorInfo& errorInfo) { errors.push_back(errorInfo.mType); };
+
+		gplc::CASTNode* pMain = pOtherParser->Parse(new CStubLexer(
+			{
+				// the sequence below specifies the following declaration of a function: f: @vectorize(4) (int32) -> int32;
+				new gplc::CIdentifierToken("f", 0),
+				new gplc::CToken(gplc::TT_COLON, 1),
+				new gplc::CToken(gplc::TT_AT_SIGN, 2),
+				new gplc::CToken(gplc::TT_VECTORIZE_KEYWORD, 2),
+				new gplc::CToken(gplc::TT_OPEN_BRACKET, 3),
+				new gplc::CLiteralToken(new gplc::CIntValue(4), 4),
+				new gplc::CToken(gplc::TT_CLOSE_BRACKET, 5),
+				new gplc::CToken(gplc::TT_OPEN_BRACKET, 6),
+				new gplc::CToken(gplc::TT_INT32_TYPE, 7),
+				new gplc::CToken(gplc::TT_CLOSE_BRACKET, 8),
+				new gplc::CToken(gplc::TT_ARROW, 9),
+				new gplc::CToken(gplc::TT_INT32_TYPE, 10),
+				new gplc::CToken(gplc::TT_SEMICOLON, 11),
+			}), new gplc::CSymTable(), pNodesFactory, pTypesFactory);
+
+		REQUIRE(pMain != nullptr);
+		REQUIRE(errors == std::vector<gplc::E_PARSER_ERRORS> { gplc::PE_LOOP_HINT_OUTSIDE_LOOP });
+
+		delete pOtherParser;
+	}
+
 	if (pErrorInfo != nullptr)
 	{
 		delete pErrorInfo;